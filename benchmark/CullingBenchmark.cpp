@@ -0,0 +1,166 @@
+#include "render/scene/BoundingVolumeHierarchy.hpp"
+#include "render/scene/SpatialHashGrid.hpp"
+#include "render/scene/ViewVolumeBuilder.hpp"
+#include "component/Camera.hpp"
+#include "component/Material.hpp"
+#include "component/Mesh.hpp"
+#include "component/Transform.hpp"
+#include "component/Volume.hpp"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace zero;
+using namespace zero::render;
+
+/**
+ * @brief Compare culling with the bounding volume hierarchy alone against the hierarchy combined with the
+ * spatial hash grid while a fraction of the entities move every frame.
+ */
+namespace
+{
+
+constexpr uint32 kEntityCount = 100000;
+constexpr uint32 kWarmUpFrameCount = 10;
+constexpr uint32 kFrameCount = 100;
+constexpr float kWorldExtent = 1000.0F;
+constexpr float kMaxSpeed = 4.0F;
+
+struct Timing
+{
+    double update_ms_;
+    double query_ms_;
+    uint64 visible_count_;
+}; // struct Timing
+
+struct Scene
+{
+    entt::registry registry_;
+    std::vector<Entity> moving_entities_;
+    std::vector<math::Vec3f> velocities_;
+}; // struct Scene
+
+void CreateScene(Scene& scene, float moving_fraction, bool tag_moving_entities)
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> position_distribution(-kWorldExtent, kWorldExtent);
+    std::uniform_real_distribution<float> radius_distribution(1.0F, 4.0F);
+    std::uniform_real_distribution<float> speed_distribution(-kMaxSpeed, kMaxSpeed);
+    std::uniform_real_distribution<float> unit_distribution(0.0F, 1.0F);
+
+    for (uint32 i = 0; i < kEntityCount; ++i)
+    {
+        const math::Vec3f position(position_distribution(generator),
+                                   position_distribution(generator),
+                                   position_distribution(generator));
+        Entity entity = scene.registry_.create();
+        scene.registry_.emplace<Transform>(entity);
+        scene.registry_.emplace<Material>(entity);
+        scene.registry_.emplace<Mesh>(entity);
+        scene.registry_.emplace<Volume>(entity, position, radius_distribution(generator));
+        if (unit_distribution(generator) < moving_fraction)
+        {
+            if (tag_moving_entities)
+            {
+                scene.registry_.emplace<DynamicVolume>(entity);
+            }
+            scene.moving_entities_.push_back(entity);
+            scene.velocities_.emplace_back(speed_distribution(generator),
+                                           speed_distribution(generator),
+                                           speed_distribution(generator));
+        }
+    }
+}
+
+void MoveEntities(Scene& scene)
+{
+    for (uint32 i = 0; i < scene.moving_entities_.size(); ++i)
+    {
+        Volume& volume = scene.registry_.get<Volume>(scene.moving_entities_[i]);
+        math::Vec3f& velocity = scene.velocities_[i];
+        // Bounce off the boundaries of the world
+        const math::Vec3f& center = volume.bounding_volume_.center_;
+        if (center.x_ < -kWorldExtent || center.x_ > kWorldExtent) velocity.x_ = -velocity.x_;
+        if (center.y_ < -kWorldExtent || center.y_ > kWorldExtent) velocity.y_ = -velocity.y_;
+        if (center.z_ < -kWorldExtent || center.z_ > kWorldExtent) velocity.z_ = -velocity.z_;
+        volume.Translate(velocity);
+    }
+}
+
+Timing Run(float moving_fraction, bool use_spatial_hash_grid)
+{
+    using Clock = std::chrono::steady_clock;
+
+    Scene scene{};
+    CreateScene(scene, moving_fraction, use_spatial_hash_grid);
+
+    Camera camera{Camera::ProjectionType::PERSPECTIVE};
+    camera.far_clip_ = 800.0F;
+    const PerspectiveViewVolume camera_volume = ViewVolumeBuilder::CreatePerspective(camera);
+    // Stand-ins for the shadow cascades
+    const OrthographicViewVolume cascade_volumes[] = {
+        OrthographicViewVolume{math::Vec3f(-100.0F), math::Vec3f(100.0F)},
+        OrthographicViewVolume{math::Vec3f(-250.0F), math::Vec3f(250.0F)},
+        OrthographicViewVolume{math::Vec3f(-600.0F), math::Vec3f(600.0F)},
+    };
+
+    BoundingVolumeHierarchy bounding_volume_hierarchy{};
+    SpatialHashGrid spatial_hash_grid{};
+    std::vector<Entity> entities{};
+    Timing timing{0.0, 0.0, 0};
+
+    for (uint32 frame = 0; frame < kWarmUpFrameCount + kFrameCount; ++frame)
+    {
+        MoveEntities(scene);
+
+        const Clock::time_point update_start = Clock::now();
+        bounding_volume_hierarchy.Update(scene.registry_);
+        spatial_hash_grid.Update(scene.registry_);
+        const Clock::time_point query_start = Clock::now();
+
+        entities.clear();
+        bounding_volume_hierarchy.Query(camera_volume, scene.registry_, entities);
+        spatial_hash_grid.Query(camera_volume, scene.registry_, entities);
+        for (const OrthographicViewVolume& cascade_volume : cascade_volumes)
+        {
+            bounding_volume_hierarchy.Query(cascade_volume, scene.registry_, entities);
+            spatial_hash_grid.Query(cascade_volume, scene.registry_, entities);
+        }
+        const Clock::time_point query_end = Clock::now();
+
+        if (frame >= kWarmUpFrameCount)
+        {
+            timing.update_ms_ += std::chrono::duration<double, std::milli>(query_start - update_start).count();
+            timing.query_ms_ += std::chrono::duration<double, std::milli>(query_end - query_start).count();
+            timing.visible_count_ += entities.size();
+        }
+    }
+
+    timing.update_ms_ /= kFrameCount;
+    timing.query_ms_ /= kFrameCount;
+    timing.visible_count_ /= kFrameCount;
+    return timing;
+}
+
+} // namespace
+
+int main(int /* argc */, char** /* argv */)
+{
+    std::printf("%u entities, average of %u frames\n", kEntityCount, kFrameCount);
+    std::printf("%8s %-22s %12s %12s %12s\n", "moving", "structure", "update (ms)", "query (ms)", "visible");
+    for (float moving_fraction : {0.0F, 0.1F, 0.5F, 1.0F})
+    {
+        const Timing hierarchy_timing = Run(moving_fraction, false);
+        const Timing combined_timing = Run(moving_fraction, true);
+        std::printf("%7.0f%% %-22s %12.3f %12.3f %12llu\n",
+                    moving_fraction * 100.0F, "hierarchy",
+                    hierarchy_timing.update_ms_, hierarchy_timing.query_ms_,
+                    static_cast<unsigned long long>(hierarchy_timing.visible_count_));
+        std::printf("%7.0f%% %-22s %12.3f %12.3f %12llu\n",
+                    moving_fraction * 100.0F, "hierarchy + hash grid",
+                    combined_timing.update_ms_, combined_timing.query_ms_,
+                    static_cast<unsigned long long>(combined_timing.visible_count_));
+    }
+    return 0;
+}
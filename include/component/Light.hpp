@@ -17,6 +17,13 @@ namespace zero
     {
         Attenuation();
 
+        /**
+         * @brief Get the distance at which the light is attenuated to the given fraction of its intensity
+         * @param min_intensity the fraction of the intensity, in the range (0, 1)
+         * @return the distance. Infinite if the light is never attenuated that much.
+         */
+        [[nodiscard]] float GetRange(float min_intensity) const;
+
         /**
          * @brief Constant attenuation factor
          *
@@ -133,6 +133,11 @@ namespace zero
          */
         bool visible_;
 
+        /**
+         * @brief Does the entity cast shadows? Entities that do not are never rendered into the shadow maps.
+         */
+        bool casts_shadows_;
+
     private:
 
         /**
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "component/Component.hpp"
+#include "core/ZeroBase.hpp"
+#include "math/Box.hpp"
 #include "math/Sphere.hpp"
 #include "math/Vector3.hpp"
 
@@ -33,7 +35,7 @@ namespace zero
         Volume(const math::Vec3f& min, const math::Vec3f& max);
 
         /**
-         * @brief Engulf the other volume so that the other volume is inside
+         * @brief Engulf the other volume so that the other volume is inside the volume of the entity itself
          * @param other the other volume
          */
         void Engulf(const Volume& other);
@@ -63,10 +65,48 @@ namespace zero
         void Rotate(const math::Quaternion& rotation);
 
         /**
-         * @brief The bounding sphere of the entity
+         * @brief The bounding sphere of the entity and all of its Transform descendants
          */
         math::Sphere bounding_volume_;
 
+        /**
+         * @brief The bounding sphere of the entity itself, without its descendants
+         *
+         * The bounding volume of a parent is refit from this volume and the bounding volumes of its children.
+         * Direct writes to bounding_volume_ of an entity without children must be made to mesh_volume_ as well.
+         */
+        math::Sphere mesh_volume_;
+
+        /**
+         * @brief Incremented whenever the bounding volume is modified through the volume functions.
+         *
+         * Used by the renderer to detect moved volumes. Direct writes to bounding_volume_ must increment it as well.
+         */
+        uint32 version_;
+
     }; // struct Volume
 
+    /**
+     * @brief Tags an entity whose volume moves most frames, such as a projectile or a crowd member
+     *
+     * Dynamic volumes are culled through a spatial grid that is updated incrementally as they move
+     * instead of the bounding volume hierarchy used for static content.
+     */
+    struct DynamicVolume : public Component {}; // struct DynamicVolume
+
+    /**
+     * @brief Marks an entity that hides the entities behind it, such as a wall or a building
+     *
+     * The occluder box is rasterized in place of the entity's mesh by the software occlusion culler,
+     * so it must lie completely inside the rendered geometry. Only the occluders with the largest
+     * area on screen are rasterized each frame.
+     */
+    struct Occluder : public Component
+    {
+        /**
+         * @brief Box in the local space of the entity, inside the rendered geometry
+         */
+        math::Box box_;
+    }; // struct Occluder
+
 } // namespace zero
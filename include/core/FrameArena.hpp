@@ -0,0 +1,199 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+#include "core/NonCopyable.hpp"
+#include "core/ZeroBase.hpp"
+
+namespace zero
+{
+
+    /**
+     * @brief Linear (bump) allocator. Individual allocations are never freed. The whole arena is reset at once.
+     *
+     * When the arena runs out of space, overflow blocks are allocated from the heap.
+     * On reset, the overflow blocks are merged into a single larger block so the following frames do not overflow.
+     */
+    class LinearArena : public NonCopyable
+    {
+    public:
+        /**
+         * @brief Constructor
+         * @param capacity the initial capacity in bytes
+         */
+        explicit LinearArena(std::size_t capacity);
+
+        ~LinearArena() = default;
+
+        /**
+         * @brief Allocate uninitialized memory
+         * @param size the size in bytes
+         * @param alignment the alignment in bytes. Must be a power of two.
+         * @return the allocated memory
+         */
+        [[nodiscard]] void* Allocate(std::size_t size, std::size_t alignment);
+
+        /**
+         * @brief Release all allocations
+         */
+        void Reset();
+
+        /**
+         * @brief Get the number of bytes allocated since the last reset
+         * @return the allocated byte count
+         */
+        [[nodiscard]] std::size_t GetAllocatedBytes() const;
+
+        /**
+         * @brief Get the total capacity of the arena
+         * @return the capacity in bytes
+         */
+        [[nodiscard]] std::size_t GetCapacity() const;
+
+    private:
+        struct Block
+        {
+            std::unique_ptr<std::byte[]> memory_;
+            std::size_t size_;
+        }; // struct Block
+
+        static std::size_t AlignOffset(const Block& block, std::size_t offset, std::size_t alignment);
+        void AddBlock(std::size_t size);
+
+        std::vector<Block> blocks_;
+        std::size_t offset_;
+        std::size_t allocated_bytes_;
+
+    }; // class LinearArena
+
+    /**
+     * @brief STL compatible allocator that allocates from a LinearArena. Deallocation is a no-op.
+     * @tparam T the value type
+     */
+    template<typename T>
+    class ArenaAllocator
+    {
+    public:
+        using value_type = T;
+
+        explicit ArenaAllocator(LinearArena* arena) noexcept
+        : arena_(arena)
+        {
+        }
+
+        template<typename U>
+        ArenaAllocator(const ArenaAllocator<U>& other) noexcept // NOLINT(google-explicit-constructor)
+        : arena_(other.GetArena())
+        {
+        }
+
+        [[nodiscard]] T* allocate(std::size_t count)
+        {
+            return static_cast<T*>(arena_->Allocate(count * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* /* pointer */, std::size_t /* count */) noexcept
+        {
+        }
+
+        [[nodiscard]] LinearArena* GetArena() const noexcept
+        {
+            return arena_;
+        }
+
+        template<typename U>
+        bool operator==(const ArenaAllocator<U>& other) const noexcept
+        {
+            return arena_ == other.GetArena();
+        }
+
+        template<typename U>
+        bool operator!=(const ArenaAllocator<U>& other) const noexcept
+        {
+            return arena_ != other.GetArena();
+        }
+
+    private:
+        LinearArena* arena_;
+
+    }; // class ArenaAllocator
+
+    /**
+     * @brief Deleter for objects constructed in an arena. Only the destructor is invoked.
+     */
+    struct ArenaDeleter
+    {
+        template<typename T>
+        void operator()(T* pointer) const
+        {
+            pointer->~T();
+        }
+    }; // struct ArenaDeleter
+
+    /**
+     * @brief Unique pointer to an object constructed in an arena
+     */
+    template<typename T>
+    using ArenaPtr = std::unique_ptr<T, ArenaDeleter>;
+
+    /**
+     * @brief Multi-buffered linear arena for transient per-frame data.
+     *
+     * Each frame allocates from its own arena. Allocations made during a frame remain valid until the frame's
+     * arena is reused, `buffer_count - 1` frames later.
+     */
+    class FrameArena : public NonCopyable
+    {
+    public:
+        /**
+         * @brief Constructor
+         * @param buffer_count the number of arenas. Should match the number of frames in flight.
+         * @param capacity the initial capacity of each arena in bytes
+         */
+        FrameArena(uint32 buffer_count, std::size_t capacity);
+
+        ~FrameArena() = default;
+
+        /**
+         * @brief Move on to the next frame's arena and reset it
+         */
+        void NextFrame();
+
+        /**
+         * @brief Get the arena of the current frame
+         * @return the current arena
+         */
+        [[nodiscard]] LinearArena* GetArena();
+
+        /**
+         * @brief Get an STL compatible allocator for the current frame
+         * @tparam T the value type
+         * @return the allocator
+         */
+        template<typename T>
+        [[nodiscard]] ArenaAllocator<T> GetAllocator()
+        {
+            return ArenaAllocator<T>(GetArena());
+        }
+
+        /**
+         * @brief Construct an object in the current frame's arena
+         * @return the object. Its destructor is invoked when the pointer is destroyed.
+         */
+        template<typename T, typename... Args>
+        [[nodiscard]] ArenaPtr<T> New(Args&&... args)
+        {
+            void* memory = GetArena()->Allocate(sizeof(T), alignof(T));
+            return ArenaPtr<T>(new (memory) T(std::forward<Args>(args)...));
+        }
+
+    private:
+        std::vector<std::unique_ptr<LinearArena>> arenas_;
+        uint32 current_index_;
+
+    }; // class FrameArena
+
+} // namespace zero
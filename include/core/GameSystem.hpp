@@ -17,6 +17,14 @@ namespace zero
         {
         }
 
+        /**
+         * @brief Refresh the camera right before the scene is captured for rendering
+         *
+         * Only invoked when EngineConfig::late_camera_latch_ is enabled. Called after the simulation, so the camera
+         * should only be updated from the input state already polled this tick (e.g. Input::IsKeyDown).
+         */
+        virtual void LatchCamera() {}
+
     protected:
 
         /**
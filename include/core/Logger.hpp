@@ -1,15 +1,28 @@
 #pragma once
 
 #include "core/ZeroBase.hpp"
+#include <atomic>
 #include <string_view>
 #include <mutex>
 
 #if LOGGING_ENABLED
-#define LOG_FATAL(title, message) Logger::GetLogger().Log(Logger::Level::LEVEL_FATAL, title, message)
-#define LOG_ERROR(title, message) Logger::GetLogger().Log(Logger::Level::LEVEL_ERROR, title, message)
-#define LOG_WARN(title, message) Logger::GetLogger().Log(Logger::Level::LEVEL_WARN, title, message)
-#define LOG_DEBUG(title, message) Logger::GetLogger().Log(Logger::Level::LEVEL_DEBUG, title, message)
-#define LOG_VERBOSE(title, message) Logger::GetLogger().Log(Logger::Level::LEVEL_VERBOSE, title, message)
+/**
+ * @brief Log a message if the level passes the logger's filter. The message is only evaluated when it will be logged.
+ */
+#define LOG_MESSAGE(level, title, message)                          \
+    do                                                              \
+    {                                                               \
+        Logger& zero_logger = Logger::GetLogger();                  \
+        if (zero_logger.IsEnabled(level))                           \
+        {                                                           \
+            zero_logger.Log(level, title, message);                 \
+        }                                                           \
+    } while (false)
+#define LOG_FATAL(title, message) LOG_MESSAGE(Logger::Level::LEVEL_FATAL, title, message)
+#define LOG_ERROR(title, message) LOG_MESSAGE(Logger::Level::LEVEL_ERROR, title, message)
+#define LOG_WARN(title, message) LOG_MESSAGE(Logger::Level::LEVEL_WARN, title, message)
+#define LOG_DEBUG(title, message) LOG_MESSAGE(Logger::Level::LEVEL_DEBUG, title, message)
+#define LOG_VERBOSE(title, message) LOG_MESSAGE(Logger::Level::LEVEL_VERBOSE, title, message)
 #else
 #define LOG_FATAL(title, message)
 #define LOG_ERROR(title, message)
@@ -62,6 +75,13 @@ namespace zero
          */
         [[nodiscard]] Level GetFilter();
 
+        /**
+         * @brief Will a message of the given level be logged?
+         * @param level the log severity
+         * @return true if the level passes the filter. Otherwise false.
+         */
+        [[nodiscard]] bool IsEnabled(Level level);
+
         /**
          * @brief Log a message
          * @param level the log severity
@@ -75,7 +95,7 @@ namespace zero
         Logger();
         ~Logger() = default;
 
-        Level severity_filter_;
+        std::atomic<Level> severity_filter_;
         std::mutex mutex_;
 
     }; // class Logger
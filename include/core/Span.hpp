@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cassert>
+#include <vector>
+#include "core/ZeroBase.hpp"
+
+namespace zero
+{
+
+    /**
+     * @brief Non-owning view over a contiguous sequence of elements
+     * @tparam T the element type
+     */
+    template<typename T>
+    class Span
+    {
+    public:
+        Span()
+        : data_(nullptr)
+        , size_(0)
+        {
+        }
+
+        Span(T* data, uint32 size)
+        : data_(data)
+        , size_(size)
+        {
+        }
+
+        template<typename U, typename Allocator>
+        Span(const std::vector<U, Allocator>& elements) // NOLINT(google-explicit-constructor)
+        : data_(elements.data())
+        , size_(static_cast<uint32>(elements.size()))
+        {
+        }
+
+        template<typename U, typename Allocator>
+        Span(std::vector<U, Allocator>& elements) // NOLINT(google-explicit-constructor)
+        : data_(elements.data())
+        , size_(static_cast<uint32>(elements.size()))
+        {
+        }
+
+        [[nodiscard]] inline T* begin() const { return data_; }
+        [[nodiscard]] inline T* end() const { return data_ + size_; }
+        [[nodiscard]] inline T* data() const { return data_; }
+        [[nodiscard]] inline uint32 size() const { return size_; }
+        [[nodiscard]] inline bool empty() const { return size_ == 0; }
+
+        [[nodiscard]] inline T& operator[](uint32 index) const
+        {
+            assert(index < size_);
+            return data_[index];
+        }
+
+        /**
+         * @brief Get the first `count` elements
+         * @param count the number of elements
+         * @return a span over the first `count` elements
+         */
+        [[nodiscard]] inline Span<T> First(uint32 count) const
+        {
+            assert(count <= size_);
+            return Span<T>(data_, count);
+        }
+
+    private:
+        T* data_;
+        uint32 size_;
+
+    }; // class Span
+
+} // namespace zero
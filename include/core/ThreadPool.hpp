@@ -0,0 +1,84 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "core/NonCopyable.hpp"
+#include "core/ZeroBase.hpp"
+
+namespace zero
+{
+
+    /**
+     * @brief Fixed set of persistent worker threads that execute batches of indexed tasks
+     *
+     * The calling thread takes part in every batch, so a pool without workers executes the tasks serially.
+     * Dispatching a batch does not allocate.
+     */
+    class ThreadPool : public NonCopyable
+    {
+    public:
+        /**
+         * @brief Constructor
+         * @param worker_count the number of worker threads in addition to the calling thread
+         */
+        explicit ThreadPool(uint32 worker_count);
+
+        ~ThreadPool();
+
+        /**
+         * @brief Get the number of worker threads
+         * @return the worker count
+         */
+        [[nodiscard]] uint32 GetWorkerCount() const;
+
+        /**
+         * @brief Invoke the function once for every task index in [0, task_count) and wait for all of them to finish
+         *
+         * Tasks run concurrently in no particular order. Not reentrant: tasks must not call ParallelFor.
+         *
+         * @param task_count the number of tasks
+         * @param function callable with the signature void(uint32 task_index)
+         */
+        template<typename Function>
+        void ParallelFor(uint32 task_count, const Function& function)
+        {
+            Run(task_count, &InvokeTask<Function>, &function);
+        }
+
+    private:
+        using TaskFunction = void (*)(const void* context, uint32 task_index);
+
+        template<typename Function>
+        static void InvokeTask(const void* context, uint32 task_index)
+        {
+            (*static_cast<const Function*>(context))(task_index);
+        }
+
+        void Run(uint32 task_count, TaskFunction task_function, const void* task_context);
+        void WorkerLoop();
+        void ExecuteTasks(uint32 task_count, TaskFunction task_function, const void* task_context);
+
+        std::vector<std::thread> workers_;
+        std::mutex mutex_;
+        std::condition_variable work_condition_;
+        std::condition_variable done_condition_;
+        TaskFunction task_function_;
+        const void* task_context_;
+        uint32 task_count_;
+        std::atomic<uint32> next_task_;
+        /**
+         * @brief Incremented for every batch so that sleeping workers can tell a new batch from a spurious wake up
+         */
+        uint64 batch_;
+        /**
+         * @brief The number of workers currently executing tasks of a batch
+         */
+        uint32 active_worker_count_;
+        bool stop_;
+
+    }; // class ThreadPool
+
+} // namespace zero
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+
 namespace zero
 {
 
@@ -10,6 +12,11 @@ namespace zero
          */
         float frame_delta_time_;
 
+        /**
+         * @brief The time the input events were last polled
+         */
+        std::chrono::steady_clock::time_point input_poll_time_;
+
     }; // class TimeDelta
 
 } // namespace zero
@@ -95,6 +95,27 @@ namespace zero
                                                Entity entity,
                                                const std::function<void(entt::registry&, Entity)>& callback);
 
+    private:
+        /**
+         * @brief Refit the volumes of the entity's ancestors to its current volume
+         *
+         * Culling relies on a parent volume containing the volumes of its entire subtree. Parent volumes shrink as well
+         * as grow, so they do not keep covering the positions their children moved away from. Stops at the first
+         * ancestor whose volume is unchanged or that has no Volume component.
+         *
+         * @param registry the registry containing all entities and their components
+         * @param entity the entity whose volume changed
+         */
+        static void RefitAncestorVolumes(entt::registry& registry, Entity entity);
+
+        /**
+         * @brief Recompute the bounding volume of an entity from its mesh volume and the bounding volumes of its children
+         * @param registry the registry containing all entities and their components
+         * @param entity the entity to refit
+         * @return true if the bounding volume changed. Otherwise false.
+         */
+        static bool RefitVolume(entt::registry& registry, Entity entity);
+
     }; // class TransformSystem
 
 } // namespace zero
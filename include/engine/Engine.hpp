@@ -61,6 +61,24 @@ namespace zero
          */
         [[nodiscard]] EngineCore* GetEngineCore() const;
 
+        /**
+         * @brief Get the time between the last input poll and the presentation of the last rendered frame
+         * @return the input to present latency (milliseconds)
+         */
+        [[nodiscard]] float GetInputLatency() const;
+
+        /**
+         * @brief Get the number of redundant render state changes skipped in the last rendered frame
+         * @return the filtered state change count
+         */
+        [[nodiscard]] uint32 GetFilteredStateChangeCount() const;
+
+        /**
+         * @brief Get the usage and fragmentation of the geometry buffers shared by the meshes
+         * @return the geometry statistics
+         */
+        [[nodiscard]] render::GeometryArena::Statistics GetGeometryStatistics() const;
+
         /**
          * @brief Add a game system to the engine
          *
@@ -85,6 +103,12 @@ namespace zero
          */
         void TickEvents();
 
+        /**
+         * @brief Run a single tick phase
+         * @param tick_phase the phase to run
+         */
+        void RunTickPhase(TickPhase tick_phase);
+
     protected:
 
         /**
@@ -1,10 +1,21 @@
 #pragma once
 
+#include <vector>
 #include "engine/RenderSystemConfig.hpp"
 
 namespace zero
 {
 
+    /**
+     * @brief The phases of a single engine tick
+     */
+    enum class TickPhase
+    {
+        INPUT,                    ///< Poll input events and dispatch them onto the EventBus
+        SIMULATION,               ///< Update the animation system and all game systems
+        RENDER,                   ///< Cull, draw, and present the scene
+    }; // enum class TickPhase
+
     /**
      * @brief The Engine configuration data
      */
@@ -16,6 +27,25 @@ namespace zero
          */
         RenderSystemConfig render_system_config_;
 
+        /**
+         * @brief The order the tick phases are run in.
+         *
+         * The default order renders input-driven changes in the same tick they are polled.
+         */
+        std::vector<TickPhase> tick_phases_{TickPhase::INPUT,
+                                            TickPhase::SIMULATION,
+                                            TickPhase::RENDER};
+
+        /**
+         * @brief Let the game systems refresh the camera right before the scene is captured for rendering
+         *
+         * Within the RENDER phase, GameSystem::LatchCamera is called for every game system before the view is
+         * captured. Input is not polled again: the latch reads the input state polled in the INPUT phase, and the
+         * input poll time used for the latency measurement is the one of that phase. Camera changes made by the
+         * latch are rendered this tick but only simulated the next.
+         */
+        bool late_camera_latch_ = false;
+
     }; // struct EngineConfig
 
 } // namespace zero
@@ -16,6 +16,43 @@ namespace zero
          * @brief The Window Configuration
          */
         WindowConfig window_config_;
+
+        /**
+         * @brief Render each frame on a dedicated render thread while the main thread simulates the next frame
+         */
+        bool multithreaded_rendering_ = false;
+
+        /**
+         * @brief The maximum number of frames queued or rendering on the render thread before the main thread waits
+         */
+        uint32 max_frames_in_flight_ = 1;
+
+        /**
+         * @brief The number of worker threads that cull the scene together with the main thread. Zero culls on the main thread only.
+         */
+        uint32 culling_worker_count_ = 0;
+
+        /**
+         * @brief The number of worker threads that sort the draw calls of large render passes and record the commands of
+         * the render passes together with the render thread. Zero sorts and records on the render thread only.
+         */
+        uint32 sort_worker_count_ = 0;
+
+        /**
+         * @brief Reuse the culling results of the entities whose volume did not change while the view did not change either
+         */
+        bool reuse_unchanged_culling_results_ = true;
+
+        /**
+         * @brief Entities whose bounding sphere projects to a smaller radius in pixels are not drawn. Zero draws every entity.
+         */
+        float min_screen_pixel_radius_ = 0.5F;
+
+        /**
+         * @brief Entities whose bounding sphere is smaller than this radius in shadow map texels of a cascade do not
+         * cast shadows in that cascade. Zero renders every shadow caster.
+         */
+        float min_shadow_texel_radius_ = 1.0F;
     }; // struct RenderSystemConfig
 
 } // namespace zero
\ No newline at end of file
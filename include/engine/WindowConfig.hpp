@@ -22,6 +22,7 @@ namespace zero
     enum class GraphicsAPI
     {
         OPENGL,    ///< Use the OpenGL Graphics API
+        NONE,      ///< Headless. No window or graphics context is created and no GPU work is issued.
     }; // enum class GraphicsAPI
 
     /**
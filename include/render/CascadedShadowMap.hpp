@@ -58,13 +58,13 @@ namespace zero::render
          * @brief Get the light view matrix for each cascade
          * @return the light view matrix for each cascade
          */
-        [[nodiscard]] std::vector<math::Matrix4x4> GetLightViewMatrices() const;
+        [[nodiscard]] const std::vector<math::Matrix4x4>& GetLightViewMatrices() const;
 
         /**
          * @brief Get the projection matrices for each cascade
          * @return the projection matrices for each cascade
          */
-        [[nodiscard]] std::vector<math::Matrix4x4> GetProjectionMatrices() const;
+        [[nodiscard]] const std::vector<math::Matrix4x4>& GetProjectionMatrices() const;
 
         /**
          * @brief Get the texture matrices for each cascade
@@ -73,19 +73,29 @@ namespace zero::render
          *
          * @return the texture matrices
          */
-        [[nodiscard]] std::vector<math::Matrix4x4> GetTextureMatrices() const;
+        [[nodiscard]] const std::vector<math::Matrix4x4>& GetTextureMatrices() const;
 
         /**
          * @brief Retrieve the bounding boxes in world space
          * @return the world-space bounding boxes of each cascade
          */
-        [[nodiscard]] std::vector<math::Box> GetWorldBoundingBoxes() const;
+        [[nodiscard]] const std::vector<math::Box>& GetWorldBoundingBoxes() const;
 
         /**
          * @brief Get the far (z-coordinate) boundary of each cascade in camera view space
          * @return the far (z-coordinate) boundaries
          */
-        [[nodiscard]] std::vector<float> GetViewFarBounds() const;
+        [[nodiscard]] const std::vector<float>& GetViewFarBounds() const;
+
+        /**
+         * @brief Get the world space size of a shadow map texel in a cascade
+         *
+         * The smaller of the horizontal and vertical texel sizes of the cascade's light space projection.
+         *
+         * @param cascade_index the cascade
+         * @return the texel size
+         */
+        [[nodiscard]] float GetTexelSize(uint32 cascade_index) const;
 
         /**
          * @brief Get the direction of the directional light this Shadow Map is based on
@@ -111,7 +121,7 @@ namespace zero::render
         void UpdateTextureMatrices();
 
         static const float kMaxCascadeZCoverage;
-        const uint32 cascade_count_;
+        uint32 cascade_count_;
         Camera cached_camera_;
         std::vector<math::Matrix4x4> light_view_matrices_;
         std::vector<math::Matrix4x4> projection_matrices_;
@@ -22,12 +22,64 @@ namespace zero::render
         /**
          * @brief The maximum point light count
          */
-        static constexpr uint32 kMaxPointLights = 4U;
+        static constexpr uint32 kMaxPointLights = 256U;
 
         /**
          * @brief The maximum spot light count
          */
-        static constexpr uint32 kMaxSpotLights = 4U;
+        static constexpr uint32 kMaxSpotLights = 256U;
+
+        /**
+         * @brief The attenuated light intensity below which a point or spot light no longer lights a surface
+         */
+        static constexpr float kMinLightIntensity = 1.0F / 256.0F;
+
+        /**
+         * @brief The dimensions of the view frustum grid that point and spot lights are assigned to
+         *
+         * The x and y clusters evenly split the screen. The z clusters split the view depth logarithmically.
+         */
+        ///@{
+        static constexpr uint32 kLightClusterCountX = 16U;
+        static constexpr uint32 kLightClusterCountY = 9U;
+        static constexpr uint32 kLightClusterCountZ = 24U;
+        static constexpr uint32 kLightClusterCount = kLightClusterCountX * kLightClusterCountY * kLightClusterCountZ;
+        ///@}
+
+        /**
+         * @brief The maximum number of light indices referenced by all the light clusters together
+         */
+        static constexpr uint32 kMaxLightClusterIndexCount = 131072U;
+
+        /**
+         * @brief The maximum number of instances uploaded to the instance buffer at once
+         */
+        static constexpr uint32 kMaxInstanceCount = 16384U;
+
+        /**
+         * @brief The uniform ring
+         *
+         * Every frame writes its uniform data into its own region of the ring, so the region count is the number of
+         * frames whose uniform data can be read by the GPU at once.
+         */
+        ///@{
+        static constexpr uint32 kUniformRingRegionCount = 3U;
+        static constexpr uint32 kUniformRingRegionSize = 65536U;
+        ///@}
+
+        /**
+         * @brief The size of a region of the storage ring, which holds the instance windows of every pass of a frame.
+         * The storage ring has as many regions as the uniform ring.
+         */
+        static constexpr uint32 kStorageRingRegionSize = 8388608U;
+
+        /**
+         * @brief The number of vertices and indices of a page of the shared geometry buffers
+         */
+        ///@{
+        static constexpr uint32 kGeometryPageVertexCount = 262144U;
+        static constexpr uint32 kGeometryPageIndexCount = 1048576U;
+        ///@}
 
         /**
          * @brief The number of cascades used in Cascaded Shadow Mapping
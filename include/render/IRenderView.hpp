@@ -1,15 +1,129 @@
 #pragma once
 
+#include <vector>
 #include "component/Camera.hpp"
 #include "component/Light.hpp"
+#include "component/Material.hpp"
 #include "component/Transform.hpp"
 #include "component/SkyDome.hpp"
+#include "core/Span.hpp"
 #include "core/TimeDelta.hpp"
 #include "render/CascadedShadowMap.hpp"
 
 namespace zero::render
 {
 
+    /**
+     * @brief The data required to draw a visible entity, captured when the view was generated
+     */
+    struct DrawItem
+    {
+        uint32 mesh_id_;
+        Material material_;
+        math::Matrix4x4 model_matrix_;
+    }; // struct DrawItem
+
+    /**
+     * @brief The data required to draw a shadow casting entity, captured when the view was generated
+     */
+    struct ShadowDrawItem
+    {
+        uint32 mesh_id_;
+        math::Matrix4x4 model_matrix_;
+    }; // struct ShadowDrawItem
+
+    /**
+     * @brief A point light and its world position
+     */
+    struct PointLightEntry
+    {
+        PointLight light_;
+        math::Vec3f position_;
+    }; // struct PointLightEntry
+
+    /**
+     * @brief A spot light and its world position and direction
+     */
+    struct SpotLightEntry
+    {
+        SpotLight light_;
+        math::Vec3f position_;
+        math::Vec3f direction_;
+    }; // struct SpotLightEntry
+
+    /**
+     * @brief The point and spot lights affecting a cluster of the view frustum
+     *
+     * The indices of the point lights are followed by the indices of the spot lights in the light index list.
+     */
+    struct LightCluster
+    {
+        /**
+         * @brief The offset of the first light index in the light index list
+         */
+        uint32 light_index_offset_;
+        /**
+         * @brief The point light count in the lower 16 bits and the spot light count in the upper 16 bits
+         */
+        uint32 light_counts_;
+    }; // struct LightCluster
+
+    /**
+     * @brief The point and spot lights assigned to every cluster of the view frustum
+     *
+     * The clusters are ordered by z, then y, then x. The z cluster of a view depth is log(depth) * depth_scale_ + depth_bias_.
+     */
+    struct LightClusterGrid
+    {
+        /**
+         * @brief The camera matrices the clusters were built with
+         */
+        ///@{
+        math::Matrix4x4 view_matrix_;
+        math::Matrix4x4 projection_matrix_;
+        ///@}
+        float depth_scale_ = 0.0F;
+        float depth_bias_ = 0.0F;
+        std::vector<LightCluster> clusters_;
+        std::vector<uint32> light_indices_;
+    }; // struct LightClusterGrid
+
+    /**
+     * @brief The number of entities removed by each culling technique when the view was generated
+     */
+    struct CullingStatistics
+    {
+        /**
+         * @brief The renderable entities that passed view frustum culling
+         */
+        uint32 frustum_visible_count_ = 0;
+        /**
+         * @brief The frustum visible entities whose draws were removed because they are too small on screen
+         */
+        uint32 screen_size_culled_count_ = 0;
+        /**
+         * @brief The occluders rasterized for occlusion culling
+         */
+        uint32 occluder_count_ = 0;
+        /**
+         * @brief The frustum visible entities whose draws were removed because they are occluded
+         */
+        uint32 occluded_count_ = 0;
+        /**
+         * @brief The shadow draws removed because the casters are too small in the texels of their cascade
+         */
+        uint32 shadow_size_culled_count_ = 0;
+        /**
+         * @brief The point and spot lights whose range does not reach the camera view volume
+         */
+        uint32 light_culled_count_ = 0;
+    }; // struct CullingStatistics
+
+    /**
+     * @brief Self-contained snapshot of the scene used to render a single frame.
+     *
+     * A view does not reference the registry, which allows it to be rendered while the next frame is simulated.
+     */
     class IRenderView
     {
     public:
@@ -21,12 +135,15 @@ namespace zero::render
 
         virtual const CascadedShadowMap& GetCascadedShadowMap() = 0;
 
-        virtual const std::vector<Entity>& GetRenderableEntities() = 0;
-        virtual const std::vector<Entity>& GetShadowCastingEntities(uint32 cascade_index) = 0;
+        virtual Span<const DrawItem> GetDrawItems() = 0;
+        virtual Span<const ShadowDrawItem> GetShadowDrawItems(uint32 cascade_index) = 0;
+
+        virtual Span<const DirectionalLight> GetDirectionalLights() = 0;
+        virtual Span<const PointLightEntry> GetPointLights() = 0;
+        virtual Span<const SpotLightEntry> GetSpotLights() = 0;
+        virtual const LightClusterGrid& GetLightClusterGrid() = 0;
 
-        virtual const std::vector<DirectionalLight>& GetDirectionalLights() = 0;
-        virtual const std::vector<std::pair<PointLight, Transform>>& GetPointLights() = 0;
-        virtual const std::vector<std::pair<SpotLight, Transform>>& GetSpotLights() = 0;
+        virtual const CullingStatistics& GetCullingStatistics() = 0;
     }; // interface IRenderView
 
-} // namespace zero::render
\ No newline at end of file
+} // namespace zero::render
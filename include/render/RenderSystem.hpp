@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+#include <functional>
 #include <memory>
 #include "component/Component.hpp"
 #include "component/Light.hpp"
@@ -7,6 +9,7 @@
 #include "core/System.hpp"
 #include "engine/RenderSystemConfig.hpp"
 #include "render/ModelLoader.hpp"
+#include "render/RenderThread.hpp"
 #include "render/Window.hpp"
 #include "render/renderer/IRenderHardware.hpp"
 #include "render/renderer/RenderingPipeline.hpp"
@@ -93,14 +96,76 @@ namespace zero::render
          */
         Entity CreateLightInstance(const Light& light, Entity entity) const;
 
+        /**
+         * @brief Set the callback invoked right before the scene is captured into the render view
+         *
+         * The callback is used to refresh the camera from the input state already polled this tick. It must not poll
+         * input itself. Everything it changes is culled and rendered this frame, but is only simulated in the next tick.
+         *
+         * @param late_latch_callback the callback
+         */
+        void SetLateLatchCallback(std::function<void()> late_latch_callback);
+
+        /**
+         * @brief Get the time between the last input poll and the presentation of the last rendered frame
+         * @return the input to present latency (milliseconds)
+         */
+        [[nodiscard]] float GetInputLatency() const;
+
+        /**
+         * @brief Get the number of redundant render state changes skipped by the render hardware in the last rendered frame
+         * @return the filtered state change count
+         */
+        [[nodiscard]] uint32 GetFilteredStateChangeCount() const;
+
+        /**
+         * @brief Get the usage and fragmentation of the geometry buffers shared by the meshes
+         *
+         * With multithreaded rendering, waits for the frames in flight to be rendered.
+         *
+         * @return the geometry statistics
+         */
+        [[nodiscard]] GeometryArena::Statistics GetGeometryStatistics() const;
+
     private:
         /**
          * @brief Load all 3D assets
          */
         void LoadModels();
 
+        /**
+         * @brief Generate, sort, and execute the draw calls of a view and present the frame.
+         *
+         * Runs on the render thread when multithreaded rendering is enabled.
+         *
+         * @param render_view the view to render
+         */
+        void RenderFrame(IRenderView* render_view);
+
         void GenerateDrawCalls(IRenderView* render_view) const;
 
+        /**
+         * @brief Queue the mesh of a destroyed entity for release
+         */
+        void OnMeshDestroyed(entt::registry& registry, Entity entity);
+
+        /**
+         * @brief Release the meshes of the entities destroyed since the last frame.
+         *
+         * With multithreaded rendering, the release is queued behind the frames that may still draw the meshes.
+         */
+        void ReleaseMeshes();
+
+        /**
+         * @brief Transfer ownership of the graphics context to the render thread and start it
+         */
+        void StartRenderThread();
+
+        /**
+         * @brief Stop the render thread and transfer ownership of the graphics context back to the calling thread
+         */
+        void StopRenderThread();
+
         /**
          * @brief Check whether there is an active camera in the scene
          * @return True if there is an active Camera entity in the scene. Otherwise, false.
@@ -118,6 +183,11 @@ namespace zero::render
         std::unique_ptr<RenderingPipeline> rendering_pipeline_;
         std::unique_ptr<SceneManager> scene_manager_;
         std::unordered_map<std::string, std::shared_ptr<Model>> model_cache_;
+        std::function<void()> late_latch_callback_;
+        std::vector<uint32> released_mesh_ids_;
+        std::unique_ptr<RenderThread> render_thread_;
+        std::atomic<float> input_latency_;
+        std::atomic<uint32> filtered_state_change_count_;
 
     }; // class RenderSystem
 
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "core/NonCopyable.hpp"
+#include "core/ZeroBase.hpp"
+
+namespace zero::render
+{
+
+    /**
+     * @brief Dedicated thread that owns the graphics context and executes render tasks in submission order.
+     *
+     * Ownership contract: once started, every call into the IRenderHardware and the RenderingPipeline must be
+     * made by a task executed on the render thread. The thread that submits tasks must not touch the graphics
+     * context until the render thread is stopped.
+     */
+    class RenderThread : public NonCopyable
+    {
+    public:
+        /**
+         * @brief Constructor
+         * @param max_pending_tasks the maximum number of tasks queued or executing before Submit blocks
+         */
+        explicit RenderThread(uint32 max_pending_tasks);
+
+        /**
+         * @brief Stop the thread if it is still running
+         */
+        ~RenderThread();
+
+        /**
+         * @brief Start executing tasks
+         * @param on_start task executed on the render thread before any submitted task (e.g. acquire the graphics context)
+         * @param on_stop task executed on the render thread after all submitted tasks (e.g. release the graphics context)
+         */
+        void Start(std::function<void()> on_start, std::function<void()> on_stop);
+
+        /**
+         * @brief Execute all remaining tasks and join the thread
+         */
+        void Stop();
+
+        /**
+         * @brief Is the render thread running?
+         * @return True if the thread has been started and not stopped. Otherwise false.
+         */
+        [[nodiscard]] bool IsRunning() const;
+
+        /**
+         * @brief Queue a task for execution.
+         *
+         * Blocks the calling thread while the maximum number of tasks are pending.
+         *
+         * @param task the task to execute on the render thread
+         */
+        void Submit(std::function<void()> task);
+
+        /**
+         * @brief Queue a task for execution and wait for it to complete. Must not be called from the render thread.
+         * @param task the task to execute on the render thread
+         */
+        void Execute(const std::function<void()>& task);
+
+        /**
+         * @brief Wait until all queued tasks have been executed. Must not be called from the render thread.
+         */
+        void Flush();
+
+    private:
+        /**
+         * @brief Execute tasks until stopped
+         */
+        void Run();
+
+        const uint32 max_pending_tasks_;
+        std::thread thread_;
+        std::mutex mutex_;
+        std::condition_variable task_queued_;
+        std::condition_variable task_completed_;
+        // Ring of pending tasks, sized once so submitting a task does not allocate
+        std::vector<std::function<void()>> tasks_;
+        uint32 first_task_index_;
+        uint32 task_count_;
+        std::function<void()> on_start_;
+        std::function<void()> on_stop_;
+        bool is_running_;
+        bool is_executing_;
+
+    }; // class RenderThread
+
+} // namespace zero::render
@@ -40,6 +40,16 @@ namespace zero::render
          */
         void SwapBuffers();
 
+        /**
+         * @brief Make the GL Context current on the calling thread
+         */
+        void MakeContextCurrent();
+
+        /**
+         * @brief Release the GL Context from the calling thread so that it can be made current on another thread
+         */
+        void ReleaseContext();
+
         /**
          * @brief Clean up the Window and GL Context
          */
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "core/NonCopyable.hpp"
+#include "core/ZeroBase.hpp"
+#include "render/renderer/DrawIndirectCommand.hpp"
+#include "render/renderer/IDrawCall.hpp"
+#include "render/renderer/IRenderHardware.hpp"
+#include "render/renderer/UniformManager.hpp"
+
+namespace zero::render
+{
+
+    /**
+     * @brief A backend agnostic stream of bind, update, and draw commands
+     *
+     * Render passes record their commands without touching the render hardware, so passes can be recorded
+     * concurrently on worker threads. The thread that owns the graphics context then submits the buffers in order,
+     * translating every command into its render hardware call.
+     *
+     * Commands are packed into a byte stream. Resources are recorded by reference: the shared pointers, data, and
+     * draw calls given to the record methods must stay alive and unchanged until the buffer is submitted. Only the
+     * data of uniform writes is copied into the stream.
+     */
+    class CommandBuffer : public NonCopyable
+    {
+    public:
+        CommandBuffer();
+        ~CommandBuffer() = default;
+
+        /**
+         * @brief Remove all recorded commands
+         */
+        void Reset();
+
+        /**
+         * @brief Record the render hardware call of the same name
+         * @see IRenderHardware
+         */
+        ///@{
+        void BeginFrame(const std::shared_ptr<IFrameBuffer>& frame_buffer);
+        void EndFrame();
+        void SetViewport(uint32 x, uint32 y, uint32 width, uint32 height);
+        void SetFillMode(IRenderHardware::FillMode fill_mode);
+        void SetCullMode(IRenderHardware::CullMode cull_mode);
+        void Clear();
+        void BindShaderProgram(const std::shared_ptr<IProgram>& shader_program);
+        void BindTexture(const std::shared_ptr<ITexture>& texture, const std::shared_ptr<ISampler>& texture_sampler, uint32 uniform_name_identifier);
+        void BindStorageBuffer(const std::shared_ptr<IStorageBuffer>& storage_buffer);
+        void UpdateDrawCommands(const DrawIndirectCommand* draw_commands, uint32 draw_command_count);
+        void DrawMesh(const std::shared_ptr<IMesh>& mesh);
+        void MultiDrawMeshIndirect(const std::shared_ptr<IMesh>& mesh, uint32 first_command, uint32 command_count);
+        ///@}
+
+        /**
+         * @brief Record a write of uniform block data. The data is copied into the buffer.
+         * @see UniformManager::WriteUniform
+         */
+        void WriteUniform(UniformBlock uniform_block, const void* data, uint32 data_size);
+
+        /**
+         * @brief Record a bind of the latest data written for a uniform block
+         * @see UniformManager::BindUniform
+         */
+        void BindUniform(UniformBlock uniform_block);
+
+        /**
+         * @brief Record a write of a window of instance data. The data is referenced, not copied.
+         * @see UniformManager::WriteInstances
+         */
+        void WriteInstances(const void* data, uint32 data_size);
+
+        /**
+         * @brief Record a bind of the latest instance data written
+         * @see UniformManager::BindInstances
+         */
+        void BindInstances();
+
+        /**
+         * @brief Record the execution of a draw call
+         * @param draw_call the draw call. Executed with the render hardware on submission.
+         */
+        void ExecuteDrawCall(IDrawCall* draw_call);
+
+        /**
+         * @brief Execute the recorded commands in order. Must be called by the thread that owns the graphics context.
+         * @param rhi the render hardware interface
+         * @param uniform_manager the uniform manager that writes and binds the uniform blocks
+         */
+        void Submit(IRenderHardware* rhi, UniformManager& uniform_manager) const;
+
+        /**
+         * @brief Has nothing been recorded?
+         * @return true if there are no commands. Otherwise false.
+         */
+        [[nodiscard]] bool IsEmpty() const;
+
+        /**
+         * @brief Get the number of recorded commands
+         * @return the command count
+         */
+        [[nodiscard]] uint32 GetCommandCount() const;
+
+        /**
+         * @brief Get the size of the command stream
+         * @return the size in bytes
+         */
+        [[nodiscard]] uint32 GetSize() const;
+
+    private:
+        /**
+         * @brief Append a command and its arguments to the stream
+         */
+        template<typename Command>
+        void Record(const Command& command);
+
+        std::vector<uint8> commands_;
+        uint32 command_count_;
+
+    }; // class CommandBuffer
+
+} // namespace zero::render
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include "core/NonCopyable.hpp"
+#include "core/ThreadPool.hpp"
+#include "core/ZeroBase.hpp"
+#include "render/renderer/DrawPacket.hpp"
+#include "render/renderer/IDrawCall.hpp"
+
+namespace zero::render
+{
+
+    /**
+     * @brief The draws of a render pass, executed in increasing sort key order
+     *
+     * Most draws are plain data draw packets executed by the render pass. Special draws that need their own
+     * logic, like the sky dome, are submitted as draw calls.
+     *
+     * The sort keys are copied next to the index of their draw into a flat list, which is sorted with a
+     * least significant digit radix sort. Large queues are sorted on a thread pool.
+     * The storage is reused across frames, so a steady state frame does not allocate.
+     */
+    class DrawCallQueue : public NonCopyable
+    {
+    public:
+        /**
+         * @brief A draw in the sorted list
+         */
+        struct Entry
+        {
+            uint64 sort_key_;
+            /**
+             * @brief The index of the draw packet or draw call in submission order. Draw calls have kDrawCallFlag set.
+             */
+            uint32 draw_index_;
+        }; // struct Entry
+
+        static constexpr uint32 kDrawCallFlag = 1U << 31U;
+
+        static constexpr uint32 kRadixBits = 8;
+        static constexpr uint32 kRadixBucketCount = 1U << kRadixBits;
+        using Histogram = std::array<uint32, kRadixBucketCount>;
+
+        /**
+         * @brief Queues with fewer draw calls are sorted on the calling thread only
+         */
+        static constexpr uint32 kParallelSortThreshold = 16384;
+
+        DrawCallQueue();
+        ~DrawCallQueue() = default;
+
+        /**
+         * @brief Add a draw packet to the end of the queue
+         * @param draw_packet the draw packet
+         * @param sort_key the key the packet is sorted by, see DrawKey
+         */
+        void Submit(const DrawPacket& draw_packet, uint64 sort_key);
+
+        /**
+         * @brief Add a draw call to the end of the queue
+         * @param draw_call the draw call
+         */
+        void Submit(DrawCallPtr draw_call);
+
+        /**
+         * @brief Sort the draws by their sort key. Draws with equal keys keep their submission order.
+         * @param thread_pool the thread pool to sort large queues on
+         */
+        void Sort(ThreadPool& thread_pool);
+
+        /**
+         * @brief Execute the draws in sorted order
+         * @param rhi the render hardware interface to use for rendering
+         * @param max_batch_size the maximum number of draw packets in a batch
+         * @param draw_batch_function callable with the signature
+         * void(const DrawPacket& draw_packet, uint32 first_instance, uint32 instance_count) that draws a batch.
+         * See ForEachBatch.
+         */
+        template<typename DrawBatchFunction>
+        void Draw(IRenderHardware* rhi, uint32 max_batch_size, const DrawBatchFunction& draw_batch_function) const
+        {
+            ForEachBatch(max_batch_size, draw_batch_function, [rhi](IDrawCall& draw_call)
+            {
+                draw_call.Draw(rhi);
+            });
+        }
+
+        /**
+         * @brief Visit the draws in sorted order
+         *
+         * Consecutive draw packets that can be instanced together are merged into a batch. Instances are numbered by the
+         * sorted order of the draw packets, skipping the draw calls.
+         *
+         * @param max_batch_size the maximum number of draw packets in a batch
+         * @param draw_batch_function callable with the signature
+         * void(const DrawPacket& draw_packet, uint32 first_instance, uint32 instance_count).
+         * The draw packet is the first one of the batch.
+         * @param draw_call_function callable with the signature void(IDrawCall& draw_call)
+         */
+        template<typename DrawBatchFunction, typename DrawCallFunction>
+        void ForEachBatch(uint32 max_batch_size,
+                          const DrawBatchFunction& draw_batch_function,
+                          const DrawCallFunction& draw_call_function) const
+        {
+            const auto entry_count = static_cast<uint32>(entries_.size());
+            uint32 instance_index = 0;
+            uint32 entry_index = 0;
+            while (entry_index < entry_count)
+            {
+                const uint32 draw_index = entries_[entry_index].draw_index_;
+                if ((draw_index & kDrawCallFlag) != 0)
+                {
+                    draw_call_function(*draw_calls_[draw_index & ~kDrawCallFlag]);
+                    ++entry_index;
+                    continue;
+                }
+
+                const DrawPacket& draw_packet = draw_packets_[draw_index];
+                uint32 instance_count = 1;
+                while (instance_count < max_batch_size && entry_index + instance_count < entry_count)
+                {
+                    const uint32 next_draw_index = entries_[entry_index + instance_count].draw_index_;
+                    if ((next_draw_index & kDrawCallFlag) != 0 || !CanInstance(draw_packet, draw_packets_[next_draw_index]))
+                    {
+                        break;
+                    }
+                    ++instance_count;
+                }
+
+                draw_batch_function(draw_packet, instance_index, instance_count);
+                instance_index += instance_count;
+                entry_index += instance_count;
+            }
+        }
+
+        /**
+         * @brief Can two draw packets be drawn by the same instanced draw?
+         * @return true if they share the mesh, program, textures, and render state. Otherwise, false.
+         */
+        [[nodiscard]] static bool CanInstance(const DrawPacket& lhs, const DrawPacket& rhs);
+
+        /**
+         * @brief Remove the draw packets and destroy the draw calls
+         */
+        void Clear();
+
+        /**
+         * @return true if nothing was submitted. Otherwise, false.
+         */
+        [[nodiscard]] bool IsEmpty() const;
+
+        /**
+         * @return the sorted entries. Only sorted after a call to Sort.
+         */
+        [[nodiscard]] const std::vector<Entry>& GetEntries() const;
+
+        /**
+         * @param draw_index the index of an entry without kDrawCallFlag
+         * @return the draw packet
+         */
+        [[nodiscard]] const DrawPacket& GetDrawPacket(uint32 draw_index) const;
+
+        /**
+         * @param draw_index the index of an entry with kDrawCallFlag
+         * @return the draw call
+         */
+        [[nodiscard]] IDrawCall& GetDrawCall(uint32 draw_index) const;
+
+        /**
+         * @brief Stable radix sort of entries by their sort key
+         *
+         * The digits of every key are counted in a single pass. Digits shared by every key are skipped.
+         *
+         * @param entries the entries to sort
+         * @param scratch the buffer to scatter into. Its content is unspecified afterwards.
+         */
+        static void RadixSort(std::vector<Entry>& entries, std::vector<Entry>& scratch);
+
+        /**
+         * @brief Stable radix sort of entries by their sort key on a thread pool. The result is identical to RadixSort.
+         *
+         * The entries are split into one chunk per thread. For every digit, the chunks are counted concurrently,
+         * the offsets of every chunk are computed serially, and the chunks are scattered concurrently.
+         *
+         * @param thread_pool the thread pool to sort on
+         * @param entries the entries to sort
+         * @param scratch the buffer to scatter into. Its content is unspecified afterwards.
+         * @param histograms the histograms of the chunks. Resized to the chunk count.
+         */
+        static void ParallelRadixSort(ThreadPool& thread_pool,
+                                      std::vector<Entry>& entries,
+                                      std::vector<Entry>& scratch,
+                                      std::vector<Histogram>& histograms);
+
+    private:
+        std::vector<DrawPacket> draw_packets_;
+        std::vector<DrawCallPtr> draw_calls_;
+        std::vector<Entry> entries_;
+        std::vector<Entry> scratch_;
+        std::vector<Histogram> histograms_;
+
+    }; // class DrawCallQueue
+
+} // namespace zero::render
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <type_traits>
+#include "core/ZeroBase.hpp"
+
+namespace zero::render
+{
+
+    /**
+     * @brief The arguments of one instanced draw of a multi draw
+     *
+     * Matches the layout of DrawElementsIndirectCommand, so a list of commands can be uploaded as is.
+     */
+    struct DrawIndirectCommand
+    {
+        uint32 index_count_;
+        uint32 instance_count_;
+        uint32 first_index_;
+        uint32 base_vertex_;
+        uint32 base_instance_;
+    }; // struct DrawIndirectCommand
+
+    static_assert(sizeof(DrawIndirectCommand) == 5 * sizeof(uint32), "Draw commands are uploaded as plain data");
+    static_assert(std::is_trivially_copyable_v<DrawIndirectCommand>, "Draw commands are uploaded as plain data");
+
+} // namespace zero::render
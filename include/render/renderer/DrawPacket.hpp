@@ -0,0 +1,37 @@
+#pragma once
+
+#include <type_traits>
+#include "core/ZeroBase.hpp"
+
+namespace zero::render
+{
+
+    /**
+     * @brief Plain data description of a draw of a mesh
+     *
+     * Resources are referred to by their handle in the RenderResources, and the per-draw uniform data by its index
+     * in the frame data of the RenderResources. How the packet is drawn is up to the render pass it is submitted to.
+     */
+    struct DrawPacket
+    {
+        uint32 mesh_handle_;
+        uint32 program_handle_;
+        /**
+         * @brief The diffuse texture. RenderResources::kInvalidHandle if the material has none.
+         */
+        uint32 texture_handle_;
+        /**
+         * @brief Index of the ModelData in the frame data
+         */
+        uint32 model_index_;
+        /**
+         * @brief Index of the MaterialData in the frame data. Unused by passes without materials.
+         */
+        uint32 material_index_;
+        bool two_sided_;
+        bool wireframe_enabled_;
+    }; // struct DrawPacket
+
+    static_assert(std::is_trivially_copyable_v<DrawPacket>, "Draw packets are copied as plain data");
+
+} // namespace zero::render
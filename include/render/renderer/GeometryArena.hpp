@@ -0,0 +1,143 @@
+#pragma once
+
+#include <vector>
+#include "core/NonCopyable.hpp"
+#include "core/ZeroBase.hpp"
+
+namespace zero::render
+{
+
+    /**
+     * @brief The bookkeeping of vertex and index buffers shared by many meshes
+     *
+     * The arena is made of pages, each a vertex buffer and an index buffer of fixed capacity. A mesh is allocated a
+     * range of vertices and a range of indices in the same page, so the meshes of a page can be drawn without
+     * switching buffers by offsetting their draws with the first index and base vertex. Pages are added when no page
+     * has room for a mesh. Meshes larger than a page are given a page of their own size.
+     *
+     * Freed ranges are merged with their free neighbours and reused first fit. Not thread safe.
+     */
+    class GeometryArena : public NonCopyable
+    {
+    public:
+        /**
+         * @brief The ranges of a mesh
+         */
+        struct Allocation
+        {
+            uint32 page_index_;
+            uint32 base_vertex_;
+            uint32 vertex_count_;
+            uint32 first_index_;
+            uint32 index_count_;
+        }; // struct Allocation
+
+        /**
+         * @brief The usage of the vertices or the indices of all pages
+         */
+        struct RangeStatistics
+        {
+            uint32 capacity_ = 0;
+            uint32 used_count_ = 0;
+            uint32 free_range_count_ = 0;
+            uint32 largest_free_range_ = 0;
+
+            /**
+             * @brief Get the share of the free space that is not in the largest free range
+             * @return 0 if the free space is contiguous, approaching 1 as it is split into small ranges
+             */
+            [[nodiscard]] float GetFragmentation() const;
+        }; // struct RangeStatistics
+
+        struct Statistics
+        {
+            uint32 page_count_ = 0;
+            uint32 allocation_count_ = 0;
+            RangeStatistics vertices_;
+            RangeStatistics indices_;
+        }; // struct Statistics
+
+        /**
+         * @param page_vertex_capacity the number of vertices of a page
+         * @param page_index_capacity the number of indices of a page
+         */
+        GeometryArena(uint32 page_vertex_capacity, uint32 page_index_capacity);
+        ~GeometryArena() = default;
+
+        /**
+         * @brief Allocate the ranges of a mesh, adding a page if none has room
+         * @param vertex_count the number of vertices of the mesh
+         * @param index_count the number of indices of the mesh
+         * @return the allocation
+         */
+        Allocation Allocate(uint32 vertex_count, uint32 index_count);
+
+        /**
+         * @brief Free the ranges of a mesh
+         * @param allocation the allocation returned by Allocate
+         */
+        void Free(const Allocation& allocation);
+
+        /**
+         * @brief Get the number of pages
+         * @return the page count
+         */
+        [[nodiscard]] uint32 GetPageCount() const;
+
+        /**
+         * @brief Get the capacity of a page
+         * @param page_index the index of the page
+         * @return the number of vertices or indices of the page
+         */
+        ///@{
+        [[nodiscard]] uint32 GetPageVertexCapacity(uint32 page_index) const;
+        [[nodiscard]] uint32 GetPageIndexCapacity(uint32 page_index) const;
+        ///@}
+
+        /**
+         * @brief Get the usage and fragmentation of the pages
+         * @return the statistics
+         */
+        [[nodiscard]] Statistics GetStatistics() const;
+
+    private:
+        struct Range
+        {
+            uint32 offset_;
+            uint32 count_;
+        }; // struct Range
+
+        /**
+         * @brief The free ranges of a buffer, ordered by offset
+         */
+        struct FreeList
+        {
+            uint32 capacity_;
+            std::vector<Range> free_ranges_;
+        }; // struct FreeList
+
+        struct Page
+        {
+            FreeList vertices_;
+            FreeList indices_;
+        }; // struct Page
+
+        /**
+         * @return the index of the first free range that fits the count. The free range count if none fits.
+         */
+        static uint32 FindFreeRange(const FreeList& free_list, uint32 count);
+        /**
+         * @return the offset of the count taken from the front of the free range
+         */
+        static uint32 TakeFreeRange(FreeList& free_list, uint32 free_range_index, uint32 count);
+        static void ReturnRange(FreeList& free_list, const Range& range);
+        static void AddStatistics(const FreeList& free_list, RangeStatistics& range_statistics);
+
+        uint32 page_vertex_capacity_;
+        uint32 page_index_capacity_;
+        std::vector<Page> pages_;
+        uint32 allocation_count_;
+
+    }; // class GeometryArena
+
+} // namespace zero::render
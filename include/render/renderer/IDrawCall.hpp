@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <memory>
+#include "core/FrameArena.hpp"
 #include "render/renderer/IMesh.hpp"
 #include "render/renderer/IProgram.hpp"
 #include "render/renderer/IRenderHardware.hpp"
@@ -10,32 +12,82 @@
 namespace zero::render
 {
     /**
-     * @brief A key used to map render specific data to a IDrawCall to aid in IDrawCall sorting.
+     * @brief The layers of a render pass, drawn in increasing order
+     */
+    enum class DrawLayer : uint8
+    {
+        BACKGROUND = 0,     ///< Drawn before anything else, e.g. the sky dome
+        WORLD = 1,          ///< Entities in the world
+    }; // enum class DrawLayer
+
+    /**
+     * @brief Packs the render state of a draw call into a 64-bit key. Draw calls are executed in increasing key order.
+     *
+     * Bits from the most to the least significant:
+     * - Opaque draws: layer (4), translucency (1), shader (14), texture (14), mesh (15), front to back depth (16)
+     * - Translucent draws: layer (4), translucency (1), back to front depth (16), shader (14), texture (14), mesh (15)
+     *
+     * Opaque draws are grouped by state to minimize state changes, while translucent draws must be blended in depth order.
+     * Shader, texture, and mesh identifiers are the slot indices of their RenderResources handles, without the
+     * generation. Indices are truncated to their bits, so resources only share a group past 2^14 programs or textures
+     * and 2^15 meshes.
      */
     struct DrawKey
     {
-        DrawKey()
-        : mesh_id_(0)
-        , material_id_(0)
-        , texture_id_(0)
-        {
-        }
+        DrawKey() = delete;
 
         /**
-         * @brief Unique mesh value that uniquely identifies a mesh.
-         * Sort based on mesh ID to minimize vertex state changes.
-         */
-        uint32 mesh_id_;
-        /**
-         * @brief Unique material value that identifies the shaders, and constants (e.g. uniforms).
-         * Sort based on material ID to minimize state changes.
-         */
-        uint32 material_id_;
-        /**
-         * @brief Unique value that identifies the textures
-         * Sort based on Texture ID to minimize
+         * @brief Create a draw key
+         * @param layer the layer of the draw
+         * @param is_translucent is the draw blended with the draws behind it?
+         * @param shader_id the slot index of the shader program
+         * @param texture_id the slot index of the textures
+         * @param mesh_id the slot index of the mesh
+         * @param normalized_depth the view depth divided by the far clip distance. Clamped to [0, 1].
+         * @return the draw key
          */
-        uint32 texture_id_;
+        [[nodiscard]] static uint64 Create(DrawLayer layer,
+                                           bool is_translucent,
+                                           uint32 shader_id,
+                                           uint32 texture_id,
+                                           uint32 mesh_id,
+                                           float normalized_depth)
+        {
+            const float clamped_depth = std::min(std::max(normalized_depth, 0.0F), 1.0F);
+            auto depth = static_cast<uint64>(clamped_depth * static_cast<float>(GetMask(kDepthBits)));
+            const uint64 state = (static_cast<uint64>(shader_id & GetMask(kShaderBits)) << (kTextureBits + kMeshBits))
+                               | (static_cast<uint64>(texture_id & GetMask(kTextureBits)) << kMeshBits)
+                               | static_cast<uint64>(mesh_id & GetMask(kMeshBits));
+
+            uint64 key = (static_cast<uint64>(layer) & GetMask(kLayerBits)) << (kTranslucentShift + 1);
+            if (is_translucent)
+            {
+                // Farthest first
+                depth = GetMask(kDepthBits) - depth;
+                key |= (uint64{1} << kTranslucentShift) | (depth << kStateBits) | state;
+            }
+            else
+            {
+                key |= (state << kDepthBits) | depth;
+            }
+            return key;
+        }
+
+        static constexpr uint32 kLayerBits = 4;
+        static constexpr uint32 kShaderBits = 14;
+        static constexpr uint32 kTextureBits = 14;
+        static constexpr uint32 kMeshBits = 15;
+        static constexpr uint32 kDepthBits = 16;
+
+    private:
+        static constexpr uint32 kStateBits = kShaderBits + kTextureBits + kMeshBits;
+        static constexpr uint32 kTranslucentShift = kStateBits + kDepthBits;
+        static_assert(kTranslucentShift + 1 + kLayerBits == 64, "The draw key must use all 64 bits");
+
+        static constexpr uint64 GetMask(uint32 bit_count)
+        {
+            return (uint64{1} << bit_count) - 1;
+        }
     }; // struct DrawKey
 
     /**
@@ -48,10 +100,10 @@ namespace zero::render
         virtual ~IDrawCall() = default;
 
         /**
-         * @brief Retrieve the draw key associated with the draw call
-         * @return the draw key
+         * @brief Retrieve the key the draw call is sorted by, see DrawKey
+         * @return the sort key
          */
-        virtual const DrawKey& GetDrawKey() = 0;
+        [[nodiscard]] virtual uint64 GetSortKey() const = 0;
         /**
          * @brief Execute the draw call
          * @param rhi the interface to the render hardware used to render
@@ -59,4 +111,9 @@ namespace zero::render
         virtual void Draw(IRenderHardware* rhi) = 0;
     }; // class IDrawCall
 
+    /**
+     * @brief Draw calls are transient and constructed in the per-frame arena
+     */
+    using DrawCallPtr = ArenaPtr<IDrawCall>;
+
 } // namespace zero::render
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "core/NonCopyable.hpp"
+#include "core/ZeroBase.hpp"
 
 namespace zero::render
 {
@@ -9,5 +10,27 @@ namespace zero::render
     public:
         IMesh() = default;
         virtual ~IMesh() = default;
+
+        /**
+         * @brief Get the number of indices of the mesh
+         * @return the index count
+         */
+        [[nodiscard]] virtual uint32 GetIndexCount() const = 0;
+
+        /**
+         * @brief Get the location of the mesh in the buffers storing it. Added to the indices and vertices of its draws.
+         * @return the first index or the base vertex
+         */
+        ///@{
+        [[nodiscard]] virtual uint32 GetFirstIndex() const = 0;
+        [[nodiscard]] virtual uint32 GetBaseVertex() const = 0;
+        ///@}
+
+        /**
+         * @brief Get the identifier of the vertex and index buffers storing the mesh.
+         * Meshes with the same identifier can be drawn by the same multi draw.
+         * @return the geometry identifier
+         */
+        [[nodiscard]] virtual uint32 GetGeometryIdentifier() const = 0;
     }; // interface IMesh
 } // namespace zero::render
\ No newline at end of file
@@ -4,12 +4,16 @@
 #include "render/Image.hpp"
 #include "render/MeshData.hpp"
 #include "render/renderer/ShaderStage.hpp"
+#include "render/renderer/DrawIndirectCommand.hpp"
+#include "render/renderer/GeometryArena.hpp"
 #include "render/renderer/IFrameBuffer.hpp"
 #include "render/renderer/IMesh.hpp"
 #include "render/renderer/IProgram.hpp"
 #include "render/renderer/ITexture.hpp"
 #include "render/renderer/ISampler.hpp"
+#include "render/renderer/IStorageBuffer.hpp"
 #include "render/renderer/IUniformBuffer.hpp"
+#include "render/renderer/UniformRange.hpp"
 
 namespace zero::render
 {
@@ -47,22 +51,108 @@ namespace zero::render
         virtual const std::vector<std::shared_ptr<ITexture>>& GetShadowMapTextures() = 0;
         virtual const std::vector<std::shared_ptr<IFrameBuffer>>& GetShadowMapFrameBuffers() = 0;
 
-        virtual void UpdateUniformData(std::shared_ptr<IUniformBuffer> uniform_buffer, const void* data, uint32 data_size, uint32 data_offset) = 0;
+        virtual void UpdateUniformData(const std::shared_ptr<IUniformBuffer>& uniform_buffer, const void* data, uint32 data_size, uint32 data_offset) = 0;
+        virtual void UpdateStorageData(const std::shared_ptr<IStorageBuffer>& storage_buffer, const void* data, uint32 data_size, uint32 data_offset) = 0;
+        /**
+         * @brief Replace the draw commands read by MultiDrawMeshIndirect
+         * @param draw_commands the draw commands
+         * @param draw_command_count the number of draw commands
+         */
+        virtual void UpdateDrawCommands(const DrawIndirectCommand* draw_commands, uint32 draw_command_count) = 0;
+
+        /**
+         * @brief Start writing the uniform and storage data of a frame into the next regions of the uniform and
+         * storage rings. Waits until the GPU has finished reading the previous frame that used the regions.
+         */
+        virtual void BeginUniformFrame() = 0;
+        /**
+         * @brief End the uniform and storage data of a frame. The regions are reused once the GPU has finished the
+         * commands issued so far.
+         *
+         * Ring data is visible to the commands issued after it is written, so this is called after the frame is drawn.
+         */
+        virtual void EndUniformFrame() = 0;
+        /**
+         * @brief Copy the data of a uniform block into the uniform ring
+         * @param data the data
+         * @param data_size the size of the data
+         * @param block_size the size of the uniform block the data is bound to. At least the data size.
+         * @return the range of the uniform ring holding the data
+         */
+        virtual UniformRange WriteUniformData(const void* data, uint32 data_size, uint32 block_size) = 0;
+        /**
+         * @brief Copy the data of a storage block into the storage ring. Every write gets its own range, so the data
+         * of earlier draws in the frame is never overwritten.
+         * @param data the data
+         * @param data_size the size of the data
+         * @return the range of the storage ring holding the data
+         */
+        virtual UniformRange WriteStorageData(const void* data, uint32 data_size) = 0;
 
         virtual std::shared_ptr<IMesh> CreateMesh(MeshData* mesh_data) = 0;
         virtual std::shared_ptr<IShader> CreateShader(const ShaderStage& shader_stage) = 0;
         virtual std::shared_ptr<IProgram> CreateShaderProgram(const std::vector<std::shared_ptr<IShader>>& shaders) = 0;
         virtual std::shared_ptr<ITexture> CreateTexture(std::unique_ptr<Image> image) = 0;
         virtual std::shared_ptr<IUniformBuffer> CreateUniformBuffer(std::string buffer_name, const void* initial_data, uint32 buffer_size) = 0;
+        virtual std::shared_ptr<IStorageBuffer> CreateStorageBuffer(std::string buffer_name, const void* initial_data, uint32 buffer_size) = 0;
 
-        virtual void BeginFrame(std::shared_ptr<IFrameBuffer> frame_buffer) = 0;
+        virtual void BeginFrame(const std::shared_ptr<IFrameBuffer>& frame_buffer) = 0;
         virtual void EndFrame() = 0;
 
-        virtual void BindShaderProgram(std::shared_ptr<IProgram> shader_program) = 0;
-        virtual void BindTexture(std::shared_ptr<ITexture> texture, std::shared_ptr<ISampler> texture_sampler, const std::string& uniform_name) = 0;
-        virtual void BindUniformBuffer(std::shared_ptr<IUniformBuffer> uniform_buffer) = 0;
-
-        virtual void DrawMesh(std::shared_ptr<IMesh> mesh) = 0;
+        virtual void BindShaderProgram(const std::shared_ptr<IProgram>& shader_program) = 0;
+        /**
+         * @brief Bind a texture to a sampler of the bound shader program
+         * @param texture the texture. An empty texture is bound if null.
+         * @param texture_sampler the texture sampler
+         * @param uniform_name_identifier the name of the sampler uniform, interned by the ShaderNameTable
+         */
+        virtual void BindTexture(const std::shared_ptr<ITexture>& texture, const std::shared_ptr<ISampler>& texture_sampler, uint32 uniform_name_identifier) = 0;
+        virtual void BindUniformBuffer(const std::shared_ptr<IUniformBuffer>& uniform_buffer) = 0;
+        virtual void BindStorageBuffer(const std::shared_ptr<IStorageBuffer>& storage_buffer) = 0;
+        /**
+         * @brief Bind a range of the uniform ring to a uniform block of the bound shader program
+         * @param block_name_identifier the name of the uniform block, interned by the ShaderNameTable
+         * @param uniform_range the range written by WriteUniformData in the current frame
+         */
+        virtual void BindUniformRange(uint32 block_name_identifier, const UniformRange& uniform_range) = 0;
+        /**
+         * @brief Bind a range of the storage ring to a storage block of the bound shader program
+         * @param block_name_identifier the name of the storage block, interned by the ShaderNameTable
+         * @param storage_range the range written by WriteStorageData in the current frame
+         */
+        virtual void BindStorageRange(uint32 block_name_identifier, const UniformRange& storage_range) = 0;
+
+        virtual void DrawMesh(const std::shared_ptr<IMesh>& mesh) = 0;
+        /**
+         * @brief Draw several instances of a mesh. Shaders identify the instance by the base instance plus the instance ID.
+         * @param mesh the mesh to draw
+         * @param instance_count the number of instances
+         * @param first_instance the base instance
+         */
+        virtual void DrawMeshInstanced(const std::shared_ptr<IMesh>& mesh, uint32 instance_count, uint32 first_instance) = 0;
+        /**
+         * @brief Execute a range of the draw commands with a single call
+         * @param mesh a mesh sharing its geometry buffers with the meshes of every command in the range
+         * @param first_command the index of the first draw command
+         * @param command_count the number of draw commands
+         */
+        virtual void MultiDrawMeshIndirect(const std::shared_ptr<IMesh>& mesh, uint32 first_command, uint32 command_count) = 0;
+
+        /**
+         * @brief Get the number of state changes skipped because the state was already set, since the last reset
+         * @return the filtered state change count
+         */
+        [[nodiscard]] virtual uint32 GetFilteredStateChangeCount() const = 0;
+        /**
+         * @brief Reset the filtered state change count. The render system resets it after every frame.
+         */
+        virtual void ResetFilteredStateChangeCount() = 0;
+
+        /**
+         * @brief Get the usage and fragmentation of the geometry buffers shared by the meshes
+         * @return the geometry statistics. Empty if the meshes do not share geometry buffers.
+         */
+        [[nodiscard]] virtual GeometryArena::Statistics GetGeometryStatistics() const = 0;
 
     }; // class IRenderHardware
 
@@ -1,8 +1,13 @@
 #pragma once
 
+#include "core/ThreadPool.hpp"
 #include "render/IRenderView.hpp"
+#include "render/renderer/CommandBuffer.hpp"
+#include "render/renderer/DrawPacket.hpp"
 #include "render/renderer/IDrawCall.hpp"
 #include "render/renderer/IRenderHardware.hpp"
+#include "render/renderer/RenderResources.hpp"
+#include "render/renderer/UniformManager.hpp"
 
 namespace zero::render
 {
@@ -15,27 +20,42 @@ namespace zero::render
         /**
          * @brief Setup the render pass for the first time
          * @param rhi the render hardware interface to use for the creation of any rendering resources
-         * @param camera_uniform the camera uniform buffer to use during rendering
+         * @param uniform_manager the uniform buffers to use during rendering
+         * @param render_resources the resources referred to by the submitted draw packets
          */
-        virtual void Initialize(IRenderHardware* rhi, std::shared_ptr<IUniformBuffer> camera_uniform) = 0;
+        virtual void Initialize(IRenderHardware* rhi,
+                                std::shared_ptr<UniformManager> uniform_manager,
+                                std::shared_ptr<const RenderResources> render_resources) = 0;
+
+        /**
+         * @brief Submit a new draw packet for sorting and execution
+         * @param draw_packet the draw packet
+         * @param sort_key the key the draw packet is sorted by, see DrawKey
+         */
+        virtual void Submit(const DrawPacket& draw_packet, uint64 sort_key) = 0;
 
         /**
          * @brief Submit a new draw call for sorting and execution
          * @param draw_call the new draw call to manage
          */
-        virtual void Submit(std::unique_ptr<IDrawCall> draw_call) = 0;
+        virtual void Submit(DrawCallPtr draw_call) = 0;
 
         /**
          * @brief Sort the draw calls
+         * @param thread_pool the thread pool to sort large sets of draw calls on
          */
-        virtual void Sort() = 0;
+        virtual void Sort(ThreadPool& thread_pool) = 0;
 
         /**
-         * @brief Execute the draw calls
+         * @brief Record the commands that execute the draw calls
+         *
+         * Render passes are recorded concurrently. Recording must not call the render hardware or modify state
+         * shared with other render passes.
+         *
          * @param render_view the render view associated with this render
-         * @param rhi the render hardware interface to use for rendering
+         * @param command_buffer the command buffer to record into. Submitted after all render passes are recorded.
          */
-        virtual void Render(IRenderView* render_view, IRenderHardware* rhi) = 0;
+        virtual void Record(IRenderView* render_view, CommandBuffer& command_buffer) = 0;
 
         /**
          * @brief Clear the draw calls
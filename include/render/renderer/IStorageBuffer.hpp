@@ -0,0 +1,22 @@
+#pragma once
+
+#include <string>
+#include "core/NonCopyable.hpp"
+#include "core/ZeroBase.hpp"
+
+namespace zero::render
+{
+
+    /**
+     * @brief A shader storage buffer. Unlike uniform buffers, storage buffers may hold arrays of unbounded size.
+     */
+    class IStorageBuffer : public NonCopyable
+    {
+    public:
+        IStorageBuffer() = default;
+        virtual ~IStorageBuffer() = default;
+        virtual uint32 GetSize() = 0;
+        virtual const std::string& GetName() = 0;
+    }; // class IStorageBuffer
+
+} // namespace zero::render
\ No newline at end of file
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "core/NonCopyable.hpp"
+#include "core/ZeroBase.hpp"
+#include "render/renderer/CommandBuffer.hpp"
+#include "render/renderer/DrawCallQueue.hpp"
+#include "render/renderer/DrawIndirectCommand.hpp"
+#include "render/renderer/InstanceBuffer.hpp"
+#include "render/renderer/RenderResources.hpp"
+
+namespace zero::render
+{
+
+    /**
+     * @brief The multi draws of a render pass
+     *
+     * Every instanced batch of a sorted draw call queue becomes a draw command. Consecutive batches with the same
+     * program, textures, and render state whose meshes share geometry buffers form a run that is drawn with a single
+     * multi draw, so the number of draw API calls follows the number of state changes instead of the number of draws.
+     * The draw commands of the pass are uploaded at once. Draw calls are kept in their sorted position between runs.
+     */
+    class IndirectDrawList : public NonCopyable
+    {
+    public:
+        /**
+         * @brief A multi draw of consecutive draw commands, or a draw call
+         */
+        struct DrawRun
+        {
+            /**
+             * @brief The first draw packet of the run. Null for a draw call.
+             */
+            const DrawPacket* draw_packet_;
+            /**
+             * @brief The draw call. Null for a multi draw.
+             */
+            IDrawCall* draw_call_;
+            uint32 geometry_identifier_;
+            uint32 window_index_;
+            uint32 first_command_;
+            uint32 command_count_;
+        }; // struct DrawRun
+
+        IndirectDrawList();
+        ~IndirectDrawList() = default;
+
+        /**
+         * @brief Build the draw commands and runs of a sorted draw call queue
+         * @param draw_call_queue the sorted draw call queue
+         * @param render_resources the resources referred to by the draw packets
+         */
+        void Build(const DrawCallQueue& draw_call_queue, const RenderResources& render_resources);
+
+        /**
+         * @brief Record the runs in order. The draw list must not be rebuilt until the command buffer is submitted.
+         * @param command_buffer the command buffer to record into
+         * @param draw_run_function callable with the signature
+         * void(const DrawPacket& draw_packet, uint32 first_command, uint32 command_count) that records the binds of the
+         * state of the first draw packet of a run and its multi draw
+         */
+        template<typename DrawRunFunction>
+        void Record(CommandBuffer& command_buffer, const DrawRunFunction& draw_run_function)
+        {
+            if (!draw_commands_.empty())
+            {
+                command_buffer.UpdateDrawCommands(draw_commands_.data(), static_cast<uint32>(draw_commands_.size()));
+            }
+
+            for (const DrawRun& draw_run : draw_runs_)
+            {
+                if (draw_run.draw_call_)
+                {
+                    command_buffer.ExecuteDrawCall(draw_run.draw_call_);
+                    continue;
+                }
+                instance_buffer_.Upload(command_buffer, draw_run.window_index_);
+                draw_run_function(*draw_run.draw_packet_, draw_run.first_command_, draw_run.command_count_);
+            }
+        }
+
+        /**
+         * @brief Get the draw commands of the pass
+         * @return the draw commands in draw order
+         */
+        [[nodiscard]] const std::vector<DrawIndirectCommand>& GetDrawCommands() const;
+
+        /**
+         * @brief Get the runs of the pass
+         * @return the runs in draw order
+         */
+        [[nodiscard]] const std::vector<DrawRun>& GetDrawRuns() const;
+
+        /**
+         * @brief Can two draw packets be drawn by the same multi draw, given their meshes share geometry buffers?
+         * @return true if they share the program, textures, and render state. Otherwise, false.
+         */
+        [[nodiscard]] static bool CanMultiDraw(const DrawPacket& lhs, const DrawPacket& rhs);
+
+    private:
+        InstanceBuffer instance_buffer_;
+        std::vector<DrawIndirectCommand> draw_commands_;
+        std::vector<DrawRun> draw_runs_;
+
+    }; // class IndirectDrawList
+
+} // namespace zero::render
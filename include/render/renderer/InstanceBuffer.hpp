@@ -0,0 +1,98 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "core/NonCopyable.hpp"
+#include "core/ZeroBase.hpp"
+#include "render/renderer/CommandBuffer.hpp"
+#include "render/renderer/DrawCallQueue.hpp"
+#include "render/renderer/RenderResources.hpp"
+#include "render/renderer/UniformBufferData.hpp"
+
+namespace zero::render
+{
+
+    /**
+     * @brief The instance data of the draw packets of a render pass
+     *
+     * The instances are stored in the sorted order of the draw packets, so every batch of a draw call queue is a
+     * contiguous range. A window of at most Constants::kMaxInstanceCount instances is bound at once. Ranges are placed
+     * in windows in draw order, and a new window is only started when a range does not fit in the current one.
+     * Every window is written to its own range of the storage ring, so the windows of other passes in the frame are
+     * never overwritten.
+     */
+    class InstanceBuffer : public NonCopyable
+    {
+    public:
+        /**
+         * @brief The location of a range of instances in the storage buffer
+         */
+        struct Placement
+        {
+            uint32 window_index_;
+            /**
+             * @brief The base instance of the first instance of the range in the window
+             */
+            uint32 base_instance_;
+        }; // struct Placement
+
+        InstanceBuffer();
+        ~InstanceBuffer() = default;
+
+        /**
+         * @brief Gather the instance data of the sorted draw packets of a draw call queue
+         * @param draw_call_queue the sorted draw call queue
+         * @param render_resources the resources holding the uniform data of the draw packets
+         */
+        void Build(const DrawCallQueue& draw_call_queue, const RenderResources& render_resources);
+
+        /**
+         * @brief Place a range of instances in a window. Ranges must be placed in increasing order.
+         * @param first_instance the first instance of the range
+         * @param instance_count the number of instances in the range. At most Constants::kMaxInstanceCount.
+         * @return the placement of the range
+         */
+        Placement Place(uint32 first_instance, uint32 instance_count);
+
+        /**
+         * @brief Record the write of a window to the storage ring, unless it is the window written last.
+         * The instances must not be rebuilt until the command buffer is submitted.
+         * @param command_buffer the command buffer to record into
+         * @param window_index the index of the window
+         */
+        void Upload(CommandBuffer& command_buffer, uint32 window_index);
+
+        /**
+         * @brief Get the number of instances
+         * @return the instance count
+         */
+        [[nodiscard]] uint32 GetInstanceCount() const;
+
+        /**
+         * @brief Get the number of windows the instances were placed in
+         * @return the window count
+         */
+        [[nodiscard]] uint32 GetWindowCount() const;
+
+    private:
+        /**
+         * @brief A range of instances written to the storage ring at once
+         */
+        struct Window
+        {
+            uint32 begin_;
+            uint32 end_;
+        }; // struct Window
+
+        /**
+         * @brief The window index before any window has been written
+         */
+        static constexpr uint32 kNoWindow = 0xFFFFFFFFU;
+
+        std::vector<InstanceData> instances_;
+        std::vector<Window> windows_;
+        uint32 uploaded_window_index_;
+
+    }; // class InstanceBuffer
+
+} // namespace zero::render
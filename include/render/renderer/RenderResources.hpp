@@ -0,0 +1,141 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "core/NonCopyable.hpp"
+#include "core/ZeroBase.hpp"
+#include "render/renderer/IMesh.hpp"
+#include "render/renderer/IProgram.hpp"
+#include "render/renderer/ITexture.hpp"
+#include "render/renderer/UniformBufferData.hpp"
+
+namespace zero::render
+{
+
+    /**
+     * @brief The GPU resources referred to by draw packets, and the uniform data of the draws in the current frame
+     *
+     * Resources are addressed by generational handles into dense tables, so draw packets hold plain integers instead
+     * of shared pointers. A handle packs the slot index of the resource with the generation of the slot. Removing a
+     * resource frees its slot for reuse and advances the generation, so stale handles never alias a newer resource.
+     * Looking up a stale handle asserts in debug builds and returns null otherwise.
+     * The frame data is cleared at the end of every frame and keeps its storage for the next one.
+     */
+    class RenderResources : public NonCopyable
+    {
+    public:
+        /**
+         * @brief The handle of a missing resource. Never returned for an added resource.
+         */
+        static constexpr uint32 kInvalidHandle = 0;
+
+        RenderResources();
+        ~RenderResources() = default;
+
+        /**
+         * @brief Add a resource
+         * @param resource the resource. May be null.
+         * @return the handle of the resource
+         */
+        ///@{
+        uint32 AddMesh(std::shared_ptr<IMesh> mesh);
+        uint32 AddProgram(std::shared_ptr<IProgram> program);
+        uint32 AddTexture(std::shared_ptr<ITexture> texture);
+        ///@}
+
+        /**
+         * @brief Release a resource and invalidate its handle. Removing kInvalidHandle does nothing.
+         * @param handle the handle of the resource
+         */
+        ///@{
+        void RemoveMesh(uint32 handle);
+        void RemoveProgram(uint32 handle);
+        void RemoveTexture(uint32 handle);
+        ///@}
+
+        /**
+         * @brief Get a resource
+         * @param handle the handle of the resource
+         * @return the resource. Null if the handle is invalid or stale.
+         */
+        ///@{
+        [[nodiscard]] const std::shared_ptr<IMesh>& GetMesh(uint32 handle) const;
+        [[nodiscard]] const std::shared_ptr<IProgram>& GetProgram(uint32 handle) const;
+        [[nodiscard]] const std::shared_ptr<ITexture>& GetTexture(uint32 handle) const;
+        ///@}
+
+        /**
+         * @brief Get the slot index of a handle, without its generation
+         *
+         * Live resources of the same type never share a slot index, so the index identifies a resource in fewer bits
+         * than its handle (e.g. in a draw key).
+         *
+         * @param handle the handle of a resource
+         * @return the slot index. kInvalidHandle has the slot index 0.
+         */
+        [[nodiscard]] static uint32 GetSlotIndex(uint32 handle);
+
+        /**
+         * @brief Add the uniform data of a draw in the current frame
+         * @return the index of the data
+         */
+        ///@{
+        uint32 AddModelData(const ModelData& model_data);
+        uint32 AddMaterialData(const MaterialData& material_data);
+        ///@}
+
+        /**
+         * @brief Get the uniform data of a draw in the current frame
+         * @param index the index of the data
+         * @return the data
+         */
+        ///@{
+        [[nodiscard]] const ModelData& GetModelData(uint32 index) const;
+        [[nodiscard]] const MaterialData& GetMaterialData(uint32 index) const;
+        ///@}
+
+        /**
+         * @brief Clear the uniform data of the current frame
+         */
+        void ClearFrameData();
+
+        /**
+         * @brief Release every resource and invalidate their handles
+         */
+        void Clear();
+
+    private:
+        /**
+         * @brief Resources indexed by the slot index of their handle. The first slot holds the null resource of
+         * kInvalidHandle and is never freed.
+         */
+        template<typename T>
+        struct ResourceTable
+        {
+            std::vector<std::shared_ptr<T>> resources_;
+            std::vector<uint32> generations_;
+            std::vector<uint32> free_indices_;
+        }; // struct ResourceTable
+
+        template<typename T>
+        static uint32 AddResource(ResourceTable<T>& table, std::shared_ptr<T> resource);
+
+        template<typename T>
+        static void RemoveResource(ResourceTable<T>& table, uint32 handle);
+
+        template<typename T>
+        static const std::shared_ptr<T>& GetResource(const ResourceTable<T>& table, uint32 handle);
+
+        template<typename T>
+        static void ClearResources(ResourceTable<T>& table);
+
+        ResourceTable<IMesh> meshes_;
+        ResourceTable<IProgram> programs_;
+        ResourceTable<ITexture> textures_;
+
+        std::vector<ModelData> model_data_;
+        std::vector<MaterialData> material_data_;
+
+    }; // class RenderResources
+
+} // namespace zero::render
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+#include "render/renderer/IRenderHardware.hpp"
+
+namespace zero::render
+{
+
+    /**
+     * @brief A shadow copy of the render state last set on the render hardware
+     *
+     * Each Set method records the new state and returns whether it differs from the recorded one, so the render
+     * hardware can skip calls that would not change anything. The skipped calls are counted.
+     * Identifiers are the ones of the render hardware; state that was never set, or was invalidated, is unknown and
+     * never filtered.
+     */
+    class RenderStateCache
+    {
+    public:
+        /**
+         * @brief A buffer range bound to a binding point. A size of zero binds the whole buffer.
+         */
+        struct BufferBinding
+        {
+            uint32 buffer_;
+            uint32 offset_;
+            uint32 size_;
+
+            bool operator==(const BufferBinding& other) const;
+        }; // struct BufferBinding
+
+        RenderStateCache();
+        ~RenderStateCache() = default;
+
+        /**
+         * @brief Forget all recorded state
+         */
+        void Invalidate();
+
+        /**
+         * @brief Record the state. Each returns true if the state changed and the call must be issued.
+         */
+        ///@{
+        bool SetProgram(uint32 program);
+        bool SetCullMode(IRenderHardware::CullMode cull_mode);
+        bool SetFillMode(IRenderHardware::FillMode fill_mode);
+        bool SetVertexBuffer(uint32 vertex_buffer);
+        bool SetUniformBuffer(uint32 binding_point, const BufferBinding& buffer_binding);
+        bool SetStorageBuffer(uint32 binding_point, const BufferBinding& buffer_binding);
+        bool SetTexture(uint32 texture_unit, uint32 texture);
+        bool SetSampler(uint32 texture_unit, uint32 sampler);
+        ///@}
+
+        /**
+         * @brief Get the number of filtered calls since the last reset
+         * @return the filtered call count
+         */
+        [[nodiscard]] uint32 GetFilteredCount() const;
+
+        /**
+         * @brief Reset the filtered call count
+         */
+        void ResetFilteredCount();
+
+    private:
+        /**
+         * @brief Record a value in the slot of a per-slot state
+         * @return true if the value changed
+         */
+        template<typename T>
+        bool SetSlot(std::vector<std::optional<T>>& slots, uint32 slot, const T& value);
+
+        std::optional<uint32> program_;
+        std::optional<IRenderHardware::CullMode> cull_mode_;
+        std::optional<IRenderHardware::FillMode> fill_mode_;
+        std::optional<uint32> vertex_buffer_;
+        std::vector<std::optional<BufferBinding>> uniform_buffers_;
+        std::vector<std::optional<BufferBinding>> storage_buffers_;
+        std::vector<std::optional<uint32>> textures_;
+        std::vector<std::optional<uint32>> samplers_;
+        uint32 filtered_count_;
+
+    }; // class RenderStateCache
+
+} // namespace zero::render
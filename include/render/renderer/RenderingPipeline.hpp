@@ -2,14 +2,19 @@
 
 #include <functional>
 #include <memory>
+#include <unordered_set>
 #include <vector>
+#include "core/FrameArena.hpp"
 #include "core/NonCopyable.hpp"
+#include "core/ThreadPool.hpp"
 #include "core/AssetManager.hpp"
 #include "component/Material.hpp"
 #include "component/Mesh.hpp"
 #include "component/PrimitiveInstance.hpp"
 #include "render/IRenderView.hpp"
+#include "render/renderer/CommandBuffer.hpp"
 #include "render/renderer/IRenderPass.hpp"
+#include "render/renderer/RenderResources.hpp"
 #include "render/renderer/UniformManager.hpp"
 
 namespace zero::render
@@ -20,25 +25,42 @@ namespace zero::render
     class RenderingPipeline : public NonCopyable
     {
     public:
-        RenderingPipeline();
+        /**
+         * @brief Constructor
+         * @param frames_in_flight the number of frames that may be processed concurrently.
+         * Transient frame data is buffered accordingly.
+         * @param worker_count the number of worker threads that sort large render passes and record the render passes
+         * together with the calling thread
+         */
+        RenderingPipeline(uint32 frames_in_flight, uint32 worker_count);
         ~RenderingPipeline() = default;
 
         uint32 LoadMesh(IRenderHardware* rhi, MeshData* mesh_data);
         void Initialize(IRenderHardware* rhi, AssetManager& asset_manager);
         void Shutdown();
 
+        /**
+         * @brief Get the mesh of a primitive instance. Boxes share a cached mesh, other primitives are given their own.
+         * @param rhi the render hardware interface
+         * @param primitive_instance the primitive
+         * @return the handle of the mesh. Released with ReleasePrimitiveMesh once the instance is destroyed.
+         */
         uint32 GetPrimitiveMeshId(IRenderHardware* rhi, PrimitiveInstance primitive_instance);
+        /**
+         * @brief Remove the mesh of a destroyed primitive instance. Shared meshes are left in place.
+         * @param mesh_id the handle returned by GetPrimitiveMeshId, or the handle of any other mesh
+         */
+        void ReleasePrimitiveMesh(uint32 mesh_id);
         void GenerateSkyDomeDrawCall(IRenderHardware* rhi, const Camera& camera, const SkyDome& sky_dome);
-        void GenerateDrawCall(IRenderHardware* rhi,
-                              const Mesh& mesh,
-                              const Material& material,
-                              math::Matrix4x4 model_matrix,
-                              math::Matrix4x4 view_matrix);
-        void GenerateShadowDrawCall(IRenderHardware* rhi,
-                                    uint32 cascade_index,
-                                    const Mesh& mesh,
-                                    const Material& material,
-                                    math::Matrix4x4 model_matrix);
+        /**
+         * @brief Generate the draw call of a renderable entity
+         * @param rhi the render hardware interface
+         * @param draw_item the entity to draw
+         * @param view_matrix the view matrix of the camera
+         * @param far_clip the far clip distance of the camera. Normalizes the depth the draw call is sorted by.
+         */
+        void GenerateDrawCall(IRenderHardware* rhi, const DrawItem& draw_item, const math::Matrix4x4& view_matrix, float far_clip);
+        void GenerateShadowDrawCall(IRenderHardware* rhi, uint32 cascade_index, const ShadowDrawItem& shadow_draw_item);
 
         /**
          * @brief Sort the render passes
@@ -46,13 +68,14 @@ namespace zero::render
         void Sort();
 
         /**
-         * @brief Render the render calls
+         * @brief Render the render calls. The render passes are recorded concurrently and submitted in order.
+         * Must be called by the thread that owns the graphics context.
          * @param rhi the render hardware interface to use for rendering
          */
         void Render(IRenderView* render_view, IRenderHardware* rhi);
 
         /**
-         * @brief Clear the rendering pipeline of all render calls
+         * @brief Clear the rendering pipeline of all render calls and release the frame's transient allocations
          */
         void ClearRenderCalls();
 
@@ -60,10 +83,16 @@ namespace zero::render
         void UpdateLightUniforms(IRenderView* render_view, IRenderHardware* rhi);
         void UpdateShadowMapUniform(IRenderView* render_view, IRenderHardware* rhi);
         void LoadPrimitiveMeshes(IRenderHardware* rhi);
+        uint32 LoadPrimitiveInstanceMesh(IRenderHardware* rhi, MeshData* mesh_data);
         void LoadTextures(IRenderHardware* rhi, AssetManager& asset_manager);
         void LoadShaders(IRenderHardware* rhi, AssetManager& asset_manager);
-        std::shared_ptr<IProgram> GenerateShaderProgram(IRenderHardware* rhi, uint32 shader_id, const std::vector<std::string>& shader_name_list);
-        [[nodiscard]] uint32 GenerateNewUniqueIdentifier();
+        /**
+         * @return the handle of the shader program. RenderResources::kInvalidHandle if it could not be generated.
+         */
+        ///@{
+        uint32 GetShaderProgram(IRenderHardware* rhi, const Material& material);
+        uint32 GenerateShaderProgram(IRenderHardware* rhi, uint32 shader_id, const std::vector<std::string>& shader_name_list);
+        ///@}
         static void ReadShaderSource(const std::string& filename, std::string& destination);
 
         /**
@@ -72,24 +101,38 @@ namespace zero::render
         static const char* kTitle;
 
         /**
-         * @brief GPU Resource Cache
+         * @brief GPU Resource Cache. Meshes are identified by their handle in the render resources.
          */
-        std::unordered_map<uint32, std::shared_ptr<IMesh>> mesh_cache_;
-        std::unordered_map<uint32, std::shared_ptr<IProgram>> program_cache_;
+        std::shared_ptr<RenderResources> render_resources_;
+        std::unordered_map<uint32, uint32> program_handle_cache_;
         std::unordered_map<std::string, std::shared_ptr<IShader>> shader_cache_;
-        std::unordered_map<std::string, std::shared_ptr<ITexture>> texture_cache_;
-        uint32 unique_identifier_;
+        std::unordered_map<std::string, uint32> texture_handle_cache_;
         std::array<uint32, 6> primitive_mesh_id_cache_;
+        /**
+         * @brief The meshes generated for a single primitive instance
+         */
+        std::unordered_set<uint32> primitive_instance_mesh_ids_;
 
         /**
          * @brief Active render passes, which maintain their own set of draw calls
          */
         std::vector<std::unique_ptr<IRenderPass>> render_passes_;
+        /**
+         * @brief The command buffer of each render pass
+         */
+        std::vector<std::unique_ptr<CommandBuffer>> command_buffers_;
         const uint32 entity_render_pass_index_;
         Material shadow_map_material_{};
         std::shared_ptr<ITexture> empty_texture_;
         std::shared_ptr<UniformManager> uniform_manager_;
 
+        /**
+         * @brief Transient per-frame allocations (e.g. special draw calls, light data). Reset at the end of each frame.
+         */
+        FrameArena frame_arena_;
+
+        ThreadPool worker_thread_pool_;
+
     }; // class RenderingPipeline
 
 } // namespace zero::render
\ No newline at end of file
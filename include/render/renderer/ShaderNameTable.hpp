@@ -0,0 +1,54 @@
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "core/ZeroBase.hpp"
+
+namespace zero::render
+{
+
+    /**
+     * @brief Interns the names of shader resources (uniforms, samplers and blocks).
+     *
+     * Every name maps to a process-wide identifier, so programs look up their resources by integer instead of
+     * by string. Names are interned when programs are reflected and when the renderer is initialized, never per draw.
+     */
+    class ShaderNameTable
+    {
+    public:
+        /**
+         * @brief Get the table shared by all programs
+         * @return the shader name table
+         */
+        static ShaderNameTable& GetTable();
+
+        /**
+         * @brief Get the identifier of a name, adding the name if it is new
+         * @param name the shader resource name
+         * @return the identifier
+         */
+        uint32 Intern(const std::string& name);
+
+        /**
+         * @brief Get the name of an identifier
+         * @param identifier an interned identifier
+         * @return the name
+         */
+        const std::string& GetName(uint32 identifier);
+
+    private:
+        ShaderNameTable();
+        ~ShaderNameTable() = default;
+
+        /**
+         * @brief The names in identifier order. A deque keeps the returned references valid as names are added.
+         */
+        std::deque<std::string> names_;
+        std::unordered_map<std::string, uint32> identifiers_;
+        std::mutex mutex_;
+
+    }; // class ShaderNameTable
+
+} // namespace zero::render
@@ -6,6 +6,7 @@
 #include "component/Material.hpp"
 #include "component/Transform.hpp"
 #include "render/Constants.hpp"
+#include "render/IRenderView.hpp"
 
 namespace zero::render
 {
@@ -58,18 +59,44 @@ namespace zero::render
         float specular_exponent_;
     };
 
+    /**
+     * @brief The data of an instance of an instanced draw. Matches the std430 layout of the instance buffer.
+     */
+    struct alignas(16) InstanceData
+    {
+        InstanceData(const ModelData& model_data, const MaterialData& material_data)
+        : model_data_(model_data)
+        , material_data_(material_data)
+        {
+        }
+
+        ModelData model_data_;
+        MaterialData material_data_;
+    };
+
     struct alignas(16) LightInformationData
     {
-        LightInformationData(uint32 directional_light_count, uint32 point_light_count, uint32 spot_light_count)
-        : directional_light_count_(directional_light_count)
+        LightInformationData(uint32 directional_light_count,
+                             uint32 point_light_count,
+                             uint32 spot_light_count,
+                             const LightClusterGrid& light_cluster_grid)
+        : cluster_view_matrix_(light_cluster_grid.view_matrix_.Transpose())
+        , cluster_projection_matrix_(light_cluster_grid.projection_matrix_.Transpose())
+        , directional_light_count_(directional_light_count)
         , point_light_count_(point_light_count)
         , spot_light_count_(spot_light_count)
+        , cluster_depth_scale_(light_cluster_grid.depth_scale_)
+        , cluster_depth_bias_(light_cluster_grid.depth_bias_)
         {
         }
 
+        math::Matrix4x4 cluster_view_matrix_;
+        math::Matrix4x4 cluster_projection_matrix_;
         uint32 directional_light_count_;
         uint32 point_light_count_;
         uint32 spot_light_count_;
+        float cluster_depth_scale_;
+        float cluster_depth_bias_;
     };
 
     struct alignas(16) DirectionalLightData
@@ -92,11 +119,8 @@ namespace zero::render
 
     struct alignas(16) PointLightData
     {
-        PointLightData(const Transform& transform, const PointLight& light)
-        : position_(transform.GetPosition().x_,
-                    transform.GetPosition().y_,
-                    transform.GetPosition().z_,
-                    0.0F)
+        PointLightData(const math::Vec3f& position, const PointLight& light)
+        : position_(position.x_, position.y_, position.z_, 0.0F)
         , color_(light.color_.x_, light.color_.y_, light.color_.z_, 1.0F)
         , ambient_intensity_(light.ambient_intensity_)
         , diffuse_intensity_(light.diffuse_intensity_)
@@ -119,13 +143,10 @@ namespace zero::render
 
     struct alignas(16) SpotLightData
     {
-        SpotLightData(const Transform& transform, const SpotLight& light)
-        : position_(transform.GetPosition().x_,
-                    transform.GetPosition().y_,
-                    transform.GetPosition().z_,
-                    0.0F)
+        SpotLightData(const math::Vec3f& position, const math::Vec3f& direction, const SpotLight& light)
+        : position_(position.x_, position.y_, position.z_, 0.0F)
         , color_(light.color_.x_, light.color_.y_, light.color_.z_, 1.0F)
-        , direction_(light.direction_.x_, light.direction_.y_, light.direction_.z_, 0.0F)
+        , direction_(direction.x_, direction.y_, direction.z_, 0.0F)
         , ambient_intensity_(light.ambient_intensity_)
         , diffuse_intensity_(light.diffuse_intensity_)
         , inner_cosine_(math::Cos(light.inner_cone_angle_.ToRadian().rad_))
@@ -1,42 +1,94 @@
 #pragma once
 
+#include <array>
 #include <unordered_map>
 #include "render/renderer/ITexture.hpp"
 #include "render/renderer/IRenderHardware.hpp"
+#include "render/renderer/IStorageBuffer.hpp"
 #include "render/renderer/IUniformBuffer.hpp"
 
 namespace zero::render
 {
 
+    /**
+     * @brief The uniform blocks whose data is written to the uniform ring every frame
+     */
+    enum class UniformBlock : uint32
+    {
+        CAMERA = 0,
+        MODEL,
+        LIGHT_INFORMATION,
+        DIRECTIONAL_LIGHTS,
+        SHADOW_MAP_INFORMATION,
+        COUNT
+    };
+
     class UniformManager
     {
     public:
         UniformManager();
         ~UniformManager() = default;
         void Initialize(IRenderHardware* rhi);
-        std::shared_ptr<IUniformBuffer> GetCameraUniform() const;
-        std::shared_ptr<IUniformBuffer> GetMaterialUniform() const;
-        std::shared_ptr<IUniformBuffer> GetModelUniform() const;
-        std::shared_ptr<IUniformBuffer> GetLightInformationUniform() const;
-        std::shared_ptr<IUniformBuffer> GetDirectionalLightUniform() const;
-        std::shared_ptr<IUniformBuffer> GetPointLightUniform() const;
-        std::shared_ptr<IUniformBuffer> GetSpotLightUniform() const;
-        std::shared_ptr<IUniformBuffer> GetShadowMapUniform() const;
-        const std::unordered_map<std::string, std::shared_ptr<ITexture>>& GetShadowTextureUniformMap() const;
-        const std::string& GetDiffuseMapUniformSamplerName() const;
+
+        /**
+         * @brief Write the data of a uniform block into the uniform ring. Later binds of the block use the new data.
+         * @param rhi the render hardware interface
+         * @param uniform_block the uniform block
+         * @param data the data
+         * @param data_size the size of the data. At most the size of the uniform block.
+         */
+        void WriteUniform(IRenderHardware* rhi, UniformBlock uniform_block, const void* data, uint32 data_size);
+
+        /**
+         * @brief Bind the latest data written for a uniform block to the bound shader program
+         * @param rhi the render hardware interface
+         * @param uniform_block the uniform block
+         */
+        void BindUniform(IRenderHardware* rhi, UniformBlock uniform_block) const;
+
+        /**
+         * @brief Write a window of instance data into the storage ring. Later binds of the instances use the new data.
+         * @param rhi the render hardware interface
+         * @param data the instance data
+         * @param data_size the size of the data
+         */
+        void WriteInstances(IRenderHardware* rhi, const void* data, uint32 data_size);
+
+        /**
+         * @brief Bind the latest instance data written to the instance storage block of the bound shader program
+         * @param rhi the render hardware interface
+         */
+        void BindInstances(IRenderHardware* rhi) const;
+
+        const std::shared_ptr<IStorageBuffer>& GetPointLightStorage() const;
+        const std::shared_ptr<IStorageBuffer>& GetSpotLightStorage() const;
+        const std::shared_ptr<IStorageBuffer>& GetLightClusterStorage() const;
+        const std::shared_ptr<IStorageBuffer>& GetLightIndexStorage() const;
+        /**
+         * @brief Get the shadow map textures by the interned names of their sampler uniforms
+         */
+        const std::unordered_map<uint32, std::shared_ptr<ITexture>>& GetShadowTextureUniformMap() const;
+
+        /**
+         * @brief Get the interned name of the diffuse map sampler uniform
+         */
+        uint32 GetDiffuseMapUniformSamplerIdentifier() const;
         const std::string& GetSkyDomeApexColorUniformName() const;
         const std::string& GetSkyDomeCenterColorUniformName() const;
     private:
-        std::shared_ptr<IUniformBuffer> camera_uniform_;
-        std::shared_ptr<IUniformBuffer> material_uniform_;
-        std::shared_ptr<IUniformBuffer> model_uniform_;
-        std::shared_ptr<IUniformBuffer> light_info_uniform_;
-        std::shared_ptr<IUniformBuffer> directional_light_uniform_;
-        std::shared_ptr<IUniformBuffer> point_light_uniform_;
-        std::shared_ptr<IUniformBuffer> spot_light_uniform_;
-        std::shared_ptr<IUniformBuffer> shadow_map_uniform_;
-        std::unordered_map<std::string, std::shared_ptr<ITexture>> shadow_texture_uniform_map_;
-        std::string diffuse_map_uniform_sampler_name_;
+        static constexpr auto kUniformBlockCount = static_cast<uint32>(UniformBlock::COUNT);
+
+        std::array<uint32, kUniformBlockCount> uniform_block_name_identifiers_;
+        std::array<uint32, kUniformBlockCount> uniform_block_sizes_;
+        std::array<UniformRange, kUniformBlockCount> uniform_ranges_;
+        std::shared_ptr<IStorageBuffer> point_light_storage_;
+        std::shared_ptr<IStorageBuffer> spot_light_storage_;
+        std::shared_ptr<IStorageBuffer> light_cluster_storage_;
+        std::shared_ptr<IStorageBuffer> light_index_storage_;
+        uint32 instance_block_name_identifier_;
+        UniformRange instance_range_;
+        std::unordered_map<uint32, std::shared_ptr<ITexture>> shadow_texture_uniform_map_;
+        uint32 diffuse_map_uniform_sampler_identifier_;
         std::string sky_dome_apex_color_uniform_name_;
         std::string sky_dome_center_color_uniform_name_;
 
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "core/ZeroBase.hpp"
+
+namespace zero::render
+{
+
+    /**
+     * @brief A range of the uniform or storage ring holding the data of a block for the current frame
+     */
+    struct UniformRange
+    {
+        uint32 offset_;
+        /**
+         * @brief The size of the range. Zero if the data could not be written.
+         */
+        uint32 size_;
+    }; // struct UniformRange
+
+} // namespace zero::render
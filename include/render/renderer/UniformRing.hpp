@@ -0,0 +1,72 @@
+#pragma once
+
+#include "core/ZeroBase.hpp"
+#include "render/renderer/UniformRange.hpp"
+
+namespace zero::render
+{
+
+    /**
+     * @brief The bookkeeping of a ring buffer of per-frame uniform data
+     *
+     * The ring is split in regions of equal size. Every frame allocates linearly from the next region, so the data of
+     * the frames still read by the GPU is never overwritten as long as the render hardware waits for the frame that
+     * last used a region before reusing it.
+     */
+    class UniformRing
+    {
+    public:
+        /**
+         * @param region_count the number of regions
+         * @param region_size the size of a region in bytes
+         * @param alignment the alignment of the allocated offsets
+         */
+        UniformRing(uint32 region_count, uint32 region_size, uint32 alignment);
+        ~UniformRing() = default;
+
+        /**
+         * @brief Move on to the next region and reset its allocations
+         */
+        void BeginRegion();
+
+        /**
+         * @brief Allocate a range in the current region
+         * @param size the size of the range
+         * @return the range. Its size is zero if the region is full.
+         */
+        UniformRange Allocate(uint32 size);
+
+        /**
+         * @brief Get the index of the current region
+         * @return the region index
+         */
+        [[nodiscard]] uint32 GetRegionIndex() const;
+
+        /**
+         * @brief Get the offset of the current region in the ring
+         * @return the region offset
+         */
+        [[nodiscard]] uint32 GetRegionOffset() const;
+
+        /**
+         * @brief Get the number of bytes allocated in the current region, including alignment padding
+         * @return the used size
+         */
+        [[nodiscard]] uint32 GetUsedSize() const;
+
+        /**
+         * @brief Get the size of the whole ring
+         * @return the size in bytes
+         */
+        [[nodiscard]] uint32 GetSize() const;
+
+    private:
+        uint32 region_count_;
+        uint32 region_size_;
+        uint32 alignment_;
+        uint32 region_index_;
+        uint32 used_size_;
+
+    }; // class UniformRing
+
+} // namespace zero::render
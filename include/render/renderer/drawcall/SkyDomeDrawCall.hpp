@@ -16,10 +16,10 @@ namespace zero::render
                         std::shared_ptr<IProgram> program,
                         std::shared_ptr<UniformManager> uniform_manager);
         ~SkyDomeDrawCall() override = default;
-        const DrawKey& GetDrawKey() override;
+        [[nodiscard]] uint64 GetSortKey() const override;
         void Draw(IRenderHardware* rhi) override;
     private:
-        DrawKey draw_key_;
+        uint64 sort_key_;
         ModelData model_data_;
         math::Vec3f apex_color_;
         math::Vec3f center_color_;
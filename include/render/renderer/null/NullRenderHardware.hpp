@@ -0,0 +1,129 @@
+#pragma once
+
+#include "render/renderer/IRenderHardware.hpp"
+#include "render/renderer/RenderStateCache.hpp"
+#include "render/renderer/UniformRing.hpp"
+
+namespace zero::render
+{
+
+    /**
+     * @brief Headless render hardware interface.
+     *
+     * No GPU work is issued. Render commands are only counted so the frame loop can run (and be inspected)
+     * without a window or graphics context.
+     */
+    class NullRenderHardware : public IRenderHardware
+    {
+    public:
+        /**
+         * @brief The render commands issued since the statistics were last reset
+         */
+        struct Statistics
+        {
+            uint32 frame_count_ = 0;
+            uint32 draw_count_ = 0;
+            uint32 instance_count_ = 0;
+            uint32 program_bind_count_ = 0;
+            uint32 texture_bind_count_ = 0;
+            uint32 uniform_buffer_bind_count_ = 0;
+            uint32 uniform_update_count_ = 0;
+            uint32 uniform_update_bytes_ = 0;
+            uint32 uniform_write_count_ = 0;
+            uint32 uniform_write_bytes_ = 0;
+            uint32 storage_buffer_bind_count_ = 0;
+            uint32 storage_update_count_ = 0;
+            uint32 storage_update_bytes_ = 0;
+            uint32 storage_write_count_ = 0;
+            uint32 storage_write_bytes_ = 0;
+            uint32 draw_command_update_count_ = 0;
+            uint32 filtered_state_change_count_ = 0;
+        }; // struct Statistics
+
+        NullRenderHardware();
+        ~NullRenderHardware() override = default;
+        void Initialize() override;
+        void Shutdown() override;
+
+        void SetViewport(uint32 x, uint32 y, uint32 width, uint32 height)  override;
+        void SetFillMode(FillMode fill_mode) override;
+        void SetCullMode(CullMode cull_mode) override;
+
+        void SetClearColor(const math::Vec4f& color) override;
+        void Clear() override;
+
+        std::shared_ptr<ISampler> GetDiffuseMapSampler() override;
+        std::shared_ptr<ISampler> GetShadowMapSampler() override;
+
+        const std::vector<std::shared_ptr<ITexture>>& GetShadowMapTextures() override;
+        const std::vector<std::shared_ptr<IFrameBuffer>>& GetShadowMapFrameBuffers() override;
+
+        void UpdateUniformData(const std::shared_ptr<IUniformBuffer>& uniform_buffer, const void* data, uint32 data_size, uint32 data_offset) override;
+        void UpdateStorageData(const std::shared_ptr<IStorageBuffer>& storage_buffer, const void* data, uint32 data_size, uint32 data_offset) override;
+        void UpdateDrawCommands(const DrawIndirectCommand* draw_commands, uint32 draw_command_count) override;
+
+        void BeginUniformFrame() override;
+        void EndUniformFrame() override;
+        UniformRange WriteUniformData(const void* data, uint32 data_size, uint32 block_size) override;
+        UniformRange WriteStorageData(const void* data, uint32 data_size) override;
+
+        std::shared_ptr<IMesh> CreateMesh(MeshData* mesh_data) override;
+        std::shared_ptr<IShader> CreateShader(const ShaderStage& shader_stage) override;
+        std::shared_ptr<IProgram> CreateShaderProgram(const std::vector<std::shared_ptr<IShader>>& shaders) override;
+        std::shared_ptr<ITexture> CreateTexture(std::unique_ptr<Image> image) override;
+        std::shared_ptr<IUniformBuffer> CreateUniformBuffer(std::string buffer_name, const void* initial_data, uint32 buffer_size) override;
+        std::shared_ptr<IStorageBuffer> CreateStorageBuffer(std::string buffer_name, const void* initial_data, uint32 buffer_size) override;
+
+        void BeginFrame(const std::shared_ptr<IFrameBuffer>& frame_buffer) override;
+        void EndFrame() override;
+
+        void BindShaderProgram(const std::shared_ptr<IProgram>& shader_program) override;
+        void BindTexture(const std::shared_ptr<ITexture>& texture, const std::shared_ptr<ISampler>& texture_sampler, uint32 uniform_name_identifier) override;
+        void BindUniformBuffer(const std::shared_ptr<IUniformBuffer>& uniform_buffer) override;
+        void BindStorageBuffer(const std::shared_ptr<IStorageBuffer>& storage_buffer) override;
+        void BindUniformRange(uint32 block_name_identifier, const UniformRange& uniform_range) override;
+        void BindStorageRange(uint32 block_name_identifier, const UniformRange& storage_range) override;
+
+        void DrawMesh(const std::shared_ptr<IMesh>& mesh) override;
+        void DrawMeshInstanced(const std::shared_ptr<IMesh>& mesh, uint32 instance_count, uint32 first_instance) override;
+        void MultiDrawMeshIndirect(const std::shared_ptr<IMesh>& mesh, uint32 first_command, uint32 command_count) override;
+
+        [[nodiscard]] uint32 GetFilteredStateChangeCount() const override;
+        void ResetFilteredStateChangeCount() override;
+        [[nodiscard]] GeometryArena::Statistics GetGeometryStatistics() const override;
+
+        /**
+         * @brief Get the render commands issued since the last reset
+         * @return the statistics
+         */
+        [[nodiscard]] const Statistics& GetStatistics() const;
+
+        /**
+         * @brief Reset the render command statistics
+         */
+        void ResetStatistics();
+
+    private:
+        /**
+         * @brief The log title
+         */
+        static const char* kTitle;
+        std::shared_ptr<ISampler> diffuse_map_sampler_;
+        std::shared_ptr<ISampler> shadow_map_sampler_;
+        std::vector<std::shared_ptr<ITexture>> shadow_map_textures_;
+        std::vector<std::shared_ptr<IFrameBuffer>> shadow_map_frame_buffers_;
+        /**
+         * @brief Copy of the draw commands, to count the instances of multi draws
+         */
+        std::vector<DrawIndirectCommand> draw_commands_;
+        UniformRing uniform_ring_;
+        UniformRing storage_ring_;
+        /**
+         * @brief Filters the program, cull mode and fill mode changes like a GPU backend would
+         */
+        RenderStateCache state_cache_;
+        uint32 program_count_;
+        Statistics statistics_;
+    }; // class NullRenderHardware
+
+} // namespace zero::render
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <string>
+#include "render/renderer/IFrameBuffer.hpp"
+#include "render/renderer/IMesh.hpp"
+#include "render/renderer/IProgram.hpp"
+#include "render/renderer/ISampler.hpp"
+#include "render/renderer/IShader.hpp"
+#include "render/renderer/IStorageBuffer.hpp"
+#include "render/renderer/ITexture.hpp"
+#include "render/renderer/IUniformBuffer.hpp"
+
+namespace zero::render
+{
+
+    /**
+     * @brief Render resources without a GPU counterpart, created by the NullRenderHardware
+     */
+    ///@{
+    class NullFrameBuffer final : public IFrameBuffer
+    {
+    }; // class NullFrameBuffer
+
+    class NullMesh final : public IMesh
+    {
+    public:
+        explicit NullMesh(uint32 index_count = 0, uint32 first_index = 0, uint32 base_vertex = 0)
+        : index_count_(index_count)
+        , first_index_(first_index)
+        , base_vertex_(base_vertex)
+        {
+        }
+
+        [[nodiscard]] uint32 GetIndexCount() const override { return index_count_; }
+        [[nodiscard]] uint32 GetFirstIndex() const override { return first_index_; }
+        [[nodiscard]] uint32 GetBaseVertex() const override { return base_vertex_; }
+        // Null meshes have no buffers, so they can all be drawn together
+        [[nodiscard]] uint32 GetGeometryIdentifier() const override { return 0; }
+
+    private:
+        uint32 index_count_;
+        uint32 first_index_;
+        uint32 base_vertex_;
+    }; // class NullMesh
+
+    class NullTexture final : public ITexture
+    {
+    }; // class NullTexture
+
+    class NullProgram final : public IProgram
+    {
+    public:
+        explicit NullProgram(uint32 identifier = 0) : identifier_(identifier) {}
+        [[nodiscard]] uint32 GetIdentifier() const { return identifier_; }
+        void SetUniform(const std::string& /* name */, math::Matrix4x4 /* value */) override {}
+        void SetUniform(const std::string& /* name */, math::Matrix3x3 /* value */) override {}
+        void SetUniform(const std::string& /* name */, math::Vec4f /* value */) override {}
+        void SetUniform(const std::string& /* name */, math::Vec3f /* value */) override {}
+        void SetUniform(const std::string& /* name */, zero::int32 /* value */) override {}
+        void SetUniform(const std::string& /* name */, float /* value */) override {}
+    private:
+        uint32 identifier_;
+    }; // class NullProgram
+
+    class NullSampler final : public ISampler
+    {
+    public:
+        void SetWrappingS(Wrapping /* wrapping */) override {}
+        void SetWrappingT(Wrapping /* wrapping */) override {}
+        void SetWrappingR(Wrapping /* wrapping */) override {}
+        void SetMinificationFilter(Filter /* filter */) override {}
+        void SetMagnificationFilter(Filter /* filter */) override {}
+        void SetBorderColour(math::Vec4f /* colour */) override {}
+    }; // class NullSampler
+
+    class NullShader final : public IShader
+    {
+    public:
+        explicit NullShader(Type type) : type_(type) {}
+        [[nodiscard]] Type GetType() const override { return type_; }
+    private:
+        Type type_;
+    }; // class NullShader
+
+    class NullStorageBuffer final : public IStorageBuffer
+    {
+    public:
+        NullStorageBuffer(std::string name, uint32 buffer_size) : name_(std::move(name)), buffer_size_(buffer_size) {}
+        [[nodiscard]] uint32 GetSize() override { return buffer_size_; }
+        const std::string& GetName() override { return name_; }
+    private:
+        std::string name_;
+        uint32 buffer_size_;
+    }; // class NullStorageBuffer
+
+    class NullUniformBuffer final : public IUniformBuffer
+    {
+    public:
+        NullUniformBuffer(std::string name, uint32 buffer_size) : name_(std::move(name)), buffer_size_(buffer_size) {}
+        [[nodiscard]] uint32 GetSize() override { return buffer_size_; }
+        const std::string& GetName() override { return name_; }
+    private:
+        std::string name_;
+        uint32 buffer_size_;
+    }; // class NullUniformBuffer
+    ///@}
+
+} // namespace zero::render
@@ -1,30 +1,31 @@
 #pragma once
 
 #include <memory>
-#include "render/MeshData.hpp"
+#include "render/renderer/GeometryArena.hpp"
 #include "render/renderer/IMesh.hpp"
-#include "render/renderer/opengl/OpenGL.hpp"
 
 namespace zero::render
 {
 
+    /**
+     * @brief A mesh stored in a page of the shared geometry buffers. Frees its ranges of the page when destroyed.
+     */
     class GLMesh final : public IMesh
     {
     public:
-        GLMesh(GLuint vao_identifier, GLuint vertex_buffer, GLuint index_buffer, uint32 index_data_size);
+        GLMesh(std::shared_ptr<GeometryArena> geometry_arena, const GeometryArena::Allocation& allocation);
 
-        ~GLMesh() override = default;
+        ~GLMesh() override;
 
-        [[nodiscard]] GLuint GetVAOIdentifier() const;
-        [[nodiscard]] GLuint GetVertexBufferIdentifier() const;
-        [[nodiscard]] GLuint GetIndexBufferIdentifier() const;
-        [[nodiscard]] uint32 GetIndexDataSize() const;
+        [[nodiscard]] uint32 GetPageIndex() const;
+        [[nodiscard]] uint32 GetIndexCount() const override;
+        [[nodiscard]] uint32 GetFirstIndex() const override;
+        [[nodiscard]] uint32 GetBaseVertex() const override;
+        [[nodiscard]] uint32 GetGeometryIdentifier() const override;
 
     private:
-        GLuint vao_id_;
-        GLuint vertex_buffer_id_;
-        GLuint index_buffer_id_;
-        uint32 index_data_size_;
+        std::shared_ptr<GeometryArena> geometry_arena_;
+        GeometryArena::Allocation allocation_;
 
     }; // class GLMesh
 
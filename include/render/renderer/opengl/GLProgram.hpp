@@ -11,20 +11,30 @@
 namespace zero::render
 {
     /**
-     * @brief OpenGL graphics program wrapper
+     * @brief OpenGL graphics program wrapper.
+     *
+     * The active uniforms, samplers and blocks of the program are reflected once when it is created. Every block is
+     * given a fixed binding point and every sampler a fixed texture unit, and uniform locations are cached by their
+     * interned name identifiers, so binding resources and flushing uniforms never query the program by string.
+     * The program object is deleted when the wrapper is destroyed.
      */
     class GLProgram final : public IProgram
     {
         template<class T>
-        using UniformMap = std::unordered_map<std::string, T> ;
+        using UniformMap = std::unordered_map<uint32, T>;
     public:
         /**
-         * @brief Constructor
+         * @brief The binding point or texture unit of a resource the program does not read
+         */
+        static constexpr uint32 kUnusedBinding = 0xFFFFFFFFU;
+
+        /**
+         * @brief Constructor. Reflects the program.
          * @param program_id the OpenGL linked shader program identifier
          */
         explicit GLProgram(GLuint program_id);
 
-        ~GLProgram() override = default;
+        ~GLProgram() override;
 
         /**
          * @see IProgram::SetUniform
@@ -38,21 +48,39 @@ namespace zero::render
         void SetUniform(const std::string& name, float value) override;
         ///@}
 
-        const UniformMap<math::Matrix4x4>& GetMatrix4x4Map() const;
-        const UniformMap<math::Matrix3x3>& GetMatrix3x3Map() const;
-        const UniformMap<math::Vec4f>& GetVec4fMap() const;
-        const UniformMap<math::Vec3f>& GetVec3fMap() const;
-        const UniformMap<int32>& GetInt32Map() const;
-        const UniformMap<float>& GetFloatMap() const;
-
         [[nodiscard]] GLuint GetIdentifier() const;
 
+        /**
+         * @brief Get the binding point or texture unit assigned to a resource of the program
+         * @param name_identifier the interned name of the uniform block, storage block or sampler
+         * @return the binding point or texture unit. kUnusedBinding if the program does not read the resource.
+         */
+        ///@{
+        [[nodiscard]] uint32 GetUniformBlockBinding(uint32 name_identifier) const;
+        [[nodiscard]] uint32 GetStorageBlockBinding(uint32 name_identifier) const;
+        [[nodiscard]] uint32 GetTextureUnit(uint32 name_identifier) const;
+        ///@}
+
         /**
          * @brief Set all uniform data on the current program object
          */
         void FlushUniforms() const;
     private:
+        /**
+         * @brief Query the active resources of the program and assign their binding points, texture units and locations
+         */
+        void Reflect();
+
+        /**
+         * @brief Find the binding of a resource
+         */
+        static uint32 FindBinding(const std::unordered_map<uint32, uint32>& bindings, uint32 name_identifier);
+
         GLuint program_id_;
+        std::unordered_map<uint32, GLint> uniform_locations_;
+        std::unordered_map<uint32, uint32> uniform_block_bindings_;
+        std::unordered_map<uint32, uint32> storage_block_bindings_;
+        std::unordered_map<uint32, uint32> texture_units_;
         UniformMap<math::Matrix4x4> matrix4x4_map_;
         UniformMap<math::Matrix3x3> matrix3x3_map_;
         UniformMap<math::Vec4f> vec4f_map_;
@@ -1,6 +1,11 @@
 #pragma once
 
+#include <array>
+#include "render/Constants.hpp"
+#include "render/renderer/GeometryArena.hpp"
 #include "render/renderer/IRenderHardware.hpp"
+#include "render/renderer/RenderStateCache.hpp"
+#include "render/renderer/UniformRing.hpp"
 #include "render/renderer/opengl/OpenGL.hpp"
 
 namespace zero::render
@@ -9,6 +14,7 @@ namespace zero::render
     class GLProgram;
     class GLSampler;
     class GLShader;
+    class GLStorageBuffer;
     class GLTexture;
     class GLUniformBuffer;
 
@@ -33,41 +39,114 @@ namespace zero::render
         const std::vector<std::shared_ptr<ITexture>>& GetShadowMapTextures() override;
         const std::vector<std::shared_ptr<IFrameBuffer>>& GetShadowMapFrameBuffers() override;
 
-        void UpdateUniformData(std::shared_ptr<IUniformBuffer> uniform_buffer, const void* data, uint32 data_size, uint32 data_offset) override;
+        void UpdateUniformData(const std::shared_ptr<IUniformBuffer>& uniform_buffer, const void* data, uint32 data_size, uint32 data_offset) override;
+        void UpdateStorageData(const std::shared_ptr<IStorageBuffer>& storage_buffer, const void* data, uint32 data_size, uint32 data_offset) override;
+        void UpdateDrawCommands(const DrawIndirectCommand* draw_commands, uint32 draw_command_count) override;
+
+        void BeginUniformFrame() override;
+        void EndUniformFrame() override;
+        UniformRange WriteUniformData(const void* data, uint32 data_size, uint32 block_size) override;
+        UniformRange WriteStorageData(const void* data, uint32 data_size) override;
 
         std::shared_ptr<IMesh> CreateMesh(MeshData* mesh_data) override;
         std::shared_ptr<IShader> CreateShader(const ShaderStage& shader_stage) override;
         std::shared_ptr<IProgram> CreateShaderProgram(const std::vector<std::shared_ptr<IShader>>& shaders) override;
         std::shared_ptr<ITexture> CreateTexture(std::unique_ptr<Image> image) override;
         std::shared_ptr<IUniformBuffer> CreateUniformBuffer(std::string buffer_name, const void* initial_data, uint32 buffer_size) override;
+        std::shared_ptr<IStorageBuffer> CreateStorageBuffer(std::string buffer_name, const void* initial_data, uint32 buffer_size) override;
 
-        void BeginFrame(std::shared_ptr<IFrameBuffer> frame_buffer) override;
+        void BeginFrame(const std::shared_ptr<IFrameBuffer>& frame_buffer) override;
         void EndFrame() override;
 
-        void BindShaderProgram(std::shared_ptr<IProgram> shader_program) override;
-        void BindTexture(std::shared_ptr<ITexture> texture, std::shared_ptr<ISampler> texture_sampler, const std::string& uniform_name) override;
-        void BindUniformBuffer(std::shared_ptr<IUniformBuffer> uniform_buffer) override;
+        void BindShaderProgram(const std::shared_ptr<IProgram>& shader_program) override;
+        void BindTexture(const std::shared_ptr<ITexture>& texture, const std::shared_ptr<ISampler>& texture_sampler, uint32 uniform_name_identifier) override;
+        void BindUniformBuffer(const std::shared_ptr<IUniformBuffer>& uniform_buffer) override;
+        void BindStorageBuffer(const std::shared_ptr<IStorageBuffer>& storage_buffer) override;
+        void BindUniformRange(uint32 block_name_identifier, const UniformRange& uniform_range) override;
+        void BindStorageRange(uint32 block_name_identifier, const UniformRange& storage_range) override;
+
+        void DrawMesh(const std::shared_ptr<IMesh>& mesh) override;
+        void DrawMeshInstanced(const std::shared_ptr<IMesh>& mesh, uint32 instance_count, uint32 first_instance) override;
+        void MultiDrawMeshIndirect(const std::shared_ptr<IMesh>& mesh, uint32 first_command, uint32 command_count) override;
 
-        void DrawMesh(std::shared_ptr<IMesh> mesh) override;
+        [[nodiscard]] uint32 GetFilteredStateChangeCount() const override;
+        void ResetFilteredStateChangeCount() override;
+        [[nodiscard]] GeometryArena::Statistics GetGeometryStatistics() const override;
 
     private:
+        /**
+         * @brief A vertex buffer and index buffer shared by the meshes of a page of the geometry arena
+         */
+        struct GeometryPage
+        {
+            GLuint vertex_buffer_;
+            GLuint index_buffer_;
+        }; // struct GeometryPage
+
+        /**
+         * @brief Create the buffers of the pages added to the geometry arena
+         */
+        void CreateGeometryPages();
+
+        /**
+         * @brief Bind the buffers of the page storing a mesh to the vertex array
+         */
+        void BindGeometry(const GLMesh& gl_mesh);
+
+
         /**
          * @brief The log title
          */
         static const char* kTitle;
         std::shared_ptr<GLSampler> diffuse_map_sampler_;
         std::shared_ptr<GLSampler> shadow_map_sampler_;
-        std::vector<std::shared_ptr<GLMesh>> meshes_;
-        std::vector<GLuint> shaders_;
-        std::vector<GLuint> programs_;
-        std::vector<GLuint> textures_;
+        /**
+         * @brief The shared geometry buffers. Every page is drawn through the same vertex array, as all meshes share
+         * the vertex format. Meshes hold the arena so they can free their ranges after shutdown.
+         */
+        ///@{
+        std::shared_ptr<GeometryArena> geometry_arena_;
+        std::vector<GeometryPage> geometry_pages_;
+        GLuint geometry_vertex_array_;
+        ///@}
         std::vector<GLuint> uniform_buffers_;
-        std::shared_ptr<GLProgram> bound_shader_program_;
+        std::vector<GLuint> storage_buffers_;
+        /**
+         * @brief The buffer of draw commands read by multi draws. Grown to fit the largest upload.
+         */
+        ///@{
+        GLuint draw_command_buffer_;
+        uint32 draw_command_capacity_;
+        ///@}
+        /**
+         * @brief The persistently mapped uniform and storage rings, and the fences of the frames that last used their
+         * regions. A frame uses the regions of the same index in both rings.
+         */
+        ///@{
+        UniformRing uniform_ring_;
+        GLuint uniform_ring_buffer_;
+        uint8* uniform_ring_data_;
+        UniformRing storage_ring_;
+        GLuint storage_ring_buffer_;
+        uint8* storage_ring_data_;
+        std::array<GLsync, Constants::kUniformRingRegionCount> uniform_ring_fences_;
+        ///@}
+        /**
+         * @brief The render state last set on the context, to skip redundant state changes
+         */
+        RenderStateCache state_cache_;
+        /**
+         * @brief The program bound since the last BindShaderProgram. Not owned, so binds do not touch its reference count.
+         * The caller keeps the program alive until the end of the frame.
+         */
+        GLProgram* bound_shader_program_;
         std::vector<std::shared_ptr<ITexture>> shadow_map_textures_;
         std::vector<std::shared_ptr<IFrameBuffer>> shadow_map_frame_buffers_;
         std::shared_ptr<GLTexture> empty_texture_;
-        uint32 available_texture_unit_index_;
-        uint32 available_uniform_buffer_binding_point;
+        /**
+         * @brief The number of texture units bound since the last EndFrame
+         */
+        uint32 used_texture_unit_count_;
     }; // class GLRenderHardware
 
 } // namespace zero::render
\ No newline at end of file
@@ -8,7 +8,7 @@ namespace zero::render
 {
 
     /**
-     * @brief OpenGL graphics shader wrapper
+     * @brief OpenGL graphics shader wrapper. Deletes the shader object when destroyed.
      */
     class GLShader final : public IShader
     {
@@ -21,7 +21,7 @@ namespace zero::render
          */
         GLShader(GLuint shader_id, IShader::Type type);
 
-        ~GLShader() override = default;
+        ~GLShader() override;
 
         /**
          * @see IShader::GetType
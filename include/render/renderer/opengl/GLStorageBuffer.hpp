@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string>
+#include "render/renderer/IStorageBuffer.hpp"
+#include "render/renderer/opengl/OpenGL.hpp"
+
+namespace zero::render
+{
+
+    /**
+     * @brief OpenGL graphics shader storage buffer wrapper
+     */
+    class GLStorageBuffer final : public IStorageBuffer
+    {
+    public:
+        GLStorageBuffer(GLuint ssbo_id, uint32 buffer_size, std::string name);
+
+        ~GLStorageBuffer() override = default;
+
+        [[nodiscard]] uint32 GetSize() override;
+        const std::string& GetName() override;
+        [[nodiscard]] GLuint GetIdentifier() const;
+
+        /**
+         * @brief Get the name interned by the ShaderNameTable
+         * @return the name identifier
+         */
+        [[nodiscard]] uint32 GetNameIdentifier() const;
+
+    private:
+        GLuint ssbo_id_;
+        uint32 buffer_size_;
+        std::string name_;
+        uint32 name_identifier_;
+
+    }; // class GLStorageBuffer
+
+} // namespace zero::render
\ No newline at end of file
@@ -7,7 +7,7 @@ namespace zero::render
 {
 
     /**
-     * @brief OpenGL graphics texture wrapper
+     * @brief OpenGL graphics texture wrapper. Deletes the texture object when destroyed.
      */
     class GLTexture final : public ITexture
     {
@@ -20,7 +20,7 @@ namespace zero::render
          */
         GLTexture(GLuint id, GLenum target);
 
-        ~GLTexture() override = default;
+        ~GLTexture() override;
 
         /**
          * @brief Get the texture target type
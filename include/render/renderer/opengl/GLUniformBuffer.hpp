@@ -21,10 +21,17 @@ namespace zero::render
         const std::string& GetName() override;
         [[nodiscard]] GLuint GetIdentifier() const;
 
+        /**
+         * @brief Get the name interned by the ShaderNameTable
+         * @return the name identifier
+         */
+        [[nodiscard]] uint32 GetNameIdentifier() const;
+
     private:
         GLuint ubo_id_;
         uint32 buffer_size_;
         std::string name_;
+        uint32 name_identifier_;
 
     }; // class GLUniformBuffer
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "render/renderer/DrawCallQueue.hpp"
+#include "render/renderer/IndirectDrawList.hpp"
 #include "render/renderer/IRenderPass.hpp"
 
 namespace zero::render
@@ -9,20 +11,31 @@ namespace zero::render
     {
     public:
         explicit CascadedShadowMapRenderPass(uint32 cascade_index);
-        void Initialize(IRenderHardware* rhi, std::shared_ptr<IUniformBuffer> camera_uniform) override;
-        void Submit(std::unique_ptr<IDrawCall> draw_call) override;
-        void Sort() override;
-        void Render(IRenderView* render_view, IRenderHardware* rhi) override;
+        void Initialize(IRenderHardware* rhi,
+                        std::shared_ptr<UniformManager> uniform_manager,
+                        std::shared_ptr<const RenderResources> render_resources) override;
+        void Submit(const DrawPacket& draw_packet, uint64 sort_key) override;
+        void Submit(DrawCallPtr draw_call) override;
+        void Sort(ThreadPool& thread_pool) override;
+        void Record(IRenderView* render_view, CommandBuffer& command_buffer) override;
         void ClearDrawCalls() override;
     private:
+        /**
+         * @brief Record the draw of a run of shadow casters into the shadow map
+         */
+        void DrawShadowCasters(CommandBuffer& command_buffer, const DrawPacket& draw_packet, uint32 first_command, uint32 command_count) const;
+
         /**
          * @brief The log title
          */
         static const char* kTitle;
 
         uint32 cascade_index_;
-        std::shared_ptr<IUniformBuffer> camera_uniform_;
-        std::vector<std::unique_ptr<IDrawCall>> draw_calls_;
+        std::shared_ptr<UniformManager> uniform_manager_;
+        std::shared_ptr<const RenderResources> render_resources_;
+        std::shared_ptr<IFrameBuffer> shadow_map_frame_buffer_;
+        DrawCallQueue draw_call_queue_;
+        IndirectDrawList indirect_draw_list_;
     };
 
 } // namespace zero::render
\ No newline at end of file
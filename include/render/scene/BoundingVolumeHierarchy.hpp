@@ -0,0 +1,153 @@
+#pragma once
+
+#include <vector>
+#include "component/Component.hpp"
+#include "core/NonCopyable.hpp"
+#include "core/ZeroBase.hpp"
+#include "math/Box.hpp"
+#include "math/Sphere.hpp"
+#include "render/scene/CullingHistory.hpp"
+#include "render/scene/IViewVolume.hpp"
+
+namespace zero::render
+{
+
+    /**
+     * @brief Bounding volume hierarchy over the volumes of static Transform hierarchies
+     *
+     * The leaves contain the hierarchy roots, see CullingManager::IsHierarchyRoot.
+     * Roots tagged with DynamicVolume are excluded, see SpatialHashGrid.
+     *
+     * The hierarchy is built with the surface area heuristic when roots are added or removed.
+     * Roots whose volumes moved are refit in place, and the hierarchy is rebuilt once enough refits have
+     * accumulated to degrade its quality.
+     *
+     * Queries walk the hierarchy top-down and accept or reject whole subtrees that are completely inside or
+     * outside the view volume, then cull the Transform hierarchy below every root that is not culled.
+     * The cost of a query scales with the number of visible entities.
+     *
+     * The top of the hierarchy is split into chunks, disjoint subtrees that can be queried concurrently.
+     */
+    class BoundingVolumeHierarchy : public NonCopyable
+    {
+    public:
+        BoundingVolumeHierarchy();
+        ~BoundingVolumeHierarchy();
+
+        /**
+         * @brief Synchronize the hierarchy with the static hierarchy roots in the registry
+         *
+         * The registry must outlive the hierarchy.
+         *
+         * @param registry the registry containing all the entities and their components
+         */
+        void Update(entt::registry& registry);
+
+        /**
+         * @brief Retrieve all visible entities that are not culled by the view volume
+         * @param view_volume the view volume to cull against
+         * @param registry the registry the hierarchy was last updated with
+         * @param entities the list the entities are appended to
+         */
+        void Query(const IViewVolume& view_volume, const entt::registry& registry, std::vector<Entity>& entities) const;
+
+        /**
+         * @return the number of chunks the hierarchy is split into. Changes when the hierarchy is rebuilt.
+         */
+        [[nodiscard]] uint32 GetChunkCount() const;
+
+        /**
+         * @brief Retrieve the visible entities of a single chunk that are not culled by the view volume
+         *
+         * Querying every chunk in order appends the same entities in the same order as Query.
+         * Chunks may be queried concurrently.
+         *
+         * @param chunk_index the chunk, less than GetChunkCount
+         * @param view_volume the view volume to cull against
+         * @param registry the registry the hierarchy was last updated with
+         * @param culling_history the culling results of the view volume in the previous frame. May be null.
+         * @param entities the list the entities are appended to
+         */
+        void QueryChunk(uint32 chunk_index,
+                        const IViewVolume& view_volume,
+                        const entt::registry& registry,
+                        CullingHistory* culling_history,
+                        std::vector<Entity>& entities) const;
+
+        /**
+         * @return the number of hierarchy roots in the bounding volume hierarchy
+         */
+        [[nodiscard]] uint32 GetEntityCount() const;
+
+        /**
+         * @return the number of nodes in the hierarchy
+         */
+        [[nodiscard]] uint32 GetNodeCount() const;
+
+        /**
+         * @return incremented whenever the hierarchy is rebuilt and the order of the roots changes
+         */
+        [[nodiscard]] uint32 GetGeneration() const;
+
+    private:
+        static constexpr uint32 kInvalidIndex = 0xFFFFFFFFU;
+        static constexpr uint32 kMaxLeafSize = 4;
+        static constexpr uint32 kMaxDepth = 60;
+        static constexpr uint32 kBinCount = 12;
+        static constexpr uint32 kMaxChunkCount = 16;
+
+        struct Node
+        {
+            math::Box box_;
+            /**
+             * @brief Index of the left child. The right child immediately follows it. Zero for leaves.
+             */
+            uint32 left_child_;
+            uint32 parent_;
+            /**
+             * @brief The primitives in the subtree are stored contiguously
+             */
+            uint32 first_primitive_;
+            uint32 primitive_count_;
+        }; // struct Node
+
+        struct Primitive
+        {
+            Entity entity_;
+            uint32 version_;
+            math::Sphere sphere_;
+            math::Box box_;
+            math::Vec3f centroid_;
+        }; // struct Primitive
+
+        void Attach(entt::registry& registry);
+        void Detach();
+        void OnMembershipChanged(entt::registry& registry, Entity entity);
+        void Rebuild(const entt::registry& registry);
+        void BuildNode(uint32 node_index, uint32 depth);
+        void Refit(uint32 node_index);
+        void SplitChunks();
+        void QueryNode(uint32 root_node_index,
+                       const IViewVolume& view_volume,
+                       const entt::registry& registry,
+                       CullingHistory* culling_history,
+                       std::vector<Entity>& entities) const;
+
+        entt::registry* registry_;
+        std::vector<Node> nodes_;
+        std::vector<Primitive> primitives_;
+        /**
+         * @brief The leaf node containing each primitive
+         */
+        std::vector<uint32> primitive_leaves_;
+        /**
+         * @brief The root node of every chunk, ordered from left to right
+         */
+        std::vector<uint32> chunk_nodes_;
+        bool needs_rebuild_;
+        uint32 refit_count_;
+        uint32 generation_;
+
+    }; // class BoundingVolumeHierarchy
+
+} // namespace zero::render
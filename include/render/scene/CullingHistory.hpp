@@ -0,0 +1,93 @@
+#pragma once
+
+#include <vector>
+#include "core/ZeroBase.hpp"
+#include "math/Sphere.hpp"
+#include "render/scene/IViewVolume.hpp"
+
+namespace zero::render
+{
+    // Forward declarations
+    class BoundingVolumeHierarchy;
+    class SpatialHashGrid;
+
+    /**
+     * @brief The culling results of the hierarchy roots in the spatial structures for a view volume that is culled every frame
+     *
+     * Every root remembers the plane that culled it, which is tested first in the next frame, and whether it was culled.
+     * Roots whose volume did not change are not tested again as long as the view volume does not change either.
+     *
+     * Each view volume needs its own history. Chunks of the structures may be culled concurrently with the same history.
+     */
+    class CullingHistory
+    {
+    public:
+        /**
+         * @brief The culling state of a hierarchy root
+         */
+        struct State
+        {
+            /**
+             * @brief The version of the volume when it was last tested
+             */
+            uint32 volume_version_ = 0;
+            /**
+             * @brief The view epoch when the volume was last tested. Zero if it was never tested.
+             */
+            uint32 view_epoch_ = 0;
+            uint8 plane_hint_ = 0;
+            bool is_culled_ = false;
+        }; // struct State
+
+        CullingHistory();
+        ~CullingHistory() = default;
+
+        /**
+         * @brief Prepare the history for culling the updated structures in a new frame
+         *
+         * The states are discarded when a structure was rebuilt since the previous frame.
+         *
+         * @param bounding_volume_hierarchy the hierarchy over the static hierarchy roots
+         * @param spatial_hash_grid the grid over the dynamic hierarchy roots
+         * @param is_view_unchanged is the view volume identical to the one of the previous frame?
+         * Pass false to always test every root again.
+         */
+        void BeginFrame(const BoundingVolumeHierarchy& bounding_volume_hierarchy,
+                        const SpatialHashGrid& spatial_hash_grid,
+                        bool is_view_unchanged);
+
+        /**
+         * @brief Is the volume of a hierarchy root outside the view volume?
+         * @param view_volume the view volume to cull against
+         * @param sphere the volume of the root
+         * @param volume_version the version of the volume
+         * @param state the state of the root
+         * @return true if the volume is outside the view volume. Otherwise, false.
+         */
+        [[nodiscard]] bool IsCulled(const IViewVolume& view_volume, const math::Sphere& sphere, uint32 volume_version, State& state) const;
+
+        /**
+         * @param primitive_index the index of a root in the bounding volume hierarchy
+         * @return the state of the root
+         */
+        [[nodiscard]] State& GetHierarchyState(uint32 primitive_index);
+
+        /**
+         * @param entry_index the index of a root in the spatial hash grid
+         * @return the state of the root
+         */
+        [[nodiscard]] State& GetGridState(uint32 entry_index);
+
+    private:
+        std::vector<State> hierarchy_states_;
+        std::vector<State> grid_states_;
+        uint32 hierarchy_generation_;
+        uint32 grid_generation_;
+        /**
+         * @brief Incremented whenever the view volume changes. Results are only reused within the same epoch.
+         */
+        uint32 view_epoch_;
+
+    }; // class CullingHistory
+
+} // namespace zero::render
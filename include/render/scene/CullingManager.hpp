@@ -1,8 +1,14 @@
 #pragma once
 
+#include <vector>
 #include "component/Component.hpp"
+#include "core/Span.hpp"
+#include "core/ThreadPool.hpp"
 #include "math/Box.hpp"
 #include "IViewVolume.hpp"
+#include "render/scene/BoundingVolumeHierarchy.hpp"
+#include "render/scene/CullingHistory.hpp"
+#include "render/scene/SpatialHashGrid.hpp"
 
 namespace zero
 {
@@ -18,22 +24,41 @@ namespace render
      * These functions perform different culling techniques on entities in the scene.
      *
      * Current techniques performed:
-     * - View frustum culling
+     * - Hierarchical view frustum culling
+     * - Temporal coherence of the view frustum culling results of hierarchy roots, see CullingHistory
+     * - Parallel culling of several view volumes over chunks of the spatial structures
+     * - Software occlusion culling of the camera's entities, see OcclusionCuller
+     * - Screen size culling of the camera's entities and of the shadow casters of each cascade
+     * - Range culling and relevance ranking of point and spot lights
      *
-     * Techniques that need to be implemented:
-     * - Occlusion culling - Ignore entities that are completely occluded by other entities
+     * The spatial structures only contain the roots of Transform hierarchies. The volume of a parent engulfs the volumes
+     * of its children, so a hierarchy is culled or accepted as a whole before any child is tested on its own.
      *
      */
     class CullingManager
     {
     public:
+        /**
+         * @brief The number of cascades a shadow cascade mask can hold
+         */
+        static constexpr uint32 kMaxShadowCascadeCount = 8;
+
+        /**
+         * @brief A light whose range reaches the view volume and its estimated influence on the image
+         */
+        struct RankedLight
+        {
+            Entity entity_;
+            float influence_;
+        }; // struct RankedLight
+
         CullingManager() = delete;
 
         /**
          * @brief Retrieve all entities that are renderable by the camera
          *
          * Culling Strategies Performed:
-         * - View frustum culling
+         * - Hierarchical view frustum culling
          *
          * Renderable entities without the following components will be culled:
          *     - Transform                          (Used for positioning)
@@ -42,29 +67,198 @@ namespace render
          *     - Mesh                               (Used for mesh data)
          *
          * @param camera the camera to render to
+         * @param bounding_volume_hierarchy the hierarchy over the static renderable entities, updated with the registry
+         * @param spatial_hash_grid the grid over the dynamic renderable entities, updated with the registry
          * @param registry the registry containing all the entities and their components
-         * @return a list of renderable entities
+         * @param renderable_entities the list the renderable entities are appended to
          */
-        static std::vector<Entity> GetRenderableEntities(const Camera& camera, const entt::registry& registry);
+        static void GetRenderableEntities(const Camera& camera,
+                                          const BoundingVolumeHierarchy& bounding_volume_hierarchy,
+                                          const SpatialHashGrid& spatial_hash_grid,
+                                          const entt::registry& registry,
+                                          std::vector<Entity>& renderable_entities);
 
         /**
          * @brief Retrieve all entities that emit shadows and are not culled by the given box
          *
          * Renderable entities without the following components will be culled:
          *     - Transform                          (Used for positioning)
-         *     - Material                           (Used for rendering)
+         *     - Material                           (Used for rendering, must cast shadows)
          *     - Volume                             (Used for culling)
          *     - Mesh                               (Used for mesh data)
          *
          * @param box the boundaries of the directional light
+         * @param bounding_volume_hierarchy the hierarchy over the static renderable entities, updated with the registry
+         * @param spatial_hash_grid the grid over the dynamic renderable entities, updated with the registry
+         * @param registry the registry containing all the entities and their components
+         * @param shadow_casting_entities the list the shadow casting entities are appended to
+         */
+        static void GetShadowCastingEntities(const math::Box& box,
+                                             const BoundingVolumeHierarchy& bounding_volume_hierarchy,
+                                             const SpatialHashGrid& spatial_hash_grid,
+                                             const entt::registry& registry,
+                                             std::vector<Entity>& shadow_casting_entities);
+
+        /**
+         * @brief Find the shadow cascades each entity casts shadows into, in a single pass over the entities
+         *
+         * The volume of every entity is tested against all the cascade boxes at once. Bit i of the mask of an entity
+         * is set when its volume intersects the box of cascade i and its radius is at least the minimum radius of
+         * cascade i. Entities whose material does not cast shadows get an empty mask.
+         *
+         * @param cascade_boxes the box of each cascade. At most kMaxShadowCascadeCount boxes.
+         * @param min_cascade_radii the world space radius below which an entity is too small to cast a visible shadow
+         * in each cascade. Zero keeps every entity.
+         * @param registry the registry containing all the entities and their components
+         * @param entities the shadow casting candidates, usually culled against the merged cascade boxes
+         * @param cascade_masks the mask of each entity. Resized to the number of entities.
+         * @return the number of cascade bits cleared because the entity was too small
+         */
+        static uint32 GetShadowCascadeMasks(Span<const math::Box> cascade_boxes,
+                                            Span<const float> min_cascade_radii,
+                                            const entt::registry& registry,
+                                            Span<const Entity> entities,
+                                            std::vector<uint8>& cascade_masks);
+
+        /**
+         * @brief Remove the entities whose projected bounding sphere is too small to contribute to the image
+         *
+         * The screen space radius of the bounding sphere is computed from the camera projection and the viewport.
+         * Spheres that intersect the camera plane are always kept.
+         *
+         * @param camera the camera the entities are viewed from
+         * @param min_pixel_radius the projected radius in pixels below which an entity is removed. Zero keeps every entity.
+         * @param registry the registry containing all the entities and their components
+         * @param entities the entities to filter. Removed in place without changing the order of the others.
+         * @return the number of removed entities
+         */
+        static uint32 CullSmallEntities(const Camera& camera,
+                                        float min_pixel_radius,
+                                        const entt::registry& registry,
+                                        std::vector<Entity>& entities);
+
+        /**
+         * @brief Retrieve the most influential point lights whose range reaches the view volume
+         *
+         * A light reaches as far as its attenuation stays above Constants::kMinLightIntensity.
+         * Lights without a Transform component are ignored.
+         *
+         * @param view_volume the view volume of the camera
+         * @param camera_position the world position of the camera
+         * @param registry the registry containing all the entities and their components
+         * @param max_light_count the maximum number of lights to retrieve
+         * @param ranked_lights the lights, ordered from the most to the least influential. Cleared before the lights are added.
+         * @return the number of lights whose range does not reach the view volume
+         */
+        static uint32 RankPointLights(const IViewVolume& view_volume,
+                                      const math::Vec3f& camera_position,
+                                      const entt::registry& registry,
+                                      uint32 max_light_count,
+                                      std::vector<RankedLight>& ranked_lights);
+
+        /**
+         * @brief Retrieve the most influential spot lights whose range reaches the view volume
+         *
+         * Same as RankPointLights. The cone of a spot light is ignored.
+         */
+        static uint32 RankSpotLights(const IViewVolume& view_volume,
+                                     const math::Vec3f& camera_position,
+                                     const entt::registry& registry,
+                                     uint32 max_light_count,
+                                     std::vector<RankedLight>& ranked_lights);
+
+        /**
+         * @brief Estimate the influence of a light on the image
+         *
+         * The influence is the brightness of the light scaled by the squared ratio of its range to its distance,
+         * which grows with the screen area its range covers. Lights whose range contains the camera light the
+         * whole screen and get their full brightness.
+         *
+         * @param camera_position the world position of the camera
+         * @param light_sphere the world position and range of the light
+         * @param brightness the brightness of the light
+         * @return the influence of the light
+         */
+        [[nodiscard]] static float GetLightInfluence(const math::Vec3f& camera_position, const math::Sphere& light_sphere, float brightness);
+
+        /**
+         * @brief Retrieve the visible entities that are not culled by each of the view volumes
+         *
+         * The spatial structures are split into chunks. Every chunk is culled against every view volume as a separate
+         * task on the thread pool, into its own list. The lists of each view volume are then merged in chunk order,
+         * so the results are identical to culling each view volume serially, regardless of the number of threads.
+         *
+         * @param thread_pool the thread pool to cull on
+         * @param view_volumes the view volumes to cull against
+         * @param bounding_volume_hierarchy the hierarchy over the static renderable entities, updated with the registry
+         * @param spatial_hash_grid the grid over the dynamic renderable entities, updated with the registry
+         * @param registry the registry containing all the entities and their components
+         * @param culling_histories the culling history of each view volume, prepared with CullingHistory::BeginFrame.
+         * Empty to cull without histories.
+         * @param chunk_entities the lists of the chunks. Reused across calls to avoid allocations.
+         * @param entities the list of entities of each view volume. Cleared before the entities are added.
+         */
+        static void CullParallel(ThreadPool& thread_pool,
+                                 Span<const IViewVolume* const> view_volumes,
+                                 const BoundingVolumeHierarchy& bounding_volume_hierarchy,
+                                 const SpatialHashGrid& spatial_hash_grid,
+                                 const entt::registry& registry,
+                                 Span<CullingHistory> culling_histories,
+                                 std::vector<std::vector<Entity>>& chunk_entities,
+                                 Span<std::vector<Entity>> entities);
+
+        /**
+         * @brief Is the entity the root of a culled Transform hierarchy?
+         *
+         * Roots are entities with Transform and Volume components whose parent has no Volume component.
+         *
+         * @param registry the registry containing all the entities and their components
+         * @param entity the entity with Transform and Volume components
+         * @return true if the entity is a root. Otherwise, false.
+         */
+        [[nodiscard]] static bool IsHierarchyRoot(const entt::registry& registry, Entity entity);
+
+        /**
+         * @brief Append the visible renderable entities in the Transform hierarchy of an entity that are not culled
+         *
+         * Subtrees whose volume is culled are skipped and subtrees whose volume is completely inside the
+         * view volume are accepted without testing their children.
+         *
+         * @param view_volume the view volume to cull against
+         * @param registry the registry containing all the entities and their components
+         * @param entity the entity with Transform and Volume components
+         * @param entities the list the entities are appended to
+         */
+        static void CullHierarchy(const IViewVolume& view_volume,
+                                  const entt::registry& registry,
+                                  Entity entity,
+                                  std::vector<Entity>& entities);
+
+        /**
+         * @brief Append the visible renderable entities in the Transform hierarchy of an entity that are not culled
+         *
+         * Same as CullHierarchy, for an entity whose volume is already known to not be culled by the view volume.
+         *
+         * @param view_volume the view volume to cull against
+         * @param registry the registry containing all the entities and their components
+         * @param entity the entity with Transform and Volume components
+         * @param entities the list the entities are appended to
+         */
+        static void CullVisibleHierarchy(const IViewVolume& view_volume,
+                                         const entt::registry& registry,
+                                         Entity entity,
+                                         std::vector<Entity>& entities);
+
+        /**
+         * @brief Append every visible renderable entity in the Transform hierarchy of an entity
          * @param registry the registry containing all the entities and their components
-         * @return a list of renderable entities
+         * @param entity the entity with Transform and Volume components
+         * @param entities the list the entities are appended to
          */
-        static std::vector<Entity> GetShadowCastingEntities(const math::Box& box, const entt::registry& registry);
+        static void AcceptHierarchy(const entt::registry& registry, Entity entity, std::vector<Entity>& entities);
 
     private:
-        static std::vector<Entity> GetViewableEntities(const Camera& camera, const entt::registry& registry);
-        static std::vector<Entity> CullEntities(const IViewVolume* culler, const entt::registry& registry);
+        static void AppendRenderable(const entt::registry& registry, Entity entity, std::vector<Entity>& entities);
 
     }; // class CullingManager
 
@@ -3,6 +3,7 @@
 #include "math/Vector3.hpp"
 #include "math/Sphere.hpp"
 #include "math/Box.hpp"
+#include "core/ZeroBase.hpp"
 
 namespace zero::render
 {
@@ -14,6 +15,16 @@ namespace zero::render
     {
     public:
 
+        /**
+         * @brief How a volume overlaps the view volume
+         */
+        enum class Containment
+        {
+            OUTSIDE,
+            INTERSECTS,
+            INSIDE,
+        }; // enum class Containment
+
         virtual ~IViewVolume() = default;
 
         /**
@@ -40,6 +51,18 @@ namespace zero::render
          */
         [[nodiscard]] virtual bool IsCulled(const math::Sphere& sphere) const = 0;
 
+        /**
+         * @brief Is the sphere outside the view volume?
+         *
+         * A sphere is usually culled by the same plane as in the previous frame, so that plane is tested first.
+         * View volumes without planes ignore the hint.
+         *
+         * @param sphere the sphere
+         * @param plane_hint the index of the plane to test first. Set to the index of the rejecting plane when the sphere is culled.
+         * @return true if the sphere is outside the view volume. Otherwise, false.
+         */
+        [[nodiscard]] virtual bool IsCulled(const math::Sphere& sphere, uint8& plane_hint) const = 0;
+
         /**
          * @brief Is the box outside the view volume?
          * @param box the box
@@ -47,6 +70,17 @@ namespace zero::render
          */
         [[nodiscard]] virtual bool IsCulled(const math::Box& box) const = 0;
 
+        /**
+         * @brief Classify the box against the view volume
+         *
+         * The classification is conservative. A box reported as INTERSECTS may still be outside the view volume,
+         * but a box reported as OUTSIDE or INSIDE is guaranteed to be so.
+         *
+         * @param box the box
+         * @return OUTSIDE if the box is culled, INSIDE if the box is completely inside the view volume. Otherwise, INTERSECTS.
+         */
+        [[nodiscard]] virtual Containment Classify(const math::Box& box) const = 0;
+
     }; // class IViewVolume
 
 } // namespace zero::render
\ No newline at end of file
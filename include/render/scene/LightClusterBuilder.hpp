@@ -0,0 +1,89 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include "component/Camera.hpp"
+#include "core/NonCopyable.hpp"
+#include "core/Span.hpp"
+#include "core/ThreadPool.hpp"
+#include "core/ZeroBase.hpp"
+#include "math/Sphere.hpp"
+#include "render/Constants.hpp"
+#include "render/IRenderView.hpp"
+
+namespace zero::render
+{
+
+    /**
+     * @brief Assigns the point and spot lights of a view to the clusters of the camera frustum
+     *
+     * The frustum is split into a grid of clusters, evenly on screen and logarithmically in depth. Every light is
+     * bounded by a view space sphere whose radius is the distance at which its attenuation drops below
+     * Constants::kMinLightIntensity. Spot lights are bounded by the same sphere as a point light, ignoring their cone.
+     *
+     * Every depth slice of clusters is built by its own task.
+     */
+    class LightClusterBuilder : public NonCopyable
+    {
+    public:
+        LightClusterBuilder();
+        ~LightClusterBuilder() = default;
+
+        /**
+         * @brief Assign the lights to the clusters of the camera frustum
+         *
+         * Only the first Constants::kMaxPointLights point lights and Constants::kMaxSpotLights spot lights are assigned.
+         * Light indices are dropped from the clusters once Constants::kMaxLightClusterIndexCount indices are in use.
+         *
+         * @param thread_pool the thread pool to build the depth slices on
+         * @param camera the camera the clusters are built for
+         * @param point_lights the point lights. Clusters refer to them by their index.
+         * @param spot_lights the spot lights. Clusters refer to them by their index.
+         * @param light_cluster_grid the grid to write the clusters to
+         */
+        void Build(ThreadPool& thread_pool,
+                   const Camera& camera,
+                   Span<const PointLightEntry> point_lights,
+                   Span<const SpotLightEntry> spot_lights,
+                   LightClusterGrid& light_cluster_grid);
+
+    private:
+        static constexpr uint32 kSliceClusterCount = Constants::kLightClusterCountX * Constants::kLightClusterCountY;
+
+        /**
+         * @brief The working state of a depth slice. Reused across frames.
+         */
+        struct SliceState
+        {
+            /**
+             * @brief The indices of the lights that overlap the depth range of the slice
+             */
+            ///@{
+            std::vector<uint32> point_light_candidates_;
+            std::vector<uint32> spot_light_candidates_;
+            ///@}
+            /**
+             * @brief The light indices of the clusters in the slice
+             */
+            std::vector<uint32> light_indices_;
+        }; // struct SliceState
+
+        /**
+         * @brief Assign the lights to the clusters of a depth slice
+         *
+         * The offsets of the clusters are relative to the start of the light index list of the slice.
+         */
+        void BuildSlice(uint32 slice_index, const Camera& camera, LightCluster* clusters);
+
+        /**
+         * @brief The view space bounding spheres of the point and spot lights. The z coordinate is the view depth.
+         */
+        ///@{
+        std::vector<math::Sphere> point_light_spheres_;
+        std::vector<math::Sphere> spot_light_spheres_;
+        ///@}
+        std::array<SliceState, Constants::kLightClusterCountZ> slice_states_;
+
+    }; // class LightClusterBuilder
+
+} // namespace zero::render
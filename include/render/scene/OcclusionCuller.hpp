@@ -0,0 +1,128 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include "component/Camera.hpp"
+#include "component/Component.hpp"
+#include "core/NonCopyable.hpp"
+#include "core/ThreadPool.hpp"
+#include "core/ZeroBase.hpp"
+#include "math/Box.hpp"
+#include "math/Matrix4x4.hpp"
+
+namespace zero::render
+{
+
+    /**
+     * @brief Software occlusion culling against a low resolution depth buffer
+     *
+     * The boxes of the entities with an Occluder component that cover the most area on screen are rasterized
+     * into a small depth buffer. The buffer keeps the farthest depth of every tile of pixels, so boxes behind
+     * a tile that is completely covered by occluders are rejected without reading its pixels.
+     *
+     * The bounding boxes of the remaining entities are then tested against the depth buffer. An entity is occluded
+     * when every pixel its projected box overlaps holds an occluder that is nearer than the nearest point of the box.
+     *
+     * Depths are normalized device depths, which increase with the distance to the camera for both projections.
+     */
+    class OcclusionCuller : public NonCopyable
+    {
+    public:
+        static constexpr uint32 kWidth = 256;
+        static constexpr uint32 kHeight = 128;
+        static constexpr uint32 kTileSize = 8;
+        static constexpr uint32 kMaxOccluderCount = 32;
+        /**
+         * @brief Occluders whose projected area is smaller than this fraction of the screen are ignored
+         */
+        static constexpr float kMinOccluderScreenArea = 0.002F;
+
+        OcclusionCuller();
+        ~OcclusionCuller() = default;
+
+        /**
+         * @brief Remove the entities that are hidden behind occluders
+         *
+         * Occluders are selected among the given entities and are never removed themselves.
+         *
+         * @param thread_pool the thread pool to rasterize and test on
+         * @param camera the camera the entities are viewed from
+         * @param registry the registry containing all the entities and their components
+         * @param entities the entities that passed view frustum culling. Occluded entities are removed in place
+         * without changing the order of the others.
+         * @return the number of removed entities
+         */
+        uint32 Cull(ThreadPool& thread_pool, const Camera& camera, const entt::registry& registry, std::vector<Entity>& entities);
+
+        /**
+         * @brief Rasterize the occluders among the entities into the depth buffer
+         * @param thread_pool the thread pool to rasterize on
+         * @param camera the camera the entities are viewed from
+         * @param registry the registry containing all the entities and their components
+         * @param entities the entities that passed view frustum culling
+         */
+        void RenderOccluders(ThreadPool& thread_pool, const Camera& camera, const entt::registry& registry, const std::vector<Entity>& entities);
+
+        /**
+         * @brief Is the box hidden behind the occluders rendered by the last call to RenderOccluders?
+         * @param box the world space box
+         * @return true if the box is occluded. Otherwise, false.
+         */
+        [[nodiscard]] bool IsOccluded(const math::Box& box) const;
+
+        /**
+         * @return the number of occluders rasterized by the last call to RenderOccluders
+         */
+        [[nodiscard]] uint32 GetOccluderCount() const;
+
+    private:
+        static constexpr uint32 kTileColumnCount = kWidth / kTileSize;
+        static constexpr uint32 kTileRowCount = kHeight / kTileSize;
+        static constexpr uint32 kBoxCornerCount = 8;
+        /**
+         * @brief Number of entities tested by a single task
+         */
+        static constexpr uint32 kTestBatchSize = 64;
+
+        struct OccluderEntry
+        {
+            /**
+             * @brief The index of the occluder in the list of entities
+             */
+            uint32 entity_index_;
+            float screen_area_;
+            /**
+             * @brief The corners of the occluder box. The x and y coordinates are in pixels, z is the depth.
+             */
+            std::array<math::Vec3f, kBoxCornerCount> corners_;
+        }; // struct OccluderEntry
+
+        /**
+         * @brief Project the corners of a box into screen space
+         * @return false if the box crosses the near plane. Otherwise, true.
+         */
+        static bool ProjectBox(const math::Matrix4x4& model_view_projection,
+                               const math::Box& box,
+                               std::array<math::Vec3f, kBoxCornerCount>& corners);
+        void RasterizeTileRow(uint32 tile_row);
+        void RasterizeTriangle(const math::Vec3f& v0, const math::Vec3f& v1, const math::Vec3f& v2, uint32 first_row, uint32 last_row);
+
+        math::Matrix4x4 view_projection_;
+        std::vector<OccluderEntry> occluders_;
+        /**
+         * @brief Depth of the nearest occluder at every pixel, row by row
+         */
+        std::vector<float> depth_buffer_;
+        /**
+         * @brief Depth of the farthest pixel in every tile
+         */
+        std::vector<float> tile_depths_;
+        /**
+         * @brief The visibility of each entity passed to Cull. A byte rather than a bit per entity so that
+         * concurrent tasks never write to the same memory location.
+         */
+        std::vector<uint8> visibilities_;
+
+    }; // class OcclusionCuller
+
+} // namespace zero::render
@@ -23,7 +23,9 @@ namespace zero::render
         void SetPadding(float padding) override;
         [[nodiscard]] bool IsCulled(const math::Vec3f& point) const override;
         [[nodiscard]] bool IsCulled(const math::Sphere& sphere) const override;
+        [[nodiscard]] bool IsCulled(const math::Sphere& sphere, uint8& plane_hint) const override;
         [[nodiscard]] bool IsCulled(const math::Box& box) const override;
+        [[nodiscard]] Containment Classify(const math::Box& box) const override;
         ///@}
 
         [[nodiscard]] const math::Box& GetViewBox() const;
@@ -28,7 +28,9 @@ namespace zero::render
         void SetPadding(float padding) override;
         [[nodiscard]] bool IsCulled(const math::Vec3f& point) const override;
         [[nodiscard]] bool IsCulled(const math::Sphere& sphere) const override;
+        [[nodiscard]] bool IsCulled(const math::Sphere& sphere, uint8& plane_hint) const override;
         [[nodiscard]] bool IsCulled(const math::Box& box) const override;
+        [[nodiscard]] Containment Classify(const math::Box& box) const override;
         ///@}
 
         [[nodiscard]] const math::Plane& GetLeftPlane() const;
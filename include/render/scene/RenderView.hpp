@@ -7,44 +7,77 @@
 namespace zero::render
 {
 
+    /**
+     * @brief Persistent render view whose buffers are cleared and refilled in place every frame.
+     *
+     * Buffers keep their capacity (and the string capacity of each DrawItem material) across frames,
+     * so refilling a view with a similar scene does not allocate.
+     */
     class RenderView : public IRenderView
     {
     public:
-        RenderView(const Camera& camera,
-                   const SkyDome& sky_dome,
-                   const TimeDelta& time_delta,
-                   std::shared_ptr<CascadedShadowMap> cascaded_shadow_map,
-                   std::vector<Entity>&& renderable_entities,
-                   std::array<std::vector<Entity>, Constants::kShadowCascadeCount>&& shadow_casting_entities,
-                   std::vector<DirectionalLight>&& directional_lights,
-                   std::vector<std::pair<PointLight, Transform>>&& point_lights,
-                   std::vector<std::pair<SpotLight, Transform>>&& spot_lights);
+        RenderView();
         ~RenderView() override = default;
 
+        /**
+         * @brief Clear all draw items and lights while retaining the capacity of the buffers
+         */
+        void Reset();
+
+        void SetCamera(const Camera& camera);
+        void SetSkyDome(const SkyDome& sky_dome);
+        void SetTimeDelta(const TimeDelta& time_delta);
+        void SetCascadedShadowMap(const CascadedShadowMap& cascaded_shadow_map);
+        void SetCullingStatistics(const CullingStatistics& culling_statistics);
+
+        /**
+         * @brief Add a draw item to the view
+         * @return the draw item to fill in. The item may contain data from a previous frame.
+         */
+        DrawItem& AddDrawItem();
+        void AddShadowDrawItem(uint32 cascade_index, const ShadowDrawItem& shadow_draw_item);
+        void AddDirectionalLight(const DirectionalLight& directional_light);
+        void AddPointLight(const PointLightEntry& point_light);
+        void AddSpotLight(const SpotLightEntry& spot_light);
+
+        /**
+         * @return the light cluster grid to fill in. The grid may contain data from a previous frame.
+         */
+        LightClusterGrid& GetMutableLightClusterGrid();
+
         const Camera& GetCamera() override;
         const SkyDome& GetSkyDome() override;
         const TimeDelta& GetTimeDelta() override;
 
         const CascadedShadowMap& GetCascadedShadowMap() override;
 
-        const std::vector<Entity>& GetRenderableEntities() override;
-        const std::vector<Entity>& GetShadowCastingEntities(uint32 cascade_index) override;
+        Span<const DrawItem> GetDrawItems() override;
+        Span<const ShadowDrawItem> GetShadowDrawItems(uint32 cascade_index) override;
+
+        Span<const DirectionalLight> GetDirectionalLights() override;
+        Span<const PointLightEntry> GetPointLights() override;
+        Span<const SpotLightEntry> GetSpotLights() override;
+        const LightClusterGrid& GetLightClusterGrid() override;
 
-        const std::vector<DirectionalLight>& GetDirectionalLights() override;
-        const std::vector<std::pair<PointLight, Transform>>& GetPointLights() override;
-        const std::vector<std::pair<SpotLight, Transform>>& GetSpotLights() override;
+        const CullingStatistics& GetCullingStatistics() override;
 
     private:
         Camera camera_;
         SkyDome sky_dome_;
         TimeDelta time_delta_;
-        std::shared_ptr<CascadedShadowMap> cascaded_shadow_map_;
-        std::vector<Entity> renderable_entities_;
-        std::array<std::vector<Entity>, Constants::kShadowCascadeCount> shadow_casting_entities_;
+        CascadedShadowMap cascaded_shadow_map_;
+        /**
+         * @brief Draw items are reused in place. Only the first draw_item_count_ items belong to the current frame.
+         */
+        std::vector<DrawItem> draw_items_;
+        uint32 draw_item_count_;
+        std::array<std::vector<ShadowDrawItem>, Constants::kShadowCascadeCount> shadow_draw_items_;
         std::vector<DirectionalLight> directional_lights_;
-        std::vector<std::pair<PointLight, Transform>> point_lights_;
-        std::vector<std::pair<SpotLight, Transform>> spot_lights_;
+        std::vector<PointLightEntry> point_lights_;
+        std::vector<SpotLightEntry> spot_lights_;
+        LightClusterGrid light_cluster_grid_;
+        CullingStatistics culling_statistics_;
 
     }; // class RenderView
 
-} // namespace zero
\ No newline at end of file
+} // namespace zero
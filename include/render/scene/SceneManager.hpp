@@ -2,12 +2,21 @@
 
 #include <array>
 #include <memory>
+#include <mutex>
 #include "component/Camera.hpp"
 #include "component/SkyDome.hpp"
 #include "component/Light.hpp"
 #include "component/Transform.hpp"
+#include "core/ThreadPool.hpp"
 #include "core/TimeDelta.hpp"
+#include "render/scene/BoundingVolumeHierarchy.hpp"
+#include "render/scene/CullingHistory.hpp"
+#include "render/scene/CullingManager.hpp"
+#include "render/scene/LightClusterBuilder.hpp"
+#include "render/scene/OcclusionCuller.hpp"
+#include "render/scene/OrthographicViewVolume.hpp"
 #include "render/scene/RenderView.hpp"
+#include "render/scene/SpatialHashGrid.hpp"
 #include "render/CascadedShadowMap.hpp"
 
 namespace zero::render
@@ -15,22 +24,84 @@ namespace zero::render
     class SceneManager
     {
     public:
-        SceneManager();
+        /**
+         * @brief Constructor
+         * @param render_view_count the number of persistent render views. Must be greater than the number of views in use at once.
+         * @param culling_worker_count the number of worker threads that cull the scene together with the calling thread
+         * @param reuse_unchanged_culling_results skip culling the entities whose volume did not change while the view
+         * volume did not change either
+         * @param min_screen_pixel_radius the projected radius in pixels below which entities are not drawn
+         * @param min_shadow_texel_radius the radius in shadow map texels below which entities do not cast shadows in a cascade
+         */
+        SceneManager(uint32 render_view_count,
+                     uint32 culling_worker_count,
+                     bool reuse_unchanged_culling_results,
+                     float min_screen_pixel_radius,
+                     float min_shadow_texel_radius);
         ~SceneManager() = default;
         void UpdateView(entt::registry& registry, const TimeDelta& time_delta);
-        std::unique_ptr<RenderView> GetLatestView();
+        /**
+         * @brief Take the latest view. The view remains owned by the SceneManager.
+         * @return the latest view. Must be returned with ReleaseView once it has been rendered.
+         */
+        RenderView* GetLatestView();
+        /**
+         * @brief Return a rendered view so that it can be refilled. Safe to call from any thread.
+         * @param render_view the view returned by GetLatestView
+         */
+        void ReleaseView(RenderView* render_view);
     private:
+        static constexpr uint32 kCameraViewIndex = 0;
+        static constexpr uint32 kShadowViewIndex = 1;
+        static constexpr uint32 kViewCount = 2;
+
+        [[nodiscard]] RenderView* AcquireView();
         [[nodiscard]] static const Camera& GetPrimaryCamera(const entt::registry& registry);
-        [[nodiscard]] static SkyDome GetSkyDome(const entt::registry& registry);
-        [[nodiscard]] static std::vector<DirectionalLight> GetDirectionalLights(const entt::registry& registry);
-        [[nodiscard]] static std::vector<std::pair<PointLight, Transform>> GetPointLights(const entt::registry& registry);
-        [[nodiscard]] static std::vector<std::pair<SpotLight, Transform>> GetSpotLights(const entt::registry& registry);
-        std::vector<Entity> GetRenderableEntities(const Camera& camera, const entt::registry& registry);
-        std::array<std::vector<Entity>, Constants::kShadowCascadeCount> GetShadowCastingEntities(const entt::registry& registry);
+        void ExtractSkyDome(const entt::registry& registry, RenderView* render_view) const;
+        void ExtractLights(const IViewVolume& camera_view_volume,
+                           const math::Vec3f& camera_position,
+                           const entt::registry& registry,
+                           RenderView* render_view);
+        void CullScene(const Camera& camera, const entt::registry& registry);
+        void CullScene(const IViewVolume& camera_view_volume, bool is_camera_unchanged, const entt::registry& registry);
+        void ExtractRenderables(const entt::registry& registry, RenderView* render_view) const;
+        void ExtractShadowCasters(const entt::registry& registry, RenderView* render_view) const;
 
-        std::unique_ptr<RenderView> render_view_;
+        std::vector<std::unique_ptr<RenderView>> render_views_;
+        std::vector<RenderView*> free_render_views_;
+        std::mutex free_render_views_mutex_;
+        RenderView* render_view_;
         std::shared_ptr<CascadedShadowMap> cascaded_shadow_map_;
-        std::set<Entity> renderable_cache_;
+        BoundingVolumeHierarchy bounding_volume_hierarchy_;
+        SpatialHashGrid spatial_hash_grid_;
+        OcclusionCuller occlusion_culler_;
+        LightClusterBuilder light_cluster_builder_;
+        SkyDome inactive_sky_dome_;
+        ThreadPool culling_thread_pool_;
+        /**
+         * @brief Culling state reused across frames
+         *
+         * The camera is culled with the first view volume and the shadow casters with the second, which merges
+         * the boxes of all the cascades. The cascades of each shadow caster are then found in a single pass.
+         */
+        std::array<math::Box, Constants::kShadowCascadeCount> shadow_cascade_boxes_;
+        std::vector<const IViewVolume*> view_volumes_;
+        std::vector<std::vector<Entity>> culled_chunk_entities_;
+        std::array<std::vector<Entity>, kViewCount> culled_entities_;
+        std::vector<uint8> shadow_cascade_masks_;
+        uint32 shadow_size_culled_count_;
+        std::vector<CullingManager::RankedLight> ranked_lights_;
+        uint32 light_culled_count_;
+        std::array<CullingHistory, kViewCount> culling_histories_;
+        /**
+         * @brief The view volumes culled in the previous frame, to detect unchanged views
+         */
+        math::Matrix4x4 previous_camera_view_projection_;
+        math::Box previous_shadow_box_;
+        bool has_previous_view_;
+        bool reuse_unchanged_culling_results_;
+        float min_screen_pixel_radius_;
+        float min_shadow_texel_radius_;
     }; // class SceneManager
 
-} // namespace zero
\ No newline at end of file
+} // namespace zero
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <vector>
+#include "component/Component.hpp"
+#include "core/NonCopyable.hpp"
+#include "core/ZeroBase.hpp"
+#include "math/Box.hpp"
+#include "math/Sphere.hpp"
+#include "render/scene/CullingHistory.hpp"
+#include "render/scene/IViewVolume.hpp"
+
+namespace zero::render
+{
+
+    /**
+     * @brief Loose hashed uniform grid over the volumes of dynamic Transform hierarchies
+     *
+     * The grid contains the hierarchy roots with a DynamicVolume component, see CullingManager::IsHierarchyRoot.
+     * Queries cull the hierarchy below every root that is not culled.
+     *
+     * Every entity is stored in the cell containing the center of its volume. A cell keeps a loose box that
+     * encloses the volumes of all of its entities, so entities never straddle cells. Moved volumes are
+     * relinked only when their center crosses into another cell, so the grid stays cheap to maintain when
+     * most entities move every frame.
+     *
+     * The cells are split into chunks, disjoint ranges of cells that can be queried concurrently.
+     */
+    class SpatialHashGrid : public NonCopyable
+    {
+    public:
+        static constexpr float kDefaultCellSize = 32.0F;
+
+        /**
+         * @brief Constructor
+         * @param cell_size the side length of a cell. Should be a few times the size of a typical dynamic volume.
+         */
+        explicit SpatialHashGrid(float cell_size = kDefaultCellSize);
+        ~SpatialHashGrid();
+
+        /**
+         * @brief Synchronize the grid with the dynamic hierarchy roots in the registry
+         *
+         * The registry must outlive the grid.
+         *
+         * @param registry the registry containing all the entities and their components
+         */
+        void Update(entt::registry& registry);
+
+        /**
+         * @brief Retrieve all visible entities that are not culled by the view volume
+         * @param view_volume the view volume to cull against
+         * @param registry the registry the grid was last updated with
+         * @param entities the list the entities are appended to
+         */
+        void Query(const IViewVolume& view_volume, const entt::registry& registry, std::vector<Entity>& entities) const;
+
+        /**
+         * @brief Retrieve all visible entities whose volume intersects the box
+         * @param box the box
+         * @param registry the registry the grid was last updated with
+         * @param entities the list the entities are appended to
+         */
+        void Query(const math::Box& box, const entt::registry& registry, std::vector<Entity>& entities) const;
+
+        /**
+         * @brief Retrieve all visible entities whose volume intersects the sphere
+         * @param sphere the sphere
+         * @param registry the registry the grid was last updated with
+         * @param entities the list the entities are appended to
+         */
+        void Query(const math::Sphere& sphere, const entt::registry& registry, std::vector<Entity>& entities) const;
+
+        /**
+         * @return the number of chunks the cells are split into. Changes when the grid is updated.
+         */
+        [[nodiscard]] uint32 GetChunkCount() const;
+
+        /**
+         * @brief Retrieve the visible entities of a single chunk that are not culled by the view volume
+         *
+         * Querying every chunk in order appends the same entities in the same order as Query.
+         * Chunks may be queried concurrently.
+         *
+         * @param chunk_index the chunk, less than GetChunkCount
+         * @param view_volume the view volume to cull against
+         * @param registry the registry the grid was last updated with
+         * @param culling_history the culling results of the view volume in the previous frame. May be null.
+         * @param entities the list the entities are appended to
+         */
+        void QueryChunk(uint32 chunk_index,
+                        const IViewVolume& view_volume,
+                        const entt::registry& registry,
+                        CullingHistory* culling_history,
+                        std::vector<Entity>& entities) const;
+
+        /**
+         * @return the number of hierarchy roots in the grid
+         */
+        [[nodiscard]] uint32 GetEntityCount() const;
+
+        /**
+         * @return the number of cells containing at least one entity
+         */
+        [[nodiscard]] uint32 GetCellCount() const;
+
+        /**
+         * @return incremented whenever the grid is rebuilt and the order of the roots changes
+         */
+        [[nodiscard]] uint32 GetGeneration() const;
+
+    private:
+        static constexpr uint32 kInvalidIndex = 0xFFFFFFFFU;
+        static constexpr uint32 kMinTableSize = 64;
+        static constexpr uint32 kMaxChunkCount = 16;
+
+        struct CellKey
+        {
+            int32 x_;
+            int32 y_;
+            int32 z_;
+        }; // struct CellKey
+
+        struct Cell
+        {
+            CellKey key_;
+            math::Box loose_box_;
+            /**
+             * @brief Head of the doubly linked list of entries in the cell
+             */
+            uint32 first_entry_;
+            uint32 entry_count_;
+            bool needs_refit_;
+        }; // struct Cell
+
+        struct Entry
+        {
+            Entity entity_;
+            uint32 version_;
+            math::Sphere sphere_;
+            math::Box box_;
+            uint32 cell_;
+            uint32 previous_entry_;
+            uint32 next_entry_;
+        }; // struct Entry
+
+        void Attach(entt::registry& registry);
+        void Detach();
+        void OnMembershipChanged(entt::registry& registry, Entity entity);
+        void Rebuild(const entt::registry& registry);
+        void RelinkEntries();
+        [[nodiscard]] CellKey GetCellKey(const math::Vec3f& position) const;
+        [[nodiscard]] static uint32 HashCellKey(const CellKey& key);
+        uint32 FindOrCreateCell(const CellKey& key);
+        void GrowTable();
+        void LinkEntry(uint32 entry_index, uint32 cell_index);
+        void UnlinkEntry(uint32 entry_index);
+        void MarkCellForRefit(uint32 cell_index);
+        void QueryCells(uint32 first_cell,
+                        uint32 last_cell,
+                        const IViewVolume& view_volume,
+                        const entt::registry& registry,
+                        CullingHistory* culling_history,
+                        std::vector<Entity>& entities) const;
+
+        float inverse_cell_size_;
+        entt::registry* registry_;
+        std::vector<Cell> cells_;
+        /**
+         * @brief Open addressing hash table from cell key to cell index. The size is a power of two.
+         */
+        std::vector<uint32> cell_table_;
+        std::vector<Entry> entries_;
+        std::vector<uint32> refit_cells_;
+        uint32 occupied_cell_count_;
+        uint32 generation_;
+        bool needs_rebuild_;
+
+    }; // class SpatialHashGrid
+
+} // namespace zero::render
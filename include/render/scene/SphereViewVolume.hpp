@@ -0,0 +1,38 @@
+#pragma once
+
+#include "IViewVolume.hpp"
+#include "math/Sphere.hpp"
+
+namespace zero::render
+{
+
+    /**
+     * @brief Spherical view volume, such as the area of influence of a point light
+     */
+    class SphereViewVolume : public IViewVolume
+    {
+    public:
+
+        explicit SphereViewVolume(const math::Sphere& sphere);
+        ~SphereViewVolume() override = default;
+
+        /**
+         * @see IViewVolume
+         */
+        ///@{
+        void SetPadding(float padding) override;
+        [[nodiscard]] bool IsCulled(const math::Vec3f& point) const override;
+        [[nodiscard]] bool IsCulled(const math::Sphere& sphere) const override;
+        [[nodiscard]] bool IsCulled(const math::Sphere& sphere, uint8& plane_hint) const override;
+        [[nodiscard]] bool IsCulled(const math::Box& box) const override;
+        [[nodiscard]] Containment Classify(const math::Box& box) const override;
+        ///@}
+
+        [[nodiscard]] const math::Sphere& GetSphere() const;
+
+    private:
+        math::Sphere sphere_;
+
+    }; // class SphereViewVolume
+
+} // namespace zero::render
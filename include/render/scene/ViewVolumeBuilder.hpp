@@ -2,6 +2,8 @@
 
 #include <memory>
 #include "component/Camera.hpp"
+#include "render/scene/OrthographicViewVolume.hpp"
+#include "render/scene/PerspectiveViewVolume.hpp"
 
 namespace zero::render
 {
@@ -25,6 +27,20 @@ namespace zero::render
          */
         static std::unique_ptr<IViewVolume> create(const Camera& camera);
 
+        /**
+         * @brief Create the view volume of an orthographic camera
+         * @param camera the camera the view volume is associated with
+         * @return the orthographic view volume
+         */
+        static OrthographicViewVolume CreateOrthographic(const Camera& camera);
+
+        /**
+         * @brief Create the view volume of a perspective camera
+         * @param camera the camera the view volume is associated with
+         * @return the perspective view volume
+         */
+        static PerspectiveViewVolume CreatePerspective(const Camera& camera);
+
     }; // class ViewVolumeBuilder
 
 } // namespace zero::render
\ No newline at end of file
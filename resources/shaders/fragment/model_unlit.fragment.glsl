@@ -5,9 +5,11 @@ precision highp float;
 ////////// Constants
 //////////////////////////////////////////////////
 const uint kMaxDirectionalLightCount = 4;
-const uint kMaxPointLightCount = 4;
-const uint kMaxSpotLightCount = 4;
 const uint kShadowCascadeCount = 3;
+const uint kLightClusterCountX = 16;
+const uint kLightClusterCountY = 9;
+const uint kLightClusterCountZ = 24;
+const uint kLightCountBits = 16;
 
 //////////////////////////////////////////////////
 ////////// Camera Uniforms
@@ -19,25 +21,6 @@ layout (std140) uniform Camera
     vec4 u_camera_position;
 };
 
-//////////////////////////////////////////////////
-////////// Material Uniforms
-//////////////////////////////////////////////////
-layout (std140) uniform Material
-{
-    vec4 u_diffuse_color;
-    float u_specular_intensity;
-    float u_specular_exponent;
-};
-
-//////////////////////////////////////////////////
-////////// Model Uniforms
-//////////////////////////////////////////////////
-layout (std140) uniform Model
-{
-    mat4 u_model_matrix;
-    mat4 u_normal_matrix;
-};
-
 //////////////////////////////////////////////////
 ////////// Light Uniforms
 //////////////////////////////////////////////////
@@ -80,9 +63,13 @@ struct SpotLight
 
 layout (std140) uniform LightInformation
 {
+    mat4 u_cluster_view_matrix;
+    mat4 u_cluster_projection_matrix;
     uint u_directional_light_count;
     uint u_point_light_count;
     uint u_spot_light_count;
+    float u_cluster_depth_scale;
+    float u_cluster_depth_bias;
 };
 
 layout (std140) uniform DirectionalLights
@@ -90,14 +77,28 @@ layout (std140) uniform DirectionalLights
     DirectionalLight u_directional_lights[kMaxDirectionalLightCount];
 };
 
-layout (std140) uniform PointLights
+layout (std430) readonly buffer PointLights
+{
+    PointLight u_point_lights[];
+};
+
+layout (std430) readonly buffer SpotLights
+{
+    SpotLight u_spot_lights[];
+};
+
+//////////////////////////////////////////////////
+////////// Light Cluster Buffers
+//////////////////////////////////////////////////
+layout (std430) readonly buffer LightClusters
 {
-    PointLight u_point_lights[kMaxPointLightCount];
+    // x: offset of the first light index, y: point light count (low 16 bits) and spot light count (high 16 bits)
+    uvec2 u_light_clusters[];
 };
 
-layout (std140) uniform SpotLights
+layout (std430) readonly buffer LightIndices
 {
-    SpotLight u_spot_lights[kMaxSpotLightCount];
+    uint u_light_indices[];
 };
 
 //////////////////////////////////////////////////
@@ -125,6 +126,9 @@ in VertexData
     vec3 normal;
     vec2 texture_coordinate;
     vec4 shadow_coordinates[kShadowCascadeCount];
+    flat vec4 diffuse_color;
+    flat float specular_intensity;
+    flat float specular_exponent;
 } IN;
 
 //////////////////////////////////////////////////
@@ -166,7 +170,7 @@ void main()
     vec3 vertex_to_eye = normalize(u_camera_position.xyz - IN.world_position);
 
     vec3 texture_color = texture(u_diffuse_texture, IN.texture_coordinate).xyz;
-    vec4 object_color = vec4(texture_color + u_diffuse_color.xyz, 1.0);
+    vec4 object_color = vec4(texture_color + IN.diffuse_color.xyz, 1.0);
 
     out_color = object_color * 1;
 }
\ No newline at end of file
@@ -5,9 +5,11 @@ precision highp float;
 ////////// Constants
 //////////////////////////////////////////////////
 const uint kMaxDirectionalLightCount = 4;
-const uint kMaxPointLightCount = 4;
-const uint kMaxSpotLightCount = 4;
 const uint kShadowCascadeCount = 3;
+const uint kLightClusterCountX = 16;
+const uint kLightClusterCountY = 9;
+const uint kLightClusterCountZ = 24;
+const uint kLightCountBits = 16;
 
 //////////////////////////////////////////////////
 ////////// Camera Uniforms
@@ -19,25 +21,6 @@ layout (std140) uniform Camera
     vec4 u_camera_position;
 };
 
-//////////////////////////////////////////////////
-////////// Material Uniforms
-//////////////////////////////////////////////////
-layout (std140) uniform Material
-{
-    vec4 u_diffuse_color;
-    float u_specular_intensity;
-    float u_specular_exponent;
-};
-
-//////////////////////////////////////////////////
-////////// Model Uniforms
-//////////////////////////////////////////////////
-layout (std140) uniform Model
-{
-    mat4 u_model_matrix;
-    mat4 u_normal_matrix;
-};
-
 //////////////////////////////////////////////////
 ////////// Light Uniforms
 //////////////////////////////////////////////////
@@ -80,9 +63,13 @@ struct SpotLight
 
 layout (std140) uniform LightInformation
 {
+    mat4 u_cluster_view_matrix;
+    mat4 u_cluster_projection_matrix;
     uint u_directional_light_count;
     uint u_point_light_count;
     uint u_spot_light_count;
+    float u_cluster_depth_scale;
+    float u_cluster_depth_bias;
 };
 
 layout (std140) uniform DirectionalLights
@@ -90,14 +77,28 @@ layout (std140) uniform DirectionalLights
     DirectionalLight u_directional_lights[kMaxDirectionalLightCount];
 };
 
-layout (std140) uniform PointLights
+layout (std430) readonly buffer PointLights
+{
+    PointLight u_point_lights[];
+};
+
+layout (std430) readonly buffer SpotLights
 {
-    PointLight u_point_lights[kMaxPointLightCount];
+    SpotLight u_spot_lights[];
 };
 
-layout (std140) uniform SpotLights
+//////////////////////////////////////////////////
+////////// Light Cluster Buffers
+//////////////////////////////////////////////////
+layout (std430) readonly buffer LightClusters
 {
-    SpotLight u_spot_lights[kMaxSpotLightCount];
+    // x: offset of the first light index, y: point light count (low 16 bits) and spot light count (high 16 bits)
+    uvec2 u_light_clusters[];
+};
+
+layout (std430) readonly buffer LightIndices
+{
+    uint u_light_indices[];
 };
 
 //////////////////////////////////////////////////
@@ -120,6 +121,9 @@ in VertexData
     vec3 normal;
     vec2 texture_coordinate;
     vec4 shadow_coordinates[kShadowCascadeCount];
+    flat vec4 diffuse_color;
+    flat float specular_intensity;
+    flat float specular_exponent;
 } IN;
 
 //////////////////////////////////////////////////
@@ -173,9 +177,9 @@ float diffuse_intensity)
     vec3 reflection_direction = normalize(reflect(light_to_vertex, normal));
     float specular_factor = pow(max(dot(vertex_to_eye, reflection_direction),
     0.0),
-    u_specular_exponent);
+    IN.specular_exponent);
 
-    vec4 specular_color = vec4(light_color, 1.0) * u_specular_intensity * specular_factor;
+    vec4 specular_color = vec4(light_color, 1.0) * IN.specular_intensity * specular_factor;
 
     return (ambient_color + (diffuse_color + specular_color));
 }
@@ -234,6 +238,21 @@ vec4 ComputeSpotLightColor(SpotLight light, vec3 normal, vec3 vertex_to_eye)
     return (base_light_color / attenuation) * spot_light_intensity;
 }
 
+uint GetClusterIndex()
+{
+    // Use the matrices the clusters were built with rather than the latest camera
+    vec4 view_position = u_cluster_view_matrix * vec4(IN.world_position, 1.0);
+    vec4 clip_position = u_cluster_projection_matrix * view_position;
+    vec2 screen_position = ((clip_position.xy / clip_position.w) * 0.5) + 0.5;
+    uint x = uint(clamp(screen_position.x * kLightClusterCountX, 0.0, float(kLightClusterCountX - 1)));
+    uint y = uint(clamp(screen_position.y * kLightClusterCountY, 0.0, float(kLightClusterCountY - 1)));
+
+    // Depth slices are logarithmic
+    float depth = max(-view_position.z, 0.0001);
+    uint z = uint(clamp((log(depth) * u_cluster_depth_scale) + u_cluster_depth_bias, 0.0, float(kLightClusterCountZ - 1)));
+    return (((z * kLightClusterCountY) + y) * kLightClusterCountX) + x;
+}
+
 vec4 ComputeLightColor(vec3 normal, vec3 vertex_to_eye)
 {
     vec4 lighting_color = vec4(0, 0, 0, 0);
@@ -244,16 +263,21 @@ vec4 ComputeLightColor(vec3 normal, vec3 vertex_to_eye)
         lighting_color += ComputeDirectionalLightColor(u_directional_lights[i], normal, vertex_to_eye);
     }
 
+    // Only the point and spot lights that reach the cluster of the fragment are evaluated
+    uvec2 cluster = u_light_clusters[GetClusterIndex()];
+    uint point_light_count = cluster.y & ((1u << kLightCountBits) - 1u);
+    uint spot_light_count = cluster.y >> kLightCountBits;
+
     // Compute Point Light Colors
-    for (int i = 0; (i < kMaxPointLightCount) && (i < u_point_light_count); ++i)
+    for (uint i = 0; i < point_light_count; ++i)
     {
-        lighting_color += ComputePointLightColor(u_point_lights[i], normal, vertex_to_eye);
+        lighting_color += ComputePointLightColor(u_point_lights[u_light_indices[cluster.x + i]], normal, vertex_to_eye);
     }
 
     // Compute Spot Light Colors
-    for (int i = 0; (i < kMaxSpotLightCount) && (i < u_spot_light_count); ++i)
+    for (uint i = 0; i < spot_light_count; ++i)
     {
-        lighting_color += ComputeSpotLightColor(u_spot_lights[i], normal, vertex_to_eye);
+        lighting_color += ComputeSpotLightColor(u_spot_lights[u_light_indices[cluster.x + point_light_count + i]], normal, vertex_to_eye);
     }
 
     return lighting_color;
@@ -267,7 +291,7 @@ void main()
     vec3 normal = normalize(IN.normal);
     vec3 vertex_to_eye = normalize(u_camera_position.xyz - IN.world_position);
 
-    vec4 object_color = vec4(u_diffuse_color.xyz, 1.0);
+    vec4 object_color = vec4(IN.diffuse_color.xyz, 1.0);
     vec4 light_color = ComputeLightColor(normal, vertex_to_eye);
 
     out_color = object_color * light_color * 1;
@@ -16,6 +16,9 @@ in VertexData
     vec3 normal;
     vec2 texture_coordinate;
     vec4 shadow_coordinates[kShadowCascadeCount];
+    flat vec4 diffuse_color;
+    flat float specular_intensity;
+    flat float specular_exponent;
 } IN;
 
 //////////////////////////////////////////////////
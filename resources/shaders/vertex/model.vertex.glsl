@@ -1,4 +1,5 @@
 #version 450
+#extension GL_ARB_shader_draw_parameters : require
 precision highp float;
 
 //////////////////////////////////////////////////
@@ -17,12 +18,20 @@ layout (std140) uniform Camera
 };
 
 //////////////////////////////////////////////////
-////////// Model Uniforms
+////////// Instance Buffers
 //////////////////////////////////////////////////
-layout (std140) uniform Model
+struct InstanceData
 {
-    mat4 u_model_matrix;
-    mat4 u_normal_matrix;
+    mat4 model_matrix;
+    mat4 normal_matrix;
+    vec4 diffuse_color;
+    float specular_intensity;
+    float specular_exponent;
+};
+
+layout (std430) readonly buffer Instances
+{
+    InstanceData u_instances[];
 };
 
 //////////////////////////////////////////////////
@@ -51,6 +60,9 @@ out VertexData
     vec3 normal;
     vec2 texture_coordinate;
     vec4 shadow_coordinates[kShadowCascadeCount];
+    flat vec4 diffuse_color;
+    flat float specular_intensity;
+    flat float specular_exponent;
 } OUT;
 
 //////////////////////////////////////////////////
@@ -58,11 +70,14 @@ out VertexData
 //////////////////////////////////////////////////
 void main()
 {
+    // The base instance is not part of gl_InstanceID
+    InstanceData instance = u_instances[gl_BaseInstanceARB + gl_InstanceID];
+
     // Compute world space position
-    vec4 world_position_4D = (u_model_matrix * vec4(in_position, 1));
+    vec4 world_position_4D = (instance.model_matrix * vec4(in_position, 1));
 
     // Extract normal transformation
-    mat3 normal_matrix_3 = mat3(u_normal_matrix[0].xyz, u_normal_matrix[1].xyz, u_normal_matrix[2].xyz);
+    mat3 normal_matrix_3 = mat3(instance.normal_matrix[0].xyz, instance.normal_matrix[1].xyz, instance.normal_matrix[2].xyz);
 
     vec4 view_position = u_view_matrix * world_position_4D;
     gl_Position = (u_projection_matrix * view_position);
@@ -76,4 +91,7 @@ void main()
         OUT.shadow_coordinates[i] = u_csm_texture_matrices[i] * world_position_4D;
     }
     OUT.view_position = view_position.xyz;
+    OUT.diffuse_color = instance.diffuse_color;
+    OUT.specular_intensity = instance.specular_intensity;
+    OUT.specular_exponent = instance.specular_exponent;
 }
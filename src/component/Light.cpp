@@ -1,4 +1,5 @@
 #include "component/Light.hpp"
+#include <limits>
 
 namespace zero
 {
@@ -10,6 +11,25 @@ Attenuation::Attenuation()
 {
 }
 
+float Attenuation::GetRange(float min_intensity) const
+{
+    // Solve constant + (linear * distance) + (quadratic * distance * distance) = 1 / min_intensity
+    const float target = (1.0F / min_intensity) - constant_;
+    if (target <= 0.0F)
+    {
+        return 0.0F;
+    }
+    if (quadratic_ > 0.0F)
+    {
+        return (-linear_ + math::Sqrt((linear_ * linear_) + (4.0F * quadratic_ * target))) / (2.0F * quadratic_);
+    }
+    if (linear_ > 0.0F)
+    {
+        return target / linear_;
+    }
+    return std::numeric_limits<float>::infinity();
+}
+
 DirectionalLight::DirectionalLight()
 : Component()
 , color_(math::Vec3f::One())
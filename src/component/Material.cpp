@@ -12,6 +12,7 @@ Material::Material()
 , two_sided_(false)
 , wireframe_enabled_(false)
 , visible_(true)
+, casts_shadows_(true)
 , texture_map_()
 , shaders_()
 , texture_id_(0)
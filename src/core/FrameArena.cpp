@@ -0,0 +1,100 @@
+#include "core/FrameArena.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+
+namespace zero
+{
+
+LinearArena::LinearArena(std::size_t capacity)
+: blocks_()
+, offset_(0)
+, allocated_bytes_(0)
+{
+    AddBlock(capacity);
+}
+
+void* LinearArena::Allocate(std::size_t size, std::size_t alignment)
+{
+    assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+    Block* block = &blocks_.back();
+    std::size_t aligned_offset = AlignOffset(*block, offset_, alignment);
+    if (aligned_offset + size > block->size_)
+    {
+        // Overflow. Continue in a new block that fits the allocation.
+        AddBlock(std::max(block->size_, size + alignment));
+        block = &blocks_.back();
+        aligned_offset = AlignOffset(*block, 0, alignment);
+    }
+
+    offset_ = aligned_offset + size;
+    allocated_bytes_ += size;
+    return block->memory_.get() + aligned_offset;
+}
+
+void LinearArena::Reset()
+{
+    if (blocks_.size() > 1)
+    {
+        // Merge the overflow blocks so the next frame fits in a single block
+        const std::size_t capacity = GetCapacity();
+        blocks_.clear();
+        AddBlock(capacity);
+    }
+    offset_ = 0;
+    allocated_bytes_ = 0;
+}
+
+std::size_t LinearArena::GetAllocatedBytes() const
+{
+    return allocated_bytes_;
+}
+
+std::size_t LinearArena::GetCapacity() const
+{
+    std::size_t capacity = 0;
+    for (const Block& block : blocks_)
+    {
+        capacity += block.size_;
+    }
+    return capacity;
+}
+
+std::size_t LinearArena::AlignOffset(const Block& block, std::size_t offset, std::size_t alignment)
+{
+    const auto address = reinterpret_cast<std::uintptr_t>(block.memory_.get()) + offset;
+    const std::uintptr_t aligned_address = (address + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+    return offset + static_cast<std::size_t>(aligned_address - address);
+}
+
+void LinearArena::AddBlock(std::size_t size)
+{
+    blocks_.push_back(Block{std::make_unique<std::byte[]>(size), size});
+    offset_ = 0;
+}
+
+FrameArena::FrameArena(uint32 buffer_count, std::size_t capacity)
+: arenas_()
+, current_index_(0)
+{
+    buffer_count = buffer_count == 0 ? 1 : buffer_count;
+    arenas_.reserve(buffer_count);
+    for (uint32 i = 0; i < buffer_count; ++i)
+    {
+        arenas_.push_back(std::make_unique<LinearArena>(capacity));
+    }
+}
+
+void FrameArena::NextFrame()
+{
+    current_index_ = (current_index_ + 1) % static_cast<uint32>(arenas_.size());
+    arenas_[current_index_]->Reset();
+}
+
+LinearArena* FrameArena::GetArena()
+{
+    return arenas_[current_index_].get();
+}
+
+} // namespace zero
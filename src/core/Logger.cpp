@@ -36,25 +36,28 @@ Logger::Logger()
 
 void Logger::SetFilter(Level level)
 {
-    std::lock_guard<std::mutex> guard{mutex_};
     severity_filter_ = level;
 }
 
 Logger::Level Logger::GetFilter()
 {
-    std::lock_guard<std::mutex> guard{mutex_};
     return severity_filter_;
 }
 
-void Logger::Log(Level level, std::string_view title, std::string_view message)
+bool Logger::IsEnabled(Level level)
 {
-    std::lock_guard<std::mutex> guard{mutex_};
+    return static_cast<int32_t>(level) <= static_cast<int32_t>(severity_filter_.load());
+}
 
-    if (static_cast<int32_t>(level) > static_cast<int32_t>(severity_filter_))
+void Logger::Log(Level level, std::string_view title, std::string_view message)
+{
+    if (!IsEnabled(level))
     {
         return;
     }
 
+    std::lock_guard<std::mutex> guard{mutex_};
+
     time_t raw_time{};
     char buffer[64] = { 0 };
     time(&raw_time);
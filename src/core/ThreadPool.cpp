@@ -0,0 +1,113 @@
+#include "core/ThreadPool.hpp"
+
+namespace zero
+{
+
+ThreadPool::ThreadPool(uint32 worker_count)
+: workers_()
+, mutex_()
+, work_condition_()
+, done_condition_()
+, task_function_(nullptr)
+, task_context_(nullptr)
+, task_count_(0)
+, next_task_(0)
+, batch_(0)
+, active_worker_count_(0)
+, stop_(false)
+{
+    workers_.reserve(worker_count);
+    for (uint32 i = 0; i < worker_count; ++i)
+    {
+        workers_.emplace_back(&ThreadPool::WorkerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    work_condition_.notify_all();
+    for (std::thread& worker : workers_)
+    {
+        worker.join();
+    }
+}
+
+uint32 ThreadPool::GetWorkerCount() const
+{
+    return static_cast<uint32>(workers_.size());
+}
+
+void ThreadPool::Run(uint32 task_count, TaskFunction task_function, const void* task_context)
+{
+    if (workers_.empty() || task_count <= 1)
+    {
+        for (uint32 task_index = 0; task_index < task_count; ++task_index)
+        {
+            task_function(task_context, task_index);
+        }
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        // A worker that woke up late for the previous batch may still be leaving it
+        done_condition_.wait(lock, [this]() { return active_worker_count_ == 0; });
+        task_function_ = task_function;
+        task_context_ = task_context;
+        task_count_ = task_count;
+        next_task_.store(0, std::memory_order_relaxed);
+        ++batch_;
+    }
+    work_condition_.notify_all();
+
+    ExecuteTasks(task_count, task_function, task_context);
+
+    // Every task has been claimed. Wait for the workers to finish the tasks they claimed.
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_condition_.wait(lock, [this]() { return active_worker_count_ == 0; });
+}
+
+void ThreadPool::WorkerLoop()
+{
+    uint64 seen_batch = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        work_condition_.wait(lock, [this, seen_batch]() { return stop_ || batch_ != seen_batch; });
+        if (stop_)
+        {
+            return;
+        }
+        seen_batch = batch_;
+        const uint32 task_count = task_count_;
+        const TaskFunction task_function = task_function_;
+        const void* task_context = task_context_;
+        ++active_worker_count_;
+
+        lock.unlock();
+        ExecuteTasks(task_count, task_function, task_context);
+        lock.lock();
+
+        --active_worker_count_;
+        if (active_worker_count_ == 0)
+        {
+            done_condition_.notify_all();
+        }
+    }
+}
+
+void ThreadPool::ExecuteTasks(uint32 task_count, TaskFunction task_function, const void* task_context)
+{
+    for (uint32 task_index = next_task_.fetch_add(1, std::memory_order_relaxed);
+         task_index < task_count;
+         task_index = next_task_.fetch_add(1, std::memory_order_relaxed))
+    {
+        task_function(task_context, task_index);
+    }
+}
+
+} // namespace zero
@@ -38,6 +38,9 @@ bool TransformSystem::AddChild(entt::registry& registry, Entity parent, Entity c
 
 	parent_transform.children_.push_back(child);
 	child_transform.parent_ = parent;
+	// Notify observers of the Transform hierarchy
+	registry.patch<Transform>(child);
+	RefitAncestorVolumes(registry, child);
 	return true;
 }
 
@@ -50,6 +53,12 @@ void TransformSystem::RemoveChild(entt::registry& registry, Entity parent, Entit
 		parent_transform.children_.end()
 	);
 	child_transform.parent_ = NullEntity;
+	// Notify observers of the Transform hierarchy
+	registry.patch<Transform>(child);
+	if (RefitVolume(registry, parent))
+	{
+		RefitAncestorVolumes(registry, parent);
+	}
 }
 
 void TransformSystem::DestroyEntity(entt::registry& registry, const Entity entity)
@@ -111,6 +120,7 @@ void TransformSystem::UpdateTransform(entt::registry& registry, const Entity roo
 		entity_volume.Transform(transformation);
 	};
 	TraverseTransformHierarchy(registry, root, callback);
+	RefitAncestorVolumes(registry, root);
 }
 
 void TransformSystem::Translate(entt::registry& registry, Entity root, const math::Vec3f& translation)
@@ -145,6 +155,7 @@ void TransformSystem::Translate(entt::registry& registry, Entity root, const mat
 		entity_volume.Translate(translation);
 	};
 	TraverseTransformHierarchy(registry, root, callback);
+	RefitAncestorVolumes(registry, root);
 }
 
 void TransformSystem::Rotate(entt::registry& registry, Entity root, const math::Quaternion& rotation)
@@ -179,6 +190,7 @@ void TransformSystem::Rotate(entt::registry& registry, Entity root, const math::
 		entity_volume.Rotate(rotation);
 	};
 	TraverseTransformHierarchy(registry, root, callback);
+	RefitAncestorVolumes(registry, root);
 }
 
 void TransformSystem::Scale(entt::registry& registry, Entity root, const math::Vec3f& scale)
@@ -213,6 +225,7 @@ void TransformSystem::Scale(entt::registry& registry, Entity root, const math::V
 		entity_volume.Scale(scale);
 	};
 	TraverseTransformHierarchy(registry, root, callback);
+	RefitAncestorVolumes(registry, root);
 }
 
 void TransformSystem::TraverseTransformHierarchy(entt::registry& registry,
@@ -239,4 +252,39 @@ void TransformSystem::TraverseTransformHierarchy(entt::registry& registry,
 	}
 }
 
+void TransformSystem::RefitAncestorVolumes(entt::registry& registry, Entity entity)
+{
+	Entity parent = registry.get<Transform>(entity).parent_;
+	while (parent != NullEntity && RefitVolume(registry, parent))
+	{
+		parent = registry.get<Transform>(parent).parent_;
+	}
+}
+
+bool TransformSystem::RefitVolume(entt::registry& registry, Entity entity)
+{
+	Volume* volume = registry.try_get<Volume>(entity);
+	if (volume == nullptr)
+	{
+		return false;
+	}
+
+	math::Sphere bounding_volume = volume->mesh_volume_;
+	for (Entity child : registry.get<Transform>(entity).children_)
+	{
+		const Volume* child_volume = registry.try_get<Volume>(child);
+		if (child_volume != nullptr)
+		{
+			bounding_volume.Merge(child_volume->bounding_volume_);
+		}
+	}
+	if (bounding_volume == volume->bounding_volume_)
+	{
+		return false;
+	}
+	volume->bounding_volume_ = bounding_volume;
+	++volume->version_;
+	return true;
+}
+
 } // namespace zero
\ No newline at end of file
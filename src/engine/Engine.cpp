@@ -19,6 +19,16 @@ Engine::Engine(EngineConfig  engine_config)
 , entity_instantiator_(std::make_unique<EntityInstantiator>(engine_core_->GetRegistry(), render_system_.get()))
 , is_done_(false)
 {
+    if (engine_config_.late_camera_latch_)
+    {
+        render_system_->SetLateLatchCallback([this]()
+        {
+            for (const auto& system : game_systems_)
+            {
+                system->LatchCamera();
+            }
+        });
+    }
     LOG_VERBOSE(kTitle, "Engine instance constructed");
 }
 
@@ -44,13 +54,9 @@ void Engine::Tick()
         system->PreUpdate();
     }
 
-    TickEvents();
-
-    render_system_->Update(time_delta_);
-    animation_system_->Update(time_delta_);
-    for (const auto& system : game_systems_)
+    for (const TickPhase tick_phase : engine_config_.tick_phases_)
     {
-        system->Update(time_delta_);
+        RunTickPhase(tick_phase);
     }
 
     render_system_->PostUpdate();
@@ -82,9 +88,25 @@ EngineCore* Engine::GetEngineCore() const
     return engine_core_.get();
 }
 
+float Engine::GetInputLatency() const
+{
+    return render_system_->GetInputLatency();
+}
+
+uint32 Engine::GetFilteredStateChangeCount() const
+{
+    return render_system_->GetFilteredStateChangeCount();
+}
+
+render::GeometryArena::Statistics Engine::GetGeometryStatistics() const
+{
+    return render_system_->GetGeometryStatistics();
+}
+
 void Engine::TickEvents()
 {
     EventBus& event_bus = engine_core_->GetEventBus();
+    time_delta_.input_poll_time_ = std::chrono::steady_clock::now();
     SDL_Event event{};
     while (SDL_PollEvent(&event))
     {
@@ -96,4 +118,30 @@ void Engine::TickEvents()
     }
 }
 
+void Engine::RunTickPhase(TickPhase tick_phase)
+{
+    switch (tick_phase)
+    {
+        case TickPhase::INPUT:
+        {
+            TickEvents();
+            break;
+        }
+        case TickPhase::SIMULATION:
+        {
+            animation_system_->Update(time_delta_);
+            for (const auto& system : game_systems_)
+            {
+                system->Update(time_delta_);
+            }
+            break;
+        }
+        case TickPhase::RENDER:
+        {
+            render_system_->Update(time_delta_);
+            break;
+        }
+    }
+}
+
 } // namespace zero
\ No newline at end of file
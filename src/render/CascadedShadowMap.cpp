@@ -1,4 +1,5 @@
 #include "render/CascadedShadowMap.hpp"
+#include "render/Constants.hpp"
 
 namespace zero::render
 {
@@ -67,12 +68,6 @@ void CascadedShadowMap::UpdateCascadeSplits(const Camera& camera)
 
 void CascadedShadowMap::UpdateMatrices(const Camera& camera, const DirectionalLight& directional_light)
 {
-    // Create cascade split list including initial (0.0F) split
-    std::vector<float> boundaries{};
-    boundaries.reserve(cascade_count_ + 1);
-    boundaries.push_back(0.0F);
-    boundaries.insert(boundaries.end(), cascade_splits_.begin(), cascade_splits_.end());
-
     // Reset world bounding boxes
     float max = std::numeric_limits<float>::max();
     float min = -max;
@@ -86,8 +81,9 @@ void CascadedShadowMap::UpdateMatrices(const Camera& camera, const DirectionalLi
     math::Matrix4x4 inverse_view_projection_matrix = (camera.GetProjectionMatrix() * camera.GetViewMatrix()).Inverse();
     for (uint32 cascade_index = 0; cascade_index < cascade_count_; ++cascade_index)
     {
-        float near_split = boundaries[cascade_index];
-        float far_split = boundaries[cascade_index + 1];
+        // The first cascade starts at the near clip (0.0F)
+        float near_split = cascade_index == 0 ? 0.0F : cascade_splits_[cascade_index - 1];
+        float far_split = cascade_splits_[cascade_index];
 
         math::Box& world_bounding_box = world_bounding_boxes_[cascade_index];
 
@@ -201,31 +197,40 @@ uint32 CascadedShadowMap::GetCascadeCount() const
     return cascade_count_;
 }
 
-std::vector<math::Matrix4x4> CascadedShadowMap::GetLightViewMatrices() const
+const std::vector<math::Matrix4x4>& CascadedShadowMap::GetLightViewMatrices() const
 {
     return light_view_matrices_;
 }
 
-std::vector<math::Matrix4x4> CascadedShadowMap::GetProjectionMatrices() const
+const std::vector<math::Matrix4x4>& CascadedShadowMap::GetProjectionMatrices() const
 {
     return projection_matrices_;
 }
 
-std::vector<math::Matrix4x4> CascadedShadowMap::GetTextureMatrices() const
+const std::vector<math::Matrix4x4>& CascadedShadowMap::GetTextureMatrices() const
 {
     return texture_matrices_;
 }
 
-std::vector<math::Box> CascadedShadowMap::GetWorldBoundingBoxes() const
+const std::vector<math::Box>& CascadedShadowMap::GetWorldBoundingBoxes() const
 {
     return world_bounding_boxes_;
 }
 
-std::vector<float> CascadedShadowMap::GetViewFarBounds() const
+const std::vector<float>& CascadedShadowMap::GetViewFarBounds() const
 {
     return view_far_bounds_;
 }
 
+float CascadedShadowMap::GetTexelSize(uint32 cascade_index) const
+{
+    // The projection scales light space units into the [-1, 1] range covered by the shadow map
+    const math::Matrix4x4& projection_matrix = projection_matrices_[cascade_index];
+    const float texel_width = 2.0F / (math::Abs(projection_matrix[0][0]) * static_cast<float>(Constants::kShadowMapWidth));
+    const float texel_height = 2.0F / (math::Abs(projection_matrix[1][1]) * static_cast<float>(Constants::kShadowMapHeight));
+    return math::Min(texel_width, texel_height);
+}
+
 const math::Vec3f& CascadedShadowMap::GetLightDirection() const
 {
     return light_direction_;
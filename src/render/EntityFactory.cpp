@@ -19,20 +19,21 @@ Entity EntityFactory::InstantiateModel(entt::registry& registry, const std::shar
 Entity EntityFactory::InstantiateNode(entt::registry& registry, const std::shared_ptr<Node>& node, const std::vector<GeometryData>& geometry_data_list, Entity parent_entity)
 {
     Entity entity = registry.create();
+    // The parent components must exist before children are attached to it
+    registry.emplace<Volume>(entity, node->volume_);
+    registry.emplace<Transform>(entity, Transform::FromMatrix4x4(node->transform_));
     for (const std::shared_ptr<Node>& child_node: node->child_nodes_)
     {
         InstantiateNode(registry, child_node, geometry_data_list, entity);
     }
-    registry.emplace<Volume>(entity, node->volume_);
-    registry.emplace<Transform>(entity, Transform::FromMatrix4x4(node->transform_));
 
     if (node->geometry_indices_.size() == 1)
     {
         // Directly assign Mesh and Material components  to entity
-        const GeometryData& geometry_data = geometry_data_list[0];
+        const GeometryData& geometry_data = geometry_data_list[node->geometry_indices_[0]];
         registry.emplace<Material>(entity, *geometry_data.material_);
         Mesh& mesh = registry.emplace<Mesh>(entity);
-        mesh.mesh_id_ = geometry_data_list[0].geometry_id_;
+        mesh.mesh_id_ = geometry_data.geometry_id_;
     }
     else
     {
@@ -46,6 +47,7 @@ Entity EntityFactory::InstantiateNode(entt::registry& registry, const std::share
             Mesh& geometry_mesh = registry.emplace<Mesh>(geometry_entity);
             geometry_mesh.mesh_id_ = geometry_data.geometry_id_;
             registry.emplace<Volume>(geometry_entity, geometry_data.volume_);
+            registry.emplace<Transform>(geometry_entity, Transform::FromMatrix4x4(node->transform_));
             TransformSystem::AddChild(registry, entity, geometry_entity);
         }
     }
@@ -117,6 +119,7 @@ Entity EntityFactory::InstantiatePrimitive(entt::registry& registry, uint32 mesh
         }
     }
 
+    volume.mesh_volume_ = volume.bounding_volume_;
     registry.emplace<Volume>(entity, volume);
     // Use default shaders
     registry.emplace<Material>(entity, Material{});
@@ -1,5 +1,6 @@
 #include "render/RenderSystem.hpp"
 #include "render/EntityFactory.hpp"
+#include "render/renderer/null/NullRenderHardware.hpp"
 #include "render/renderer/opengl/GLRenderHardware.hpp"
 #include "component/Camera.hpp"
 #include "component/Mesh.hpp"
@@ -10,14 +11,35 @@ namespace zero::render
 
 const char* RenderSystem::kTitle = "RenderSystem";
 
+std::unique_ptr<IRenderHardware> CreateRenderHardware(GraphicsAPI api)
+{
+    switch (api)
+    {
+        case GraphicsAPI::NONE:
+            return std::make_unique<NullRenderHardware>();
+        default:
+            return std::make_unique<GLRenderHardware>();
+    }
+}
+
 RenderSystem::RenderSystem(EngineCore* engine_core, const RenderSystemConfig& config)
 : zero::System(engine_core)
 , config_(config)
-, rhi_(std::make_unique<GLRenderHardware>())
+, rhi_(CreateRenderHardware(config.window_config_.api_))
 , window_(std::make_unique<Window>(config.window_config_))
-, rendering_pipeline_(std::make_unique<RenderingPipeline>())
-, scene_manager_(std::make_unique<SceneManager>())
+, rendering_pipeline_(std::make_unique<RenderingPipeline>(config.multithreaded_rendering_ ? config.max_frames_in_flight_ : 1,
+                                                          config.sort_worker_count_))
+, scene_manager_(std::make_unique<SceneManager>(config.multithreaded_rendering_ ? config.max_frames_in_flight_ + 1 : 1,
+                                                config.culling_worker_count_,
+                                                config.reuse_unchanged_culling_results_,
+                                                config.min_screen_pixel_radius_,
+                                                config.min_shadow_texel_radius_))
 , model_cache_()
+, late_latch_callback_()
+, released_mesh_ids_()
+, render_thread_(config.multithreaded_rendering_ ? std::make_unique<RenderThread>(config.max_frames_in_flight_) : nullptr)
+, input_latency_(0.0F)
+, filtered_state_change_count_(0)
 {
     LOG_VERBOSE(kTitle, "RenderSystem instance constructed");
 }
@@ -34,6 +56,8 @@ void RenderSystem::Initialize()
 
     LOG_VERBOSE(kTitle, "Initializing rendering pipeline");
     rendering_pipeline_->Initialize(rhi_.get(), GetCore()->GetAssetManager());
+
+    GetCore()->GetRegistry().on_destroy<Mesh>().connect<&RenderSystem::OnMeshDestroyed>(*this);
 }
 
 void RenderSystem::PreUpdate()
@@ -42,30 +66,42 @@ void RenderSystem::PreUpdate()
 
 void RenderSystem::Update(const TimeDelta& time_delta)
 {
+    ReleaseMeshes();
+
     if (!ContainsCamera())
     {
         // Do not render if a camera does not exist
         return;
     }
 
+    // Refresh the camera before the view is captured, so culling, shadows, light clusters, and draws agree on it
+    if (late_latch_callback_)
+    {
+        late_latch_callback_();
+    }
+
     LOG_VERBOSE(kTitle, "Generating IRenderView");
     scene_manager_->UpdateView(GetCore()->GetRegistry(), time_delta);
-    std::unique_ptr<IRenderView> render_view = scene_manager_->GetLatestView();
+    RenderView* render_view = scene_manager_->GetLatestView();
 
-    LOG_VERBOSE(kTitle, "Generating Draw Calls");
-    GenerateDrawCalls(render_view.get());
-
-    LOG_VERBOSE(kTitle, "Sorting Draw Calls");
-    rendering_pipeline_->Sort();
-
-    LOG_VERBOSE(kTitle, "Executing Draw Calls");
-    rendering_pipeline_->Render(render_view.get(), rhi_.get());
-
-    LOG_VERBOSE(kTitle, "Swapping buffers");
-    window_->SwapBuffers();
-
-    LOG_VERBOSE(kTitle, "Clearing Render Queue");
-    rendering_pipeline_->ClearRenderCalls();
+    if (render_thread_)
+    {
+        if (!render_thread_->IsRunning())
+        {
+            StartRenderThread();
+        }
+        // Blocks while the maximum number of frames are in flight
+        render_thread_->Submit([this, render_view]()
+        {
+            RenderFrame(render_view);
+            scene_manager_->ReleaseView(render_view);
+        });
+    }
+    else
+    {
+        RenderFrame(render_view);
+        scene_manager_->ReleaseView(render_view);
+    }
 }
 
 void RenderSystem::PostUpdate()
@@ -74,6 +110,15 @@ void RenderSystem::PostUpdate()
 
 void RenderSystem::ShutDown()
 {
+    GetCore()->GetRegistry().on_destroy<Mesh>().disconnect<&RenderSystem::OnMeshDestroyed>(*this);
+    released_mesh_ids_.clear();
+
+    if (render_thread_ && render_thread_->IsRunning())
+    {
+        LOG_VERBOSE(kTitle, "Stopping render thread");
+        StopRenderThread();
+    }
+
     LOG_VERBOSE(kTitle, "Clearing model cache");
     model_cache_.clear();
 
@@ -102,7 +147,22 @@ Entity RenderSystem::CreateModelInstance(const std::string& model_filename, cons
 Entity RenderSystem::CreatePrimitiveInstance(const PrimitiveInstance& primitive) const
 {
     LOG_VERBOSE(kTitle, "Instantiating a new primitive");
-    return EntityFactory::InstantiatePrimitive(GetCore()->GetRegistry(), rendering_pipeline_->GetPrimitiveMeshId(rhi_.get(), primitive), primitive);
+    uint32 mesh_id = 0;
+    const auto load_primitive_mesh = [this, &primitive, &mesh_id]()
+    {
+        mesh_id = rendering_pipeline_->GetPrimitiveMeshId(rhi_.get(), primitive);
+    };
+
+    // GPU resources must be created by the thread that owns the graphics context
+    if (render_thread_ && render_thread_->IsRunning())
+    {
+        render_thread_->Execute(load_primitive_mesh);
+    }
+    else
+    {
+        load_primitive_mesh();
+    }
+    return EntityFactory::InstantiatePrimitive(GetCore()->GetRegistry(), mesh_id, primitive);
 }
 
 Entity RenderSystem::CreateLightInstance(const Light& light, Entity entity) const
@@ -111,6 +171,41 @@ Entity RenderSystem::CreateLightInstance(const Light& light, Entity entity) cons
     return EntityFactory::InstantiateLight(GetCore()->GetRegistry(), light, entity);
 }
 
+void RenderSystem::SetLateLatchCallback(std::function<void()> late_latch_callback)
+{
+    late_latch_callback_ = std::move(late_latch_callback);
+}
+
+float RenderSystem::GetInputLatency() const
+{
+    return input_latency_;
+}
+
+uint32 RenderSystem::GetFilteredStateChangeCount() const
+{
+    return filtered_state_change_count_;
+}
+
+GeometryArena::Statistics RenderSystem::GetGeometryStatistics() const
+{
+    GeometryArena::Statistics geometry_statistics{};
+    const auto read_geometry_statistics = [this, &geometry_statistics]()
+    {
+        geometry_statistics = rhi_->GetGeometryStatistics();
+    };
+
+    // The geometry buffers are allocated by the thread that owns the graphics context
+    if (render_thread_ && render_thread_->IsRunning())
+    {
+        render_thread_->Execute(read_geometry_statistics);
+    }
+    else
+    {
+        read_geometry_statistics();
+    }
+    return geometry_statistics;
+}
+
 void RenderSystem::LoadModels()
 {
     AssetManager& asset_manager = GetCore()->GetAssetManager();
@@ -137,37 +232,102 @@ void RenderSystem::LoadModels()
     }
 }
 
-void RenderSystem::GenerateDrawCalls(IRenderView* render_view) const
+void RenderSystem::RenderFrame(IRenderView* render_view)
 {
-    entt::registry& registry = GetCore()->GetRegistry();
-    const auto drawable_view = registry.view<const Transform, const Material, const Mesh, const Volume>();
+    LOG_VERBOSE(kTitle, "Generating Draw Calls");
+    GenerateDrawCalls(render_view);
+
+    LOG_VERBOSE(kTitle, "Sorting Draw Calls");
+    rendering_pipeline_->Sort();
 
+    LOG_VERBOSE(kTitle, "Executing Draw Calls");
+    rendering_pipeline_->Render(render_view, rhi_.get());
+
+    LOG_VERBOSE(kTitle, "Swapping buffers");
+    window_->SwapBuffers();
+
+    // Latency between the most recent input poll and the presentation of this frame
+    const std::chrono::duration<float, std::milli> input_latency = std::chrono::steady_clock::now() - render_view->GetTimeDelta().input_poll_time_;
+    input_latency_ = input_latency.count();
+
+    filtered_state_change_count_ = rhi_->GetFilteredStateChangeCount();
+    rhi_->ResetFilteredStateChangeCount();
+
+    LOG_VERBOSE(kTitle, "Clearing Render Queue");
+    rendering_pipeline_->ClearRenderCalls();
+}
+
+void RenderSystem::GenerateDrawCalls(IRenderView* render_view) const
+{
     // Generate SkyDome Draw Call
     rendering_pipeline_->GenerateSkyDomeDrawCall(rhi_.get(), render_view->GetCamera(), render_view->GetSkyDome());
 
     const math::Matrix4x4 view_matrix = render_view->GetCamera().GetViewMatrix();
+    const float far_clip = render_view->GetCamera().far_clip_;
 
     // Generate Draw Calls for Renderable entities
-    const std::vector<std::shared_ptr<ITexture>> shadow_map_textures = rhi_->GetShadowMapTextures();
-    for (const Entity renderable_entity: render_view->GetRenderableEntities())
+    for (const DrawItem& draw_item: render_view->GetDrawItems())
     {
-        const auto& [transform, material, mesh, _] = drawable_view.get(renderable_entity);
-        const math::Matrix4x4 model_matrix = transform.GetLocalToWorldMatrix();
-        rendering_pipeline_->GenerateDrawCall(rhi_.get(), mesh, material, model_matrix, view_matrix);
+        rendering_pipeline_->GenerateDrawCall(rhi_.get(), draw_item, view_matrix, far_clip);
     }
 
     // Generate Draw Calls for Shadow Casting entities for each cascade
     for (uint32 cascade_index = 0; cascade_index < Constants::kShadowCascadeCount; ++cascade_index)
     {
-        for (const Entity shadow_casting_entity: render_view->GetShadowCastingEntities(cascade_index))
+        for (const ShadowDrawItem& shadow_draw_item: render_view->GetShadowDrawItems(cascade_index))
         {
-            const auto& [transform, material, mesh, _] = drawable_view.get(shadow_casting_entity);
-            const math::Matrix4x4 model_matrix = transform.GetLocalToWorldMatrix();
-            rendering_pipeline_->GenerateShadowDrawCall(rhi_.get(), cascade_index, mesh, material, model_matrix);
+            rendering_pipeline_->GenerateShadowDrawCall(rhi_.get(), cascade_index, shadow_draw_item);
         }
     }
 }
 
+void RenderSystem::OnMeshDestroyed(entt::registry& registry, Entity entity)
+{
+    released_mesh_ids_.push_back(registry.get<const Mesh>(entity).mesh_id_);
+}
+
+void RenderSystem::ReleaseMeshes()
+{
+    if (released_mesh_ids_.empty())
+    {
+        return;
+    }
+
+    LOG_VERBOSE(kTitle, "Releasing meshes of destroyed entities");
+    auto release_meshes = [this, mesh_ids = std::move(released_mesh_ids_)]()
+    {
+        for (uint32 mesh_id : mesh_ids)
+        {
+            rendering_pipeline_->ReleasePrimitiveMesh(mesh_id);
+        }
+    };
+    released_mesh_ids_.clear();
+
+    // Tasks run in submission order, so the frames submitted before are done with the meshes
+    if (render_thread_ && render_thread_->IsRunning())
+    {
+        render_thread_->Submit(std::move(release_meshes));
+    }
+    else
+    {
+        release_meshes();
+    }
+}
+
+void RenderSystem::StartRenderThread()
+{
+    // The main thread gives up the graphics context until the render thread is stopped
+    window_->ReleaseContext();
+    render_thread_->Start([this]() { window_->MakeContextCurrent(); },
+                          [this]() { window_->ReleaseContext(); });
+}
+
+void RenderSystem::StopRenderThread()
+{
+    render_thread_->Stop();
+    window_->MakeContextCurrent();
+}
+
 bool RenderSystem::ContainsCamera() const
 {
     const auto camera_view = GetCore()->GetRegistry().view<const Camera>();
@@ -0,0 +1,130 @@
+#include "render/RenderThread.hpp"
+#include <cassert>
+
+namespace zero::render
+{
+
+RenderThread::RenderThread(uint32 max_pending_tasks)
+: max_pending_tasks_(max_pending_tasks == 0 ? 1 : max_pending_tasks)
+, thread_()
+, mutex_()
+, task_queued_()
+, task_completed_()
+, tasks_(max_pending_tasks_)
+, first_task_index_(0)
+, task_count_(0)
+, on_start_()
+, on_stop_()
+, is_running_(false)
+, is_executing_(false)
+{
+}
+
+RenderThread::~RenderThread()
+{
+    Stop();
+}
+
+void RenderThread::Start(std::function<void()> on_start, std::function<void()> on_stop)
+{
+    if (IsRunning())
+    {
+        return;
+    }
+    on_start_ = std::move(on_start);
+    on_stop_ = std::move(on_stop);
+    is_running_ = true;
+    thread_ = std::thread(&RenderThread::Run, this);
+}
+
+void RenderThread::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!is_running_)
+        {
+            return;
+        }
+        is_running_ = false;
+    }
+    task_queued_.notify_one();
+    thread_.join();
+}
+
+bool RenderThread::IsRunning() const
+{
+    return thread_.joinable();
+}
+
+void RenderThread::Submit(std::function<void()> task)
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        task_completed_.wait(lock, [this]() { return task_count_ + (is_executing_ ? 1U : 0U) < max_pending_tasks_; });
+        tasks_[(first_task_index_ + task_count_) % max_pending_tasks_] = std::move(task);
+        ++task_count_;
+    }
+    task_queued_.notify_one();
+}
+
+void RenderThread::Execute(const std::function<void()>& task)
+{
+    // The render thread would wait on a task only it can run
+    assert(std::this_thread::get_id() != thread_.get_id() && "Execute cannot be called from the render thread");
+    bool is_complete = false;
+    Submit([this, &task, &is_complete]()
+    {
+        task();
+        std::lock_guard<std::mutex> lock(mutex_);
+        is_complete = true;
+    });
+    std::unique_lock<std::mutex> lock(mutex_);
+    task_completed_.wait(lock, [&is_complete]() { return is_complete; });
+}
+
+void RenderThread::Flush()
+{
+    assert(std::this_thread::get_id() != thread_.get_id() && "Flush cannot be called from the render thread");
+    std::unique_lock<std::mutex> lock(mutex_);
+    task_completed_.wait(lock, [this]() { return task_count_ == 0 && !is_executing_; });
+}
+
+void RenderThread::Run()
+{
+    if (on_start_)
+    {
+        on_start_();
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        task_queued_.wait(lock, [this]() { return task_count_ > 0 || !is_running_; });
+        if (task_count_ == 0)
+        {
+            // Stopped and all tasks have been executed
+            break;
+        }
+
+        std::function<void()> task = std::move(tasks_[first_task_index_]);
+        tasks_[first_task_index_] = nullptr;
+        first_task_index_ = (first_task_index_ + 1) % max_pending_tasks_;
+        --task_count_;
+        is_executing_ = true;
+        lock.unlock();
+
+        task();
+
+        lock.lock();
+        is_executing_ = false;
+        task_completed_.notify_all();
+    }
+    lock.unlock();
+
+    if (on_stop_)
+    {
+        on_stop_();
+    }
+}
+
+} // namespace zero::render
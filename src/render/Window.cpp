@@ -21,6 +21,12 @@ Window::~Window()
 
 void Window::Initialize()
 {
+    if (config_.api_ == GraphicsAPI::NONE)
+    {
+        // Headless. Only the event subsystem is needed for input polling.
+        SDL_Init(SDL_INIT_EVENTS);
+        return;
+    }
 
     SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO | SDL_INIT_EVENTS);
 
@@ -117,7 +123,26 @@ void Window::Reinitialize(WindowConfig config)
 
 void Window::SwapBuffers()
 {
-    SDL_GL_SwapWindow(sdl_window_);
+    if (sdl_window_)
+    {
+        SDL_GL_SwapWindow(sdl_window_);
+    }
+}
+
+void Window::MakeContextCurrent()
+{
+    if (sdl_window_)
+    {
+        SDL_GL_MakeCurrent(sdl_window_, sdl_gl_context_);
+    }
+}
+
+void Window::ReleaseContext()
+{
+    if (sdl_window_)
+    {
+        SDL_GL_MakeCurrent(sdl_window_, nullptr);
+    }
 }
 
 void Window::Cleanup()
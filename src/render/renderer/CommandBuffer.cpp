@@ -0,0 +1,388 @@
+#include "render/renderer/CommandBuffer.hpp"
+#include <cstring>
+#include <type_traits>
+
+namespace zero::render
+{
+
+namespace
+{
+
+enum class CommandType : uint8
+{
+    BEGIN_FRAME,
+    END_FRAME,
+    SET_VIEWPORT,
+    SET_FILL_MODE,
+    SET_CULL_MODE,
+    CLEAR,
+    BIND_SHADER_PROGRAM,
+    BIND_TEXTURE,
+    BIND_STORAGE_BUFFER,
+    UPDATE_DRAW_COMMANDS,
+    DRAW_MESH,
+    MULTI_DRAW_MESH_INDIRECT,
+    WRITE_UNIFORM,
+    BIND_UNIFORM,
+    WRITE_INSTANCES,
+    BIND_INSTANCES,
+    EXECUTE_DRAW_CALL,
+}; // enum class CommandType
+
+/**
+ * @brief The arguments of each command, as stored in the stream after the command type
+ */
+///@{
+struct BeginFrameCommand
+{
+    static constexpr CommandType kType = CommandType::BEGIN_FRAME;
+    const std::shared_ptr<IFrameBuffer>* frame_buffer_;
+};
+
+struct EndFrameCommand
+{
+    static constexpr CommandType kType = CommandType::END_FRAME;
+};
+
+struct SetViewportCommand
+{
+    static constexpr CommandType kType = CommandType::SET_VIEWPORT;
+    uint32 x_;
+    uint32 y_;
+    uint32 width_;
+    uint32 height_;
+};
+
+struct SetFillModeCommand
+{
+    static constexpr CommandType kType = CommandType::SET_FILL_MODE;
+    IRenderHardware::FillMode fill_mode_;
+};
+
+struct SetCullModeCommand
+{
+    static constexpr CommandType kType = CommandType::SET_CULL_MODE;
+    IRenderHardware::CullMode cull_mode_;
+};
+
+struct ClearCommand
+{
+    static constexpr CommandType kType = CommandType::CLEAR;
+};
+
+struct BindShaderProgramCommand
+{
+    static constexpr CommandType kType = CommandType::BIND_SHADER_PROGRAM;
+    const std::shared_ptr<IProgram>* shader_program_;
+};
+
+struct BindTextureCommand
+{
+    static constexpr CommandType kType = CommandType::BIND_TEXTURE;
+    const std::shared_ptr<ITexture>* texture_;
+    const std::shared_ptr<ISampler>* texture_sampler_;
+    uint32 uniform_name_identifier_;
+};
+
+struct BindStorageBufferCommand
+{
+    static constexpr CommandType kType = CommandType::BIND_STORAGE_BUFFER;
+    const std::shared_ptr<IStorageBuffer>* storage_buffer_;
+};
+
+struct UpdateDrawCommandsCommand
+{
+    static constexpr CommandType kType = CommandType::UPDATE_DRAW_COMMANDS;
+    const DrawIndirectCommand* draw_commands_;
+    uint32 draw_command_count_;
+};
+
+struct DrawMeshCommand
+{
+    static constexpr CommandType kType = CommandType::DRAW_MESH;
+    const std::shared_ptr<IMesh>* mesh_;
+};
+
+struct MultiDrawMeshIndirectCommand
+{
+    static constexpr CommandType kType = CommandType::MULTI_DRAW_MESH_INDIRECT;
+    const std::shared_ptr<IMesh>* mesh_;
+    uint32 first_command_;
+    uint32 command_count_;
+};
+
+/**
+ * @brief Followed by the data of the write
+ */
+struct WriteUniformCommand
+{
+    static constexpr CommandType kType = CommandType::WRITE_UNIFORM;
+    UniformBlock uniform_block_;
+    uint32 data_size_;
+};
+
+struct BindUniformCommand
+{
+    static constexpr CommandType kType = CommandType::BIND_UNIFORM;
+    UniformBlock uniform_block_;
+};
+
+struct WriteInstancesCommand
+{
+    static constexpr CommandType kType = CommandType::WRITE_INSTANCES;
+    const void* data_;
+    uint32 data_size_;
+};
+
+struct BindInstancesCommand
+{
+    static constexpr CommandType kType = CommandType::BIND_INSTANCES;
+};
+
+struct ExecuteDrawCallCommand
+{
+    static constexpr CommandType kType = CommandType::EXECUTE_DRAW_CALL;
+    IDrawCall* draw_call_;
+};
+///@}
+
+/**
+ * @brief Reference a resource. Null resources are not referenced, so temporaries such as nullptr can be recorded.
+ */
+template<typename T>
+const std::shared_ptr<T>* Reference(const std::shared_ptr<T>& resource)
+{
+    return resource ? &resource : nullptr;
+}
+
+template<typename T>
+const std::shared_ptr<T>& Dereference(const std::shared_ptr<T>* resource)
+{
+    static const std::shared_ptr<T> kNullResource{};
+    return resource ? *resource : kNullResource;
+}
+
+template<typename Command>
+Command Read(const uint8*& cursor)
+{
+    Command command{};
+    std::memcpy(&command, cursor, sizeof(Command));
+    cursor += sizeof(Command);
+    return command;
+}
+
+} // namespace
+
+CommandBuffer::CommandBuffer()
+: commands_()
+, command_count_(0)
+{
+}
+
+void CommandBuffer::Reset()
+{
+    commands_.clear();
+    command_count_ = 0;
+}
+
+void CommandBuffer::BeginFrame(const std::shared_ptr<IFrameBuffer>& frame_buffer)
+{
+    Record(BeginFrameCommand{Reference(frame_buffer)});
+}
+
+void CommandBuffer::EndFrame()
+{
+    Record(EndFrameCommand{});
+}
+
+void CommandBuffer::SetViewport(uint32 x, uint32 y, uint32 width, uint32 height)
+{
+    Record(SetViewportCommand{x, y, width, height});
+}
+
+void CommandBuffer::SetFillMode(IRenderHardware::FillMode fill_mode)
+{
+    Record(SetFillModeCommand{fill_mode});
+}
+
+void CommandBuffer::SetCullMode(IRenderHardware::CullMode cull_mode)
+{
+    Record(SetCullModeCommand{cull_mode});
+}
+
+void CommandBuffer::Clear()
+{
+    Record(ClearCommand{});
+}
+
+void CommandBuffer::BindShaderProgram(const std::shared_ptr<IProgram>& shader_program)
+{
+    Record(BindShaderProgramCommand{Reference(shader_program)});
+}
+
+void CommandBuffer::BindTexture(const std::shared_ptr<ITexture>& texture, const std::shared_ptr<ISampler>& texture_sampler, uint32 uniform_name_identifier)
+{
+    Record(BindTextureCommand{Reference(texture), Reference(texture_sampler), uniform_name_identifier});
+}
+
+void CommandBuffer::BindStorageBuffer(const std::shared_ptr<IStorageBuffer>& storage_buffer)
+{
+    Record(BindStorageBufferCommand{Reference(storage_buffer)});
+}
+
+void CommandBuffer::UpdateDrawCommands(const DrawIndirectCommand* draw_commands, uint32 draw_command_count)
+{
+    Record(UpdateDrawCommandsCommand{draw_commands, draw_command_count});
+}
+
+void CommandBuffer::DrawMesh(const std::shared_ptr<IMesh>& mesh)
+{
+    Record(DrawMeshCommand{Reference(mesh)});
+}
+
+void CommandBuffer::MultiDrawMeshIndirect(const std::shared_ptr<IMesh>& mesh, uint32 first_command, uint32 command_count)
+{
+    Record(MultiDrawMeshIndirectCommand{Reference(mesh), first_command, command_count});
+}
+
+void CommandBuffer::WriteUniform(UniformBlock uniform_block, const void* data, uint32 data_size)
+{
+    Record(WriteUniformCommand{uniform_block, data_size});
+    const auto* bytes = static_cast<const uint8*>(data);
+    commands_.insert(commands_.end(), bytes, bytes + data_size);
+}
+
+void CommandBuffer::BindUniform(UniformBlock uniform_block)
+{
+    Record(BindUniformCommand{uniform_block});
+}
+
+void CommandBuffer::WriteInstances(const void* data, uint32 data_size)
+{
+    Record(WriteInstancesCommand{data, data_size});
+}
+
+void CommandBuffer::BindInstances()
+{
+    Record(BindInstancesCommand{});
+}
+
+void CommandBuffer::ExecuteDrawCall(IDrawCall* draw_call)
+{
+    Record(ExecuteDrawCallCommand{draw_call});
+}
+
+void CommandBuffer::Submit(IRenderHardware* rhi, UniformManager& uniform_manager) const
+{
+    const uint8* cursor = commands_.data();
+    const uint8* end = cursor + commands_.size();
+    while (cursor < end)
+    {
+        const auto command_type = static_cast<CommandType>(*cursor);
+        ++cursor;
+        switch (command_type)
+        {
+            case CommandType::BEGIN_FRAME:
+                rhi->BeginFrame(Dereference(Read<BeginFrameCommand>(cursor).frame_buffer_));
+                break;
+            case CommandType::END_FRAME:
+                Read<EndFrameCommand>(cursor);
+                rhi->EndFrame();
+                break;
+            case CommandType::SET_VIEWPORT:
+            {
+                const auto command = Read<SetViewportCommand>(cursor);
+                rhi->SetViewport(command.x_, command.y_, command.width_, command.height_);
+                break;
+            }
+            case CommandType::SET_FILL_MODE:
+                rhi->SetFillMode(Read<SetFillModeCommand>(cursor).fill_mode_);
+                break;
+            case CommandType::SET_CULL_MODE:
+                rhi->SetCullMode(Read<SetCullModeCommand>(cursor).cull_mode_);
+                break;
+            case CommandType::CLEAR:
+                Read<ClearCommand>(cursor);
+                rhi->Clear();
+                break;
+            case CommandType::BIND_SHADER_PROGRAM:
+                rhi->BindShaderProgram(Dereference(Read<BindShaderProgramCommand>(cursor).shader_program_));
+                break;
+            case CommandType::BIND_TEXTURE:
+            {
+                const auto command = Read<BindTextureCommand>(cursor);
+                rhi->BindTexture(Dereference(command.texture_), Dereference(command.texture_sampler_), command.uniform_name_identifier_);
+                break;
+            }
+            case CommandType::BIND_STORAGE_BUFFER:
+                rhi->BindStorageBuffer(Dereference(Read<BindStorageBufferCommand>(cursor).storage_buffer_));
+                break;
+            case CommandType::UPDATE_DRAW_COMMANDS:
+            {
+                const auto command = Read<UpdateDrawCommandsCommand>(cursor);
+                rhi->UpdateDrawCommands(command.draw_commands_, command.draw_command_count_);
+                break;
+            }
+            case CommandType::DRAW_MESH:
+                rhi->DrawMesh(Dereference(Read<DrawMeshCommand>(cursor).mesh_));
+                break;
+            case CommandType::MULTI_DRAW_MESH_INDIRECT:
+            {
+                const auto command = Read<MultiDrawMeshIndirectCommand>(cursor);
+                rhi->MultiDrawMeshIndirect(Dereference(command.mesh_), command.first_command_, command.command_count_);
+                break;
+            }
+            case CommandType::WRITE_UNIFORM:
+            {
+                const auto command = Read<WriteUniformCommand>(cursor);
+                uniform_manager.WriteUniform(rhi, command.uniform_block_, cursor, command.data_size_);
+                cursor += command.data_size_;
+                break;
+            }
+            case CommandType::BIND_UNIFORM:
+                uniform_manager.BindUniform(rhi, Read<BindUniformCommand>(cursor).uniform_block_);
+                break;
+            case CommandType::WRITE_INSTANCES:
+            {
+                const auto command = Read<WriteInstancesCommand>(cursor);
+                uniform_manager.WriteInstances(rhi, command.data_, command.data_size_);
+                break;
+            }
+            case CommandType::BIND_INSTANCES:
+                Read<BindInstancesCommand>(cursor);
+                uniform_manager.BindInstances(rhi);
+                break;
+            case CommandType::EXECUTE_DRAW_CALL:
+                Read<ExecuteDrawCallCommand>(cursor).draw_call_->Draw(rhi);
+                break;
+        }
+    }
+}
+
+bool CommandBuffer::IsEmpty() const
+{
+    return command_count_ == 0;
+}
+
+uint32 CommandBuffer::GetCommandCount() const
+{
+    return command_count_;
+}
+
+uint32 CommandBuffer::GetSize() const
+{
+    return static_cast<uint32>(commands_.size());
+}
+
+template<typename Command>
+void CommandBuffer::Record(const Command& command)
+{
+    static_assert(std::is_trivially_copyable_v<Command>, "Commands are copied into the stream byte by byte");
+    const std::size_t offset = commands_.size();
+    commands_.resize(offset + 1 + sizeof(Command));
+    commands_[offset] = static_cast<uint8>(Command::kType);
+    std::memcpy(&commands_[offset + 1], &command, sizeof(Command));
+    ++command_count_;
+}
+
+} // namespace zero::render
@@ -0,0 +1,201 @@
+#include <algorithm>
+#include "render/renderer/DrawCallQueue.hpp"
+
+namespace zero::render
+{
+
+namespace
+{
+
+constexpr uint32 kDigitCount = (sizeof(uint64) * 8) / DrawCallQueue::kRadixBits;
+
+uint32 GetDigit(uint64 sort_key, uint32 digit_index)
+{
+    return static_cast<uint32>(sort_key >> (digit_index * DrawCallQueue::kRadixBits)) & (DrawCallQueue::kRadixBucketCount - 1);
+}
+
+} // namespace
+
+DrawCallQueue::DrawCallQueue()
+: draw_packets_()
+, draw_calls_()
+, entries_()
+, scratch_()
+, histograms_()
+{
+}
+
+void DrawCallQueue::Submit(const DrawPacket& draw_packet, uint64 sort_key)
+{
+    entries_.push_back(Entry{sort_key, static_cast<uint32>(draw_packets_.size())});
+    draw_packets_.push_back(draw_packet);
+}
+
+void DrawCallQueue::Submit(DrawCallPtr draw_call)
+{
+    entries_.push_back(Entry{draw_call->GetSortKey(), static_cast<uint32>(draw_calls_.size()) | kDrawCallFlag});
+    draw_calls_.push_back(std::move(draw_call));
+}
+
+void DrawCallQueue::Sort(ThreadPool& thread_pool)
+{
+    if (entries_.size() >= kParallelSortThreshold && thread_pool.GetWorkerCount() > 0)
+    {
+        ParallelRadixSort(thread_pool, entries_, scratch_, histograms_);
+    }
+    else
+    {
+        RadixSort(entries_, scratch_);
+    }
+}
+
+void DrawCallQueue::Clear()
+{
+    draw_packets_.clear();
+    draw_calls_.clear();
+    entries_.clear();
+}
+
+bool DrawCallQueue::IsEmpty() const
+{
+    return entries_.empty();
+}
+
+const std::vector<DrawCallQueue::Entry>& DrawCallQueue::GetEntries() const
+{
+    return entries_;
+}
+
+const DrawPacket& DrawCallQueue::GetDrawPacket(uint32 draw_index) const
+{
+    return draw_packets_[draw_index];
+}
+
+IDrawCall& DrawCallQueue::GetDrawCall(uint32 draw_index) const
+{
+    return *draw_calls_[draw_index & ~kDrawCallFlag];
+}
+
+bool DrawCallQueue::CanInstance(const DrawPacket& lhs, const DrawPacket& rhs)
+{
+    return lhs.mesh_handle_ == rhs.mesh_handle_
+           && lhs.program_handle_ == rhs.program_handle_
+           && lhs.texture_handle_ == rhs.texture_handle_
+           && lhs.two_sided_ == rhs.two_sided_
+           && lhs.wireframe_enabled_ == rhs.wireframe_enabled_;
+}
+
+void DrawCallQueue::RadixSort(std::vector<Entry>& entries, std::vector<Entry>& scratch)
+{
+    const auto entry_count = static_cast<uint32>(entries.size());
+    if (entry_count < 2)
+    {
+        return;
+    }
+    scratch.resize(entry_count);
+
+    std::array<Histogram, kDigitCount> histograms{};
+    for (const Entry& entry : entries)
+    {
+        for (uint32 digit_index = 0; digit_index < kDigitCount; ++digit_index)
+        {
+            ++histograms[digit_index][GetDigit(entry.sort_key_, digit_index)];
+        }
+    }
+
+    for (uint32 digit_index = 0; digit_index < kDigitCount; ++digit_index)
+    {
+        Histogram& histogram = histograms[digit_index];
+        if (histogram[GetDigit(entries[0].sort_key_, digit_index)] == entry_count)
+        {
+            // Every key has the same digit
+            continue;
+        }
+
+        uint32 offset = 0;
+        for (uint32& bucket : histogram)
+        {
+            const uint32 count = bucket;
+            bucket = offset;
+            offset += count;
+        }
+        for (const Entry& entry : entries)
+        {
+            scratch[histogram[GetDigit(entry.sort_key_, digit_index)]++] = entry;
+        }
+        entries.swap(scratch);
+    }
+}
+
+void DrawCallQueue::ParallelRadixSort(ThreadPool& thread_pool,
+                                      std::vector<Entry>& entries,
+                                      std::vector<Entry>& scratch,
+                                      std::vector<Histogram>& histograms)
+{
+    const auto entry_count = static_cast<uint32>(entries.size());
+    if (entry_count < 2)
+    {
+        return;
+    }
+    scratch.resize(entry_count);
+
+    const uint32 chunk_count = thread_pool.GetWorkerCount() + 1;
+    const uint32 chunk_size = (entry_count + chunk_count - 1) / chunk_count;
+    histograms.resize(chunk_count);
+
+    for (uint32 digit_index = 0; digit_index < kDigitCount; ++digit_index)
+    {
+        const Entry* source = entries.data();
+        Entry* destination = scratch.data();
+
+        thread_pool.ParallelFor(chunk_count, [&histograms, source, entry_count, chunk_size, digit_index](uint32 chunk_index)
+        {
+            Histogram& histogram = histograms[chunk_index];
+            histogram.fill(0);
+            const uint32 begin = std::min(chunk_index * chunk_size, entry_count);
+            const uint32 end = std::min(begin + chunk_size, entry_count);
+            for (uint32 i = begin; i < end; ++i)
+            {
+                ++histogram[GetDigit(source[i].sort_key_, digit_index)];
+            }
+        });
+
+        // Every chunk scatters into its own range of each bucket, after the ranges of the chunks before it
+        const uint32 first_digit = GetDigit(source[0].sort_key_, digit_index);
+        uint32 first_digit_count = 0;
+        for (const Histogram& histogram : histograms)
+        {
+            first_digit_count += histogram[first_digit];
+        }
+        if (first_digit_count == entry_count)
+        {
+            // Every key has the same digit
+            continue;
+        }
+
+        uint32 offset = 0;
+        for (uint32 bucket_index = 0; bucket_index < kRadixBucketCount; ++bucket_index)
+        {
+            for (Histogram& histogram : histograms)
+            {
+                const uint32 count = histogram[bucket_index];
+                histogram[bucket_index] = offset;
+                offset += count;
+            }
+        }
+
+        thread_pool.ParallelFor(chunk_count, [&histograms, source, destination, entry_count, chunk_size, digit_index](uint32 chunk_index)
+        {
+            Histogram& offsets = histograms[chunk_index];
+            const uint32 begin = std::min(chunk_index * chunk_size, entry_count);
+            const uint32 end = std::min(begin + chunk_size, entry_count);
+            for (uint32 i = begin; i < end; ++i)
+            {
+                destination[offsets[GetDigit(source[i].sort_key_, digit_index)]++] = source[i];
+            }
+        });
+        entries.swap(scratch);
+    }
+}
+
+} // namespace zero::render
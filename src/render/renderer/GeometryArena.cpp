@@ -0,0 +1,169 @@
+#include "render/renderer/GeometryArena.hpp"
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+
+namespace zero::render
+{
+
+float GeometryArena::RangeStatistics::GetFragmentation() const
+{
+    const uint32 free_count = capacity_ - used_count_;
+    if (free_count == 0)
+    {
+        return 0.0F;
+    }
+    return 1.0F - (static_cast<float>(largest_free_range_) / static_cast<float>(free_count));
+}
+
+GeometryArena::GeometryArena(uint32 page_vertex_capacity, uint32 page_index_capacity)
+: page_vertex_capacity_(page_vertex_capacity)
+, page_index_capacity_(page_index_capacity)
+, pages_()
+, allocation_count_(0)
+{
+}
+
+GeometryArena::Allocation GeometryArena::Allocate(uint32 vertex_count, uint32 index_count)
+{
+    ++allocation_count_;
+    for (uint32 page_index = 0; page_index < GetPageCount(); ++page_index)
+    {
+        Page& page = pages_[page_index];
+        const uint32 vertex_range_index = FindFreeRange(page.vertices_, vertex_count);
+        const uint32 index_range_index = FindFreeRange(page.indices_, index_count);
+        if (vertex_range_index < page.vertices_.free_ranges_.size() && index_range_index < page.indices_.free_ranges_.size())
+        {
+            return Allocation{page_index,
+                              TakeFreeRange(page.vertices_, vertex_range_index, vertex_count),
+                              vertex_count,
+                              TakeFreeRange(page.indices_, index_range_index, index_count),
+                              index_count};
+        }
+    }
+
+    // Meshes larger than a page get a page of their own size
+    const uint32 vertex_capacity = std::max(page_vertex_capacity_, vertex_count);
+    const uint32 index_capacity = std::max(page_index_capacity_, index_count);
+    Page page{FreeList{vertex_capacity, {Range{0, vertex_capacity}}}, FreeList{index_capacity, {Range{0, index_capacity}}}};
+    const Allocation allocation{GetPageCount(),
+                                TakeFreeRange(page.vertices_, 0, vertex_count),
+                                vertex_count,
+                                TakeFreeRange(page.indices_, 0, index_count),
+                                index_count};
+    pages_.push_back(std::move(page));
+    return allocation;
+}
+
+void GeometryArena::Free(const Allocation& allocation)
+{
+    assert(allocation.page_index_ < GetPageCount());
+    assert(allocation_count_ > 0);
+    Page& page = pages_[allocation.page_index_];
+    ReturnRange(page.vertices_, Range{allocation.base_vertex_, allocation.vertex_count_});
+    ReturnRange(page.indices_, Range{allocation.first_index_, allocation.index_count_});
+    --allocation_count_;
+}
+
+uint32 GeometryArena::GetPageCount() const
+{
+    return static_cast<uint32>(pages_.size());
+}
+
+uint32 GeometryArena::GetPageVertexCapacity(uint32 page_index) const
+{
+    return pages_[page_index].vertices_.capacity_;
+}
+
+uint32 GeometryArena::GetPageIndexCapacity(uint32 page_index) const
+{
+    return pages_[page_index].indices_.capacity_;
+}
+
+GeometryArena::Statistics GeometryArena::GetStatistics() const
+{
+    Statistics statistics{};
+    statistics.page_count_ = GetPageCount();
+    statistics.allocation_count_ = allocation_count_;
+    for (const Page& page : pages_)
+    {
+        AddStatistics(page.vertices_, statistics.vertices_);
+        AddStatistics(page.indices_, statistics.indices_);
+    }
+    return statistics;
+}
+
+uint32 GeometryArena::FindFreeRange(const FreeList& free_list, uint32 count)
+{
+    const auto free_range_search = std::find_if(free_list.free_ranges_.begin(), free_list.free_ranges_.end(), [count](const Range& free_range)
+    {
+        return free_range.count_ >= count;
+    });
+    return static_cast<uint32>(free_range_search - free_list.free_ranges_.begin());
+}
+
+uint32 GeometryArena::TakeFreeRange(FreeList& free_list, uint32 free_range_index, uint32 count)
+{
+    Range& free_range = free_list.free_ranges_[free_range_index];
+    assert(free_range.count_ >= count);
+    const uint32 offset = free_range.offset_;
+    free_range.offset_ += count;
+    free_range.count_ -= count;
+    if (free_range.count_ == 0)
+    {
+        free_list.free_ranges_.erase(free_list.free_ranges_.begin() + free_range_index);
+    }
+    return offset;
+}
+
+void GeometryArena::ReturnRange(FreeList& free_list, const Range& range)
+{
+    if (range.count_ == 0)
+    {
+        return;
+    }
+    assert(range.offset_ + range.count_ <= free_list.capacity_);
+
+    std::vector<Range>& free_ranges = free_list.free_ranges_;
+    auto next = std::lower_bound(free_ranges.begin(), free_ranges.end(), range.offset_, [](const Range& free_range, uint32 offset)
+    {
+        return free_range.offset_ < offset;
+    });
+    assert(next == free_ranges.end() || range.offset_ + range.count_ <= next->offset_);
+
+    // Merge with the free ranges on either side
+    const bool merges_previous = next != free_ranges.begin() && std::prev(next)->offset_ + std::prev(next)->count_ == range.offset_;
+    const bool merges_next = next != free_ranges.end() && range.offset_ + range.count_ == next->offset_;
+    if (merges_previous && merges_next)
+    {
+        std::prev(next)->count_ += range.count_ + next->count_;
+        free_ranges.erase(next);
+    }
+    else if (merges_previous)
+    {
+        std::prev(next)->count_ += range.count_;
+    }
+    else if (merges_next)
+    {
+        next->offset_ = range.offset_;
+        next->count_ += range.count_;
+    }
+    else
+    {
+        free_ranges.insert(next, range);
+    }
+}
+
+void GeometryArena::AddStatistics(const FreeList& free_list, RangeStatistics& range_statistics)
+{
+    range_statistics.capacity_ += free_list.capacity_;
+    range_statistics.used_count_ += free_list.capacity_;
+    range_statistics.free_range_count_ += static_cast<uint32>(free_list.free_ranges_.size());
+    for (const Range& free_range : free_list.free_ranges_)
+    {
+        range_statistics.used_count_ -= free_range.count_;
+        range_statistics.largest_free_range_ = std::max(range_statistics.largest_free_range_, free_range.count_);
+    }
+}
+
+} // namespace zero::render
@@ -0,0 +1,66 @@
+#include "render/renderer/IndirectDrawList.hpp"
+#include "render/Constants.hpp"
+
+namespace zero::render
+{
+
+IndirectDrawList::IndirectDrawList()
+: instance_buffer_()
+, draw_commands_()
+, draw_runs_()
+{
+}
+
+void IndirectDrawList::Build(const DrawCallQueue& draw_call_queue, const RenderResources& render_resources)
+{
+    instance_buffer_.Build(draw_call_queue, render_resources);
+    draw_commands_.clear();
+    draw_runs_.clear();
+
+    draw_call_queue.ForEachBatch(Constants::kMaxInstanceCount, [this, &render_resources](const DrawPacket& draw_packet, uint32 first_instance, uint32 instance_count)
+    {
+        const IMesh& mesh = *render_resources.GetMesh(draw_packet.mesh_handle_);
+        const InstanceBuffer::Placement placement = instance_buffer_.Place(first_instance, instance_count);
+        const auto command_index = static_cast<uint32>(draw_commands_.size());
+        draw_commands_.push_back(DrawIndirectCommand{mesh.GetIndexCount(), instance_count, mesh.GetFirstIndex(), mesh.GetBaseVertex(), placement.base_instance_});
+
+        // Extend the previous run if it is a multi draw with the same state, geometry buffers, and instance window
+        if (!draw_runs_.empty())
+        {
+            DrawRun& draw_run = draw_runs_.back();
+            if (draw_run.draw_packet_
+                && draw_run.geometry_identifier_ == mesh.GetGeometryIdentifier()
+                && draw_run.window_index_ == placement.window_index_
+                && CanMultiDraw(*draw_run.draw_packet_, draw_packet))
+            {
+                ++draw_run.command_count_;
+                return;
+            }
+        }
+        draw_runs_.push_back(DrawRun{&draw_packet, nullptr, mesh.GetGeometryIdentifier(), placement.window_index_, command_index, 1});
+    },
+    [this](IDrawCall& draw_call)
+    {
+        draw_runs_.push_back(DrawRun{nullptr, &draw_call, 0, 0, 0, 0});
+    });
+}
+
+const std::vector<DrawIndirectCommand>& IndirectDrawList::GetDrawCommands() const
+{
+    return draw_commands_;
+}
+
+const std::vector<IndirectDrawList::DrawRun>& IndirectDrawList::GetDrawRuns() const
+{
+    return draw_runs_;
+}
+
+bool IndirectDrawList::CanMultiDraw(const DrawPacket& lhs, const DrawPacket& rhs)
+{
+    return lhs.program_handle_ == rhs.program_handle_
+           && lhs.texture_handle_ == rhs.texture_handle_
+           && lhs.two_sided_ == rhs.two_sided_
+           && lhs.wireframe_enabled_ == rhs.wireframe_enabled_;
+}
+
+} // namespace zero::render
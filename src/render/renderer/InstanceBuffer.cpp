@@ -0,0 +1,66 @@
+#include "render/renderer/InstanceBuffer.hpp"
+#include "render/Constants.hpp"
+#include <algorithm>
+#include <cassert>
+
+namespace zero::render
+{
+
+InstanceBuffer::InstanceBuffer()
+: instances_()
+, windows_()
+, uploaded_window_index_(kNoWindow)
+{
+}
+
+void InstanceBuffer::Build(const DrawCallQueue& draw_call_queue, const RenderResources& render_resources)
+{
+    instances_.clear();
+    windows_.clear();
+    uploaded_window_index_ = kNoWindow;
+    for (const DrawCallQueue::Entry& entry : draw_call_queue.GetEntries())
+    {
+        if ((entry.draw_index_ & DrawCallQueue::kDrawCallFlag) != 0)
+        {
+            continue;
+        }
+        const DrawPacket& draw_packet = draw_call_queue.GetDrawPacket(entry.draw_index_);
+        instances_.emplace_back(render_resources.GetModelData(draw_packet.model_index_),
+                                render_resources.GetMaterialData(draw_packet.material_index_));
+    }
+}
+
+InstanceBuffer::Placement InstanceBuffer::Place(uint32 first_instance, uint32 instance_count)
+{
+    assert(instance_count <= Constants::kMaxInstanceCount);
+    assert(first_instance + instance_count <= GetInstanceCount());
+    if (windows_.empty() || first_instance < windows_.back().begin_ || first_instance + instance_count > windows_.back().end_)
+    {
+        windows_.push_back(Window{first_instance, std::min(first_instance + Constants::kMaxInstanceCount, GetInstanceCount())});
+    }
+    return Placement{static_cast<uint32>(windows_.size() - 1), first_instance - windows_.back().begin_};
+}
+
+void InstanceBuffer::Upload(CommandBuffer& command_buffer, uint32 window_index)
+{
+    if (window_index == uploaded_window_index_)
+    {
+        return;
+    }
+
+    const Window& window = windows_[window_index];
+    command_buffer.WriteInstances(&instances_[window.begin_], static_cast<uint32>((window.end_ - window.begin_) * sizeof(InstanceData)));
+    uploaded_window_index_ = window_index;
+}
+
+uint32 InstanceBuffer::GetInstanceCount() const
+{
+    return static_cast<uint32>(instances_.size());
+}
+
+uint32 InstanceBuffer::GetWindowCount() const
+{
+    return static_cast<uint32>(windows_.size());
+}
+
+} // namespace zero::render
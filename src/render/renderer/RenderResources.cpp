@@ -0,0 +1,195 @@
+#include "render/renderer/RenderResources.hpp"
+#include <cassert>
+
+namespace zero::render
+{
+
+namespace
+{
+
+/**
+ * @brief The low bits of a handle hold the slot index and the high bits hold the generation of the slot
+ */
+constexpr uint32 kIndexBitCount = 20;
+constexpr uint32 kIndexMask = (1U << kIndexBitCount) - 1;
+constexpr uint32 kGenerationMask = 0xFFFFFFFFU >> kIndexBitCount;
+
+constexpr uint32 CreateHandle(uint32 index, uint32 generation)
+{
+    return (generation << kIndexBitCount) | index;
+}
+
+constexpr uint32 GetHandleIndex(uint32 handle)
+{
+    return handle & kIndexMask;
+}
+
+constexpr uint32 GetHandleGeneration(uint32 handle)
+{
+    return handle >> kIndexBitCount;
+}
+
+} // namespace
+
+RenderResources::RenderResources()
+: meshes_{{nullptr}, {0}, {}}
+, programs_{{nullptr}, {0}, {}}
+, textures_{{nullptr}, {0}, {}}
+, model_data_()
+, material_data_()
+{
+}
+
+uint32 RenderResources::AddMesh(std::shared_ptr<IMesh> mesh)
+{
+    return AddResource(meshes_, std::move(mesh));
+}
+
+uint32 RenderResources::AddProgram(std::shared_ptr<IProgram> program)
+{
+    return AddResource(programs_, std::move(program));
+}
+
+uint32 RenderResources::AddTexture(std::shared_ptr<ITexture> texture)
+{
+    return AddResource(textures_, std::move(texture));
+}
+
+void RenderResources::RemoveMesh(uint32 handle)
+{
+    RemoveResource(meshes_, handle);
+}
+
+void RenderResources::RemoveProgram(uint32 handle)
+{
+    RemoveResource(programs_, handle);
+}
+
+void RenderResources::RemoveTexture(uint32 handle)
+{
+    RemoveResource(textures_, handle);
+}
+
+const std::shared_ptr<IMesh>& RenderResources::GetMesh(uint32 handle) const
+{
+    return GetResource(meshes_, handle);
+}
+
+const std::shared_ptr<IProgram>& RenderResources::GetProgram(uint32 handle) const
+{
+    return GetResource(programs_, handle);
+}
+
+const std::shared_ptr<ITexture>& RenderResources::GetTexture(uint32 handle) const
+{
+    return GetResource(textures_, handle);
+}
+
+uint32 RenderResources::GetSlotIndex(uint32 handle)
+{
+    return GetHandleIndex(handle);
+}
+
+uint32 RenderResources::AddModelData(const ModelData& model_data)
+{
+    model_data_.push_back(model_data);
+    return static_cast<uint32>(model_data_.size() - 1);
+}
+
+uint32 RenderResources::AddMaterialData(const MaterialData& material_data)
+{
+    material_data_.push_back(material_data);
+    return static_cast<uint32>(material_data_.size() - 1);
+}
+
+const ModelData& RenderResources::GetModelData(uint32 index) const
+{
+    return model_data_[index];
+}
+
+const MaterialData& RenderResources::GetMaterialData(uint32 index) const
+{
+    return material_data_[index];
+}
+
+void RenderResources::ClearFrameData()
+{
+    model_data_.clear();
+    material_data_.clear();
+}
+
+void RenderResources::Clear()
+{
+    ClearResources(meshes_);
+    ClearResources(programs_);
+    ClearResources(textures_);
+    ClearFrameData();
+}
+
+template<typename T>
+uint32 RenderResources::AddResource(ResourceTable<T>& table, std::shared_ptr<T> resource)
+{
+    if (table.free_indices_.empty())
+    {
+        const auto index = static_cast<uint32>(table.resources_.size());
+        assert(index <= kIndexMask);
+        table.resources_.push_back(std::move(resource));
+        table.generations_.push_back(0);
+        return CreateHandle(index, 0);
+    }
+
+    const uint32 index = table.free_indices_.back();
+    table.free_indices_.pop_back();
+    table.resources_[index] = std::move(resource);
+    return CreateHandle(index, table.generations_[index]);
+}
+
+template<typename T>
+void RenderResources::RemoveResource(ResourceTable<T>& table, uint32 handle)
+{
+    const uint32 index = GetHandleIndex(handle);
+    if (index == GetHandleIndex(kInvalidHandle))
+    {
+        return;
+    }
+    if (index >= table.resources_.size() || table.generations_[index] != GetHandleGeneration(handle))
+    {
+        assert(false && "Removing a stale resource handle");
+        return;
+    }
+
+    table.resources_[index] = nullptr;
+    table.generations_[index] = (table.generations_[index] + 1) & kGenerationMask;
+    table.free_indices_.push_back(index);
+}
+
+template<typename T>
+const std::shared_ptr<T>& RenderResources::GetResource(const ResourceTable<T>& table, uint32 handle)
+{
+    const uint32 index = GetHandleIndex(handle);
+    if (index >= table.resources_.size())
+    {
+        return table.resources_[GetHandleIndex(kInvalidHandle)];
+    }
+    if (table.generations_[index] != GetHandleGeneration(handle))
+    {
+        assert(false && "Looking up a stale resource handle");
+        return table.resources_[GetHandleIndex(kInvalidHandle)];
+    }
+    return table.resources_[index];
+}
+
+template<typename T>
+void RenderResources::ClearResources(ResourceTable<T>& table)
+{
+    // Keep the slots so the handles of the released resources stay stale. Lower slots are reused first.
+    table.free_indices_.clear();
+    for (auto index = static_cast<uint32>(table.resources_.size() - 1); index > GetHandleIndex(kInvalidHandle); --index)
+    {
+        table.resources_[index] = nullptr;
+        table.generations_[index] = (table.generations_[index] + 1) & kGenerationMask;
+        table.free_indices_.push_back(index);
+    }
+}
+
+} // namespace zero::render
@@ -0,0 +1,126 @@
+#include "render/renderer/RenderStateCache.hpp"
+
+namespace zero::render
+{
+
+bool RenderStateCache::BufferBinding::operator==(const BufferBinding& other) const
+{
+    return buffer_ == other.buffer_ && offset_ == other.offset_ && size_ == other.size_;
+}
+
+RenderStateCache::RenderStateCache()
+: program_()
+, cull_mode_()
+, fill_mode_()
+, vertex_buffer_()
+, uniform_buffers_()
+, storage_buffers_()
+, textures_()
+, samplers_()
+, filtered_count_(0)
+{
+}
+
+void RenderStateCache::Invalidate()
+{
+    program_.reset();
+    cull_mode_.reset();
+    fill_mode_.reset();
+    vertex_buffer_.reset();
+    uniform_buffers_.clear();
+    storage_buffers_.clear();
+    textures_.clear();
+    samplers_.clear();
+}
+
+bool RenderStateCache::SetProgram(uint32 program)
+{
+    if (program_ == program)
+    {
+        ++filtered_count_;
+        return false;
+    }
+    program_ = program;
+    return true;
+}
+
+bool RenderStateCache::SetCullMode(IRenderHardware::CullMode cull_mode)
+{
+    if (cull_mode_ == cull_mode)
+    {
+        ++filtered_count_;
+        return false;
+    }
+    cull_mode_ = cull_mode;
+    return true;
+}
+
+bool RenderStateCache::SetFillMode(IRenderHardware::FillMode fill_mode)
+{
+    if (fill_mode_ == fill_mode)
+    {
+        ++filtered_count_;
+        return false;
+    }
+    fill_mode_ = fill_mode;
+    return true;
+}
+
+bool RenderStateCache::SetVertexBuffer(uint32 vertex_buffer)
+{
+    if (vertex_buffer_ == vertex_buffer)
+    {
+        ++filtered_count_;
+        return false;
+    }
+    vertex_buffer_ = vertex_buffer;
+    return true;
+}
+
+bool RenderStateCache::SetUniformBuffer(uint32 binding_point, const BufferBinding& buffer_binding)
+{
+    return SetSlot(uniform_buffers_, binding_point, buffer_binding);
+}
+
+bool RenderStateCache::SetStorageBuffer(uint32 binding_point, const BufferBinding& buffer_binding)
+{
+    return SetSlot(storage_buffers_, binding_point, buffer_binding);
+}
+
+bool RenderStateCache::SetTexture(uint32 texture_unit, uint32 texture)
+{
+    return SetSlot(textures_, texture_unit, texture);
+}
+
+bool RenderStateCache::SetSampler(uint32 texture_unit, uint32 sampler)
+{
+    return SetSlot(samplers_, texture_unit, sampler);
+}
+
+uint32 RenderStateCache::GetFilteredCount() const
+{
+    return filtered_count_;
+}
+
+void RenderStateCache::ResetFilteredCount()
+{
+    filtered_count_ = 0;
+}
+
+template<typename T>
+bool RenderStateCache::SetSlot(std::vector<std::optional<T>>& slots, uint32 slot, const T& value)
+{
+    if (slot >= slots.size())
+    {
+        slots.resize(slot + 1);
+    }
+    if (slots[slot] == value)
+    {
+        ++filtered_count_;
+        return false;
+    }
+    slots[slot] = value;
+    return true;
+}
+
+} // namespace zero::render
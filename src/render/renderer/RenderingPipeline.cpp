@@ -3,8 +3,6 @@
 #include "render/renderer/UniformBufferData.hpp"
 #include "render/renderer/renderpass/EntityRenderPass.hpp"
 #include "render/renderer/renderpass/CascadedShadowMapRenderPass.hpp"
-#include "render/renderer/drawcall/EntityDrawCall.hpp"
-#include "render/renderer/drawcall/ShadowMapDrawCall.hpp"
 #include "render/renderer/drawcall/SkyDomeDrawCall.hpp"
 #include "render/MeshGenerator.hpp"
 #include "core/Logger.hpp"
@@ -22,26 +20,28 @@ constexpr uint8 kPlaneMeshIdIndex = 3;
 constexpr uint8 kSphereMeshIdIndex = 4;
 constexpr uint8 kTorusMeshIdIndex = 5;
 
-RenderingPipeline::RenderingPipeline()
-: mesh_cache_()
-, program_cache_()
+constexpr std::size_t kFrameArenaCapacity = 1024 * 1024;
+
+RenderingPipeline::RenderingPipeline(uint32 frames_in_flight, uint32 worker_count)
+: render_resources_(std::make_shared<RenderResources>())
+, program_handle_cache_()
 , shader_cache_()
-, texture_cache_()
-, unique_identifier_(1)
+, texture_handle_cache_()
 , primitive_mesh_id_cache_()
+, primitive_instance_mesh_ids_()
 , render_passes_()
+, command_buffers_()
 , entity_render_pass_index_(Constants::kShadowCascadeCount)
 , uniform_manager_(nullptr)
+, frame_arena_(frames_in_flight, kFrameArenaCapacity)
+, worker_thread_pool_(worker_count)
 {
     shadow_map_material_.SetShaders({"model.vertex.glsl", "shadow_map.fragment.glsl"});
 }
 
 uint32 RenderingPipeline::LoadMesh(IRenderHardware* rhi, MeshData* mesh_data)
 {
-    std::shared_ptr<IMesh> gpu_mesh = rhi->CreateMesh(mesh_data);
-    uint32 mesh_id = GenerateNewUniqueIdentifier();
-    mesh_cache_.emplace(mesh_id, gpu_mesh);
-    return mesh_id;
+    return render_resources_->AddMesh(rhi->CreateMesh(mesh_data));
 }
 
 void RenderingPipeline::Initialize(IRenderHardware* rhi, AssetManager& asset_manager)
@@ -55,25 +55,34 @@ void RenderingPipeline::Initialize(IRenderHardware* rhi, AssetManager& asset_man
     for (uint32 cascade_index = 0; cascade_index < Constants::kShadowCascadeCount; ++cascade_index)
     {
         std::unique_ptr<CascadedShadowMapRenderPass> shadow_map_render_pass = std::make_unique<CascadedShadowMapRenderPass>(cascade_index);
-        shadow_map_render_pass->Initialize(rhi, uniform_manager_->GetCameraUniform());
+        shadow_map_render_pass->Initialize(rhi, uniform_manager_, render_resources_);
         render_passes_.push_back(std::move(shadow_map_render_pass));
     }
     std::unique_ptr<EntityRenderPass> entity_render_pass = std::make_unique<EntityRenderPass>();
-    entity_render_pass->Initialize(rhi, uniform_manager_->GetCameraUniform());
+    entity_render_pass->Initialize(rhi, uniform_manager_, render_resources_);
     render_passes_.push_back(std::move(entity_render_pass));
+
+    for (std::size_t pass_index = 0; pass_index < render_passes_.size(); ++pass_index)
+    {
+        command_buffers_.push_back(std::make_unique<CommandBuffer>());
+    }
 }
 
 void RenderingPipeline::Shutdown()
 {
-    LOG_VERBOSE(kTitle, "Clearing mesh cache");
-    mesh_cache_.clear();
+    ClearRenderCalls();
     LOG_VERBOSE(kTitle, "Clearing program cache");
-    program_cache_.clear();
+    program_handle_cache_.clear();
     LOG_VERBOSE(kTitle, "Clearing shader cache");
     shader_cache_.clear();
     LOG_VERBOSE(kTitle, "Clearing texture cache");
-    texture_cache_.clear();
-    ClearRenderCalls();
+    texture_handle_cache_.clear();
+    primitive_instance_mesh_ids_.clear();
+    LOG_VERBOSE(kTitle, "Clearing mesh, program, and texture resources");
+    render_resources_->Clear();
+    LOG_VERBOSE(kTitle, "Releasing render passes");
+    command_buffers_.clear();
+    render_passes_.clear();
     uniform_manager_ = nullptr;
 }
 
@@ -87,27 +96,27 @@ uint32 RenderingPipeline::GetPrimitiveMeshId(IRenderHardware* rhi, PrimitiveInst
         case PrimitiveInstance::Type::CONE:
         {
             std::shared_ptr<MeshData> mesh_data = MeshGenerator::GenerateCone(primitive_instance.GetCone());
-            return LoadMesh(rhi, mesh_data.get());
+            return LoadPrimitiveInstanceMesh(rhi, mesh_data.get());
         }
         case PrimitiveInstance::Type::CYLINDER:
         {
             std::shared_ptr<MeshData> mesh_data = MeshGenerator::GenerateCylinder(primitive_instance.GetCylinder());
-            return LoadMesh(rhi, mesh_data.get());
+            return LoadPrimitiveInstanceMesh(rhi, mesh_data.get());
         }
         case PrimitiveInstance::Type::PLANE:
         {
             std::shared_ptr<MeshData> mesh_data = MeshGenerator::GeneratePlane(primitive_instance.GetPlane());
-            return LoadMesh(rhi, mesh_data.get());
+            return LoadPrimitiveInstanceMesh(rhi, mesh_data.get());
         }
         case PrimitiveInstance::Type::SPHERE:
         {
             std::shared_ptr<MeshData> mesh_data = MeshGenerator::GenerateSphere(primitive_instance.GetSphere());
-            return LoadMesh(rhi, mesh_data.get());
+            return LoadPrimitiveInstanceMesh(rhi, mesh_data.get());
         }
         case PrimitiveInstance::Type::TORUS:
         {
             std::shared_ptr<MeshData> mesh_data = MeshGenerator::GenerateTorus(primitive_instance.GetTorus());
-            return LoadMesh(rhi, mesh_data.get());
+            return LoadPrimitiveInstanceMesh(rhi, mesh_data.get());
         }
         default:
             // Box Mesh
@@ -116,9 +125,29 @@ uint32 RenderingPipeline::GetPrimitiveMeshId(IRenderHardware* rhi, PrimitiveInst
     }
 }
 
+void RenderingPipeline::ReleasePrimitiveMesh(uint32 mesh_id)
+{
+    // Cached primitive meshes and model meshes are shared by many entities
+    if (primitive_instance_mesh_ids_.erase(mesh_id) > 0)
+    {
+        render_resources_->RemoveMesh(mesh_id);
+    }
+}
+
 void RenderingPipeline::GenerateSkyDomeDrawCall(IRenderHardware *rhi, const Camera& camera, const SkyDome& sky_dome)
 {
-    std::shared_ptr<IProgram> program = GenerateShaderProgram(rhi, sky_dome.GetShaderID(), {sky_dome.GetVertexShader(), sky_dome.GetFragmentShader()});
+    uint32 program_handle = RenderResources::kInvalidHandle;
+    auto program_search = program_handle_cache_.find(sky_dome.GetShaderID());
+    if (program_search != program_handle_cache_.end())
+    {
+        program_handle = program_search->second;
+    }
+    else
+    {
+        program_handle = GenerateShaderProgram(rhi, sky_dome.GetShaderID(), {sky_dome.GetVertexShader(), sky_dome.GetFragmentShader()});
+    }
+
+    const std::shared_ptr<IProgram>& program = render_resources_->GetProgram(program_handle);
     if (program == nullptr)
     {
         LOG_ERROR(kTitle, "Failed to generate shader program for sky dome. The sky dome will not be rendered.");
@@ -131,100 +160,121 @@ void RenderingPipeline::GenerateSkyDomeDrawCall(IRenderHardware *rhi, const Came
             .Scale(math::Vec3f(kSkyDomeSphereScale))
             .Translate(camera.position_);
     ModelData model_data{model_matrix, math::Matrix4x4::Identity()};
-    std::shared_ptr<IMesh> sky_dome_mesh = mesh_cache_[primitive_mesh_id_cache_[kSphereMeshIdIndex]];
-    render_passes_[entity_render_pass_index_]->Submit(std::make_unique<SkyDomeDrawCall>(model_data,
-                                                                                        sky_dome.apex_color_,
-                                                                                        sky_dome.center_color_,
-                                                                                        sky_dome_mesh,
-                                                                                        program,
-                                                                                        uniform_manager_));
+    const std::shared_ptr<IMesh>& sky_dome_mesh = render_resources_->GetMesh(primitive_mesh_id_cache_[kSphereMeshIdIndex]);
+    render_passes_[entity_render_pass_index_]->Submit(frame_arena_.New<SkyDomeDrawCall>(model_data,
+                                                                                          sky_dome.apex_color_,
+                                                                                          sky_dome.center_color_,
+                                                                                          sky_dome_mesh,
+                                                                                          program,
+                                                                                          uniform_manager_));
 }
 
-void RenderingPipeline::GenerateDrawCall(IRenderHardware* rhi,
-                                         const Mesh& mesh,
-                                         const Material& material,
-                                         math::Matrix4x4 model_matrix,
-                                         math::Matrix4x4 view_matrix)
+void RenderingPipeline::GenerateDrawCall(IRenderHardware* rhi, const DrawItem& draw_item, const math::Matrix4x4& view_matrix, float far_clip)
 {
-    // Retrieve the mesh
-    auto mesh_search = mesh_cache_.find(mesh.mesh_id_);
-    if (mesh_search == mesh_cache_.end())
+    const Material& material = draw_item.material_;
+    const math::Matrix4x4& model_matrix = draw_item.model_matrix_;
+
+    if (render_resources_->GetMesh(draw_item.mesh_id_) == nullptr)
     {
         LOG_ERROR(kTitle, "Failed to retrieve the mesh used by the entity. The entity will not be rendered.");
         return;
     }
 
     // Retrieve the shader program used by the entity
-    std::shared_ptr<IProgram> program = GenerateShaderProgram(rhi, material.GetShaderID(), material.GetShadersAsList());
-    if (program == nullptr)
+    const uint32 program_handle = GetShaderProgram(rhi, material);
+    if (program_handle == RenderResources::kInvalidHandle)
     {
         LOG_ERROR(kTitle, "Failed to generate shader program for entity. The entity will not be rendered.");
         return;
     }
 
-    // Construct ModelData
-    ModelData model_data{model_matrix, (view_matrix * model_matrix).Inverse()};
-    std::unique_ptr<IDrawCall> draw_call = std::make_unique<EntityDrawCall>(mesh.mesh_id_,
-                                                                            material,
-                                                                            model_data,
-                                                                            mesh_search->second,
-                                                                            program,
-                                                                            rhi->GetDiffuseMapSampler(),
-                                                                            rhi->GetShadowMapSampler(),
-                                                                            uniform_manager_,
-                                                                            texture_cache_[material.GetTextureMap().diffuse_map_]);
-    render_passes_[entity_render_pass_index_]->Submit(std::move(draw_call));
+    // Retrieve the diffuse texture. The render hardware falls back to an empty texture if it has not been loaded.
+    uint32 texture_handle = RenderResources::kInvalidHandle;
+    auto texture_search = texture_handle_cache_.find(material.GetTextureMap().diffuse_map_);
+    if (texture_search != texture_handle_cache_.end())
+    {
+        texture_handle = texture_search->second;
+    }
+
+    const math::Matrix4x4 model_view_matrix = view_matrix * model_matrix;
+    DrawPacket draw_packet{};
+    draw_packet.mesh_handle_ = draw_item.mesh_id_;
+    draw_packet.program_handle_ = program_handle;
+    draw_packet.texture_handle_ = texture_handle;
+    draw_packet.model_index_ = render_resources_->AddModelData(ModelData{model_matrix, model_view_matrix.Inverse()});
+    draw_packet.material_index_ = render_resources_->AddMaterialData(MaterialData{material});
+    draw_packet.two_sided_ = material.two_sided_;
+    draw_packet.wireframe_enabled_ = material.wireframe_enabled_;
+
+    // The camera looks down the negative z axis
+    const float normalized_depth = -model_view_matrix.GetTranslation().z_ / far_clip;
+    const uint64 sort_key = DrawKey::Create(DrawLayer::WORLD,
+                                            false,
+                                            RenderResources::GetSlotIndex(program_handle),
+                                            RenderResources::GetSlotIndex(texture_handle),
+                                            RenderResources::GetSlotIndex(draw_item.mesh_id_),
+                                            normalized_depth);
+    render_passes_[entity_render_pass_index_]->Submit(draw_packet, sort_key);
 }
 
-void RenderingPipeline::GenerateShadowDrawCall(IRenderHardware* rhi,
-                                               uint32 cascade_index,
-                                               const Mesh& mesh,
-                                               const Material& material,
-                                               math::Matrix4x4 model_matrix)
+void RenderingPipeline::GenerateShadowDrawCall(IRenderHardware* rhi, uint32 cascade_index, const ShadowDrawItem& shadow_draw_item)
 {
-    // Retrieve the mesh
-    auto mesh_search = mesh_cache_.find(mesh.mesh_id_);
-    if (mesh_search == mesh_cache_.end())
+    if (render_resources_->GetMesh(shadow_draw_item.mesh_id_) == nullptr)
     {
         LOG_ERROR(kTitle, "Failed to retrieve the mesh used by the entity. The entity will not be rendered.");
         return;
     }
 
     // Retrieve the shader program used by the entity
-    std::shared_ptr<IProgram> program = GenerateShaderProgram(rhi, shadow_map_material_.GetShaderID(), shadow_map_material_.GetShadersAsList());
-    if (program == nullptr)
+    const uint32 program_handle = GetShaderProgram(rhi, shadow_map_material_);
+    if (program_handle == RenderResources::kInvalidHandle)
     {
         LOG_ERROR(kTitle, "Failed to generate shader program for entity. The entity will not be rendered.");
         return;
     }
 
-    // Construct ModelData. Normal matrix is not needed for shadow maps
-    ModelData model_data{model_matrix, math::Matrix4x4::Identity()};
-    std::unique_ptr<IDrawCall> draw_call = std::make_unique<ShadowMapDrawCall>(mesh.mesh_id_,
-                                                                               material,
-                                                                               model_data,
-                                                                               mesh_search->second,
-                                                                               program,
-                                                                               uniform_manager_);
-    render_passes_[cascade_index]->Submit(std::move(draw_call));
+    // Normal matrix is not needed for shadow maps. The material only fills the instance data.
+    DrawPacket draw_packet{};
+    draw_packet.mesh_handle_ = shadow_draw_item.mesh_id_;
+    draw_packet.program_handle_ = program_handle;
+    draw_packet.texture_handle_ = RenderResources::kInvalidHandle;
+    draw_packet.model_index_ = render_resources_->AddModelData(ModelData{shadow_draw_item.model_matrix_, math::Matrix4x4::Identity()});
+    draw_packet.material_index_ = render_resources_->AddMaterialData(MaterialData{shadow_map_material_});
+
+    const uint64 sort_key = DrawKey::Create(DrawLayer::WORLD,
+                                            false,
+                                            RenderResources::GetSlotIndex(program_handle),
+                                            RenderResources::GetSlotIndex(RenderResources::kInvalidHandle),
+                                            RenderResources::GetSlotIndex(shadow_draw_item.mesh_id_),
+                                            0.0F);
+    render_passes_[cascade_index]->Submit(draw_packet, sort_key);
 }
 
 void RenderingPipeline::Sort()
 {
     for (const std::unique_ptr<IRenderPass>& render_pass : render_passes_)
     {
-        render_pass->Sort();
+        render_pass->Sort(worker_thread_pool_);
     }
 }
 
 void RenderingPipeline::Render(IRenderView* render_view, IRenderHardware* rhi)
 {
+    rhi->BeginUniformFrame();
     UpdateLightUniforms(render_view, rhi);
     UpdateShadowMapUniform(render_view, rhi);
-    for (const std::unique_ptr<IRenderPass>& render_pass : render_passes_)
+
+    // Record the render passes concurrently. Only the submission calls the render hardware.
+    worker_thread_pool_.ParallelFor(static_cast<uint32>(render_passes_.size()), [this, render_view](uint32 pass_index)
     {
-        render_pass->Render(render_view, rhi);
+        command_buffers_[pass_index]->Reset();
+        render_passes_[pass_index]->Record(render_view, *command_buffers_[pass_index]);
+    });
+    for (const std::unique_ptr<CommandBuffer>& command_buffer : command_buffers_)
+    {
+        command_buffer->Submit(rhi, *uniform_manager_);
     }
+    rhi->EndUniformFrame();
 }
 
 void RenderingPipeline::ClearRenderCalls()
@@ -233,6 +283,14 @@ void RenderingPipeline::ClearRenderCalls()
     {
         render_pass->ClearDrawCalls();
     }
+    // The recorded commands refer to the destroyed draw calls
+    for (const std::unique_ptr<CommandBuffer>& command_buffer : command_buffers_)
+    {
+        command_buffer->Reset();
+    }
+    render_resources_->ClearFrameData();
+    // Draw calls have been destroyed. The frame's transient memory can be released wholesale.
+    frame_arena_.NextFrame();
 }
 
 void RenderingPipeline::UpdateLightUniforms(IRenderView* render_view, IRenderHardware* rhi)
@@ -242,35 +300,45 @@ void RenderingPipeline::UpdateLightUniforms(IRenderView* render_view, IRenderHar
     assert(render_view->GetSpotLights().size() <= Constants::kMaxSpotLights);
 
     // Update light uniform data
+    const LightClusterGrid& light_cluster_grid = render_view->GetLightClusterGrid();
     LightInformationData light_information_data{static_cast<uint32>(render_view->GetDirectionalLights().size()),
                                                 static_cast<uint32>(render_view->GetPointLights().size()),
-                                                static_cast<uint32>(render_view->GetSpotLights().size())};
-    std::vector<DirectionalLightData> directional_light_data_list{};
-    std::vector<PointLightData> point_light_data_list{};
-    std::vector<SpotLightData> spot_light_data_list{};
+                                                static_cast<uint32>(render_view->GetSpotLights().size()),
+                                                light_cluster_grid};
+    std::vector<DirectionalLightData, ArenaAllocator<DirectionalLightData>> directional_light_data_list{frame_arena_.GetAllocator<DirectionalLightData>()};
+    std::vector<PointLightData, ArenaAllocator<PointLightData>> point_light_data_list{frame_arena_.GetAllocator<PointLightData>()};
+    std::vector<SpotLightData, ArenaAllocator<SpotLightData>> spot_light_data_list{frame_arena_.GetAllocator<SpotLightData>()};
+    directional_light_data_list.reserve(render_view->GetDirectionalLights().size());
+    point_light_data_list.reserve(render_view->GetPointLights().size());
+    spot_light_data_list.reserve(render_view->GetSpotLights().size());
     for (const DirectionalLight& directional_light: render_view->GetDirectionalLights())
     {
         directional_light_data_list.emplace_back(directional_light);
     }
-    for (const auto& [point_light, transform]: render_view->GetPointLights())
+    for (const PointLightEntry& point_light: render_view->GetPointLights())
     {
-        point_light_data_list.emplace_back(transform, point_light);
+        point_light_data_list.emplace_back(point_light.position_, point_light.light_);
     }
-    for (const auto& [spot_light, transform]: render_view->GetSpotLights())
+    for (const SpotLightEntry& spot_light: render_view->GetSpotLights())
     {
-        spot_light_data_list.emplace_back(transform, spot_light);
+        spot_light_data_list.emplace_back(spot_light.position_, spot_light.direction_, spot_light.light_);
     }
-    rhi->UpdateUniformData(uniform_manager_->GetLightInformationUniform(), &light_information_data, sizeof(light_information_data), 0);
-    rhi->UpdateUniformData(uniform_manager_->GetDirectionalLightUniform(), directional_light_data_list.data(), sizeof(DirectionalLightData) * directional_light_data_list.size(), 0);
-    rhi->UpdateUniformData(uniform_manager_->GetPointLightUniform(), point_light_data_list.data(), sizeof(PointLightData) * point_light_data_list.size(), 0);
-    rhi->UpdateUniformData(uniform_manager_->GetSpotLightUniform(), spot_light_data_list.data(), sizeof(SpotLightData) * spot_light_data_list.size(), 0);
+    uniform_manager_->WriteUniform(rhi, UniformBlock::LIGHT_INFORMATION, &light_information_data, sizeof(light_information_data));
+    uniform_manager_->WriteUniform(rhi, UniformBlock::DIRECTIONAL_LIGHTS, directional_light_data_list.data(), sizeof(DirectionalLightData) * directional_light_data_list.size());
+    rhi->UpdateStorageData(uniform_manager_->GetPointLightStorage(), point_light_data_list.data(), sizeof(PointLightData) * point_light_data_list.size(), 0);
+    rhi->UpdateStorageData(uniform_manager_->GetSpotLightStorage(), spot_light_data_list.data(), sizeof(SpotLightData) * spot_light_data_list.size(), 0);
+
+    // Update the lights of each cluster
+    assert(light_cluster_grid.light_indices_.size() <= Constants::kMaxLightClusterIndexCount);
+    rhi->UpdateStorageData(uniform_manager_->GetLightClusterStorage(), light_cluster_grid.clusters_.data(), sizeof(LightCluster) * light_cluster_grid.clusters_.size(), 0);
+    rhi->UpdateStorageData(uniform_manager_->GetLightIndexStorage(), light_cluster_grid.light_indices_.data(), sizeof(uint32) * light_cluster_grid.light_indices_.size(), 0);
 }
 
 void RenderingPipeline::UpdateShadowMapUniform(IRenderView* render_view, IRenderHardware* rhi)
 {
     ShadowMapInformation shadow_map_information{render_view->GetCascadedShadowMap().GetTextureMatrices(),
                                                 render_view->GetCascadedShadowMap().GetViewFarBounds()};
-    rhi->UpdateUniformData(uniform_manager_->GetShadowMapUniform(), &shadow_map_information, sizeof(ShadowMapInformation), 0);
+    uniform_manager_->WriteUniform(rhi, UniformBlock::SHADOW_MAP_INFORMATION, &shadow_map_information, sizeof(ShadowMapInformation));
 }
 
 void RenderingPipeline::LoadPrimitiveMeshes(IRenderHardware* rhi)
@@ -289,29 +357,19 @@ void RenderingPipeline::LoadPrimitiveMeshes(IRenderHardware* rhi)
     std::shared_ptr<IMesh> sphere_mesh = rhi->CreateMesh(sphere_mesh_data.get());
     std::shared_ptr<IMesh> torus_mesh = rhi->CreateMesh(torus_mesh_data.get());
 
-    uint32 box_mesh_id = GenerateNewUniqueIdentifier();
-    mesh_cache_.emplace(box_mesh_id, box_mesh);
-    primitive_mesh_id_cache_[kBoxMeshIdIndex] = box_mesh_id;
-
-    uint32 cone_mesh_id = GenerateNewUniqueIdentifier();
-    mesh_cache_.emplace(cone_mesh_id, cone_mesh);
-    primitive_mesh_id_cache_[kConeMeshIdIndex] = cone_mesh_id;
-
-    uint32 cylinder_mesh_id = GenerateNewUniqueIdentifier();
-    mesh_cache_.emplace(cylinder_mesh_id, cylinder_mesh);
-    primitive_mesh_id_cache_[kCylinderMeshIdIndex] = cylinder_mesh_id;
-
-    uint32 plane_mesh_id = GenerateNewUniqueIdentifier();
-    mesh_cache_.emplace(plane_mesh_id, plane_mesh);
-    primitive_mesh_id_cache_[kPlaneMeshIdIndex] = plane_mesh_id;
-
-    uint32 sphere_mesh_id = GenerateNewUniqueIdentifier();
-    mesh_cache_.emplace(sphere_mesh_id, sphere_mesh);
-    primitive_mesh_id_cache_[kSphereMeshIdIndex] = sphere_mesh_id;
+    primitive_mesh_id_cache_[kBoxMeshIdIndex] = render_resources_->AddMesh(box_mesh);
+    primitive_mesh_id_cache_[kConeMeshIdIndex] = render_resources_->AddMesh(cone_mesh);
+    primitive_mesh_id_cache_[kCylinderMeshIdIndex] = render_resources_->AddMesh(cylinder_mesh);
+    primitive_mesh_id_cache_[kPlaneMeshIdIndex] = render_resources_->AddMesh(plane_mesh);
+    primitive_mesh_id_cache_[kSphereMeshIdIndex] = render_resources_->AddMesh(sphere_mesh);
+    primitive_mesh_id_cache_[kTorusMeshIdIndex] = render_resources_->AddMesh(torus_mesh);
+}
 
-    uint32 torus_mesh_id = GenerateNewUniqueIdentifier();
-    mesh_cache_.emplace(torus_mesh_id, torus_mesh);
-    primitive_mesh_id_cache_[kTorusMeshIdIndex] = torus_mesh_id;
+uint32 RenderingPipeline::LoadPrimitiveInstanceMesh(IRenderHardware* rhi, MeshData* mesh_data)
+{
+    const uint32 mesh_id = LoadMesh(rhi, mesh_data);
+    primitive_instance_mesh_ids_.insert(mesh_id);
+    return mesh_id;
 }
 
 void RenderingPipeline::LoadTextures(IRenderHardware* rhi, AssetManager& asset_manager)
@@ -328,7 +386,7 @@ void RenderingPipeline::LoadTextures(IRenderHardware* rhi, AssetManager& asset_m
 
         if (texture)
         {
-            texture_cache_.emplace(texture_file, texture);
+            texture_handle_cache_.emplace(texture_file, render_resources_->AddTexture(texture));
         }
         else
         {
@@ -400,10 +458,21 @@ void RenderingPipeline::LoadShaders(IRenderHardware* rhi, AssetManager& asset_ma
     }
 }
 
-std::shared_ptr<IProgram> RenderingPipeline::GenerateShaderProgram(IRenderHardware* rhi, uint32 shader_id, const std::vector<std::string>& shader_name_list)
+uint32 RenderingPipeline::GetShaderProgram(IRenderHardware* rhi, const Material& material)
 {
-    auto program_search = program_cache_.find(shader_id);
-    if (program_search != program_cache_.end())
+    auto program_search = program_handle_cache_.find(material.GetShaderID());
+    if (program_search != program_handle_cache_.end())
+    {
+        return program_search->second;
+    }
+    // Only build the list of shader names when the program has to be generated
+    return GenerateShaderProgram(rhi, material.GetShaderID(), material.GetShadersAsList());
+}
+
+uint32 RenderingPipeline::GenerateShaderProgram(IRenderHardware* rhi, uint32 shader_id, const std::vector<std::string>& shader_name_list)
+{
+    auto program_search = program_handle_cache_.find(shader_id);
+    if (program_search != program_handle_cache_.end())
     {
         return program_search->second;
     }
@@ -416,14 +485,11 @@ std::shared_ptr<IProgram> RenderingPipeline::GenerateShaderProgram(IRenderHardwa
             shader_list.push_back(search->second);
         }
     }
+    // Programs that fail to link are cached as the invalid handle so they are not generated again
     std::shared_ptr<IProgram> program = rhi->CreateShaderProgram(shader_list);
-    program_cache_.emplace(shader_id, program);
-    return program;
-}
-
-uint32 RenderingPipeline::GenerateNewUniqueIdentifier()
-{
-    return unique_identifier_++;
+    const uint32 program_handle = program ? render_resources_->AddProgram(std::move(program)) : RenderResources::kInvalidHandle;
+    program_handle_cache_.emplace(shader_id, program_handle);
+    return program_handle;
 }
 
 void RenderingPipeline::ReadShaderSource(const std::string& filename, std::string& destination)
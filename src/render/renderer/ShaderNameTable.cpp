@@ -0,0 +1,36 @@
+#include "render/renderer/ShaderNameTable.hpp"
+
+namespace zero::render
+{
+
+ShaderNameTable& ShaderNameTable::GetTable()
+{
+    static ShaderNameTable kTable{};
+    return kTable;
+}
+
+ShaderNameTable::ShaderNameTable()
+: names_()
+, identifiers_()
+, mutex_()
+{
+}
+
+uint32 ShaderNameTable::Intern(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto [iter, inserted] = identifiers_.try_emplace(name, static_cast<uint32>(names_.size()));
+    if (inserted)
+    {
+        names_.push_back(name);
+    }
+    return iter->second;
+}
+
+const std::string& ShaderNameTable::GetName(uint32 identifier)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return names_[identifier];
+}
+
+} // namespace zero::render
@@ -1,20 +1,31 @@
 #include "render/renderer/UniformManager.hpp"
 #include "render/renderer/UniformBufferData.hpp"
+#include "render/renderer/ShaderNameTable.hpp"
+#include "render/IRenderView.hpp"
 
 namespace zero::render
 {
 
 UniformManager::UniformManager()
-: camera_uniform_(nullptr)
-, material_uniform_()
-, model_uniform_()
-, light_info_uniform_()
-, directional_light_uniform_()
-, point_light_uniform_()
-, spot_light_uniform_()
-, shadow_map_uniform_()
+: uniform_block_name_identifiers_{ShaderNameTable::GetTable().Intern("Camera"),
+                                  ShaderNameTable::GetTable().Intern("Model"),
+                                  ShaderNameTable::GetTable().Intern("LightInformation"),
+                                  ShaderNameTable::GetTable().Intern("DirectionalLights"),
+                                  ShaderNameTable::GetTable().Intern("ShadowMapInformation")}
+, uniform_block_sizes_{sizeof(CameraData),
+                       sizeof(ModelData),
+                       sizeof(LightInformationData),
+                       sizeof(DirectionalLightData) * Constants::kMaxDirectionalLights,
+                       sizeof(ShadowMapInformation)}
+, uniform_ranges_()
+, point_light_storage_()
+, spot_light_storage_()
+, light_cluster_storage_()
+, light_index_storage_()
+, instance_block_name_identifier_(ShaderNameTable::GetTable().Intern("Instances"))
+, instance_range_()
 , shadow_texture_uniform_map_()
-, diffuse_map_uniform_sampler_name_("u_diffuse_texture")
+, diffuse_map_uniform_sampler_identifier_(ShaderNameTable::GetTable().Intern("u_diffuse_texture"))
 , sky_dome_center_color_uniform_name_("u_center_color")
 , sky_dome_apex_color_uniform_name_("u_apex_color")
 {
@@ -22,70 +33,69 @@ UniformManager::UniformManager()
 
 void UniformManager::Initialize(IRenderHardware* rhi)
 {
-    camera_uniform_ = rhi->CreateUniformBuffer("Camera", nullptr, sizeof(CameraData));
-    material_uniform_ = rhi->CreateUniformBuffer("Material", nullptr, sizeof(MaterialData));
-    model_uniform_ = rhi->CreateUniformBuffer("Model", nullptr, sizeof(ModelData));
-    light_info_uniform_ = rhi->CreateUniformBuffer("LightInformation", nullptr, sizeof(LightInformationData));
-    directional_light_uniform_ = rhi->CreateUniformBuffer("DirectionalLights", nullptr, sizeof(DirectionalLightData) * Constants::kMaxDirectionalLights);
-    point_light_uniform_ = rhi->CreateUniformBuffer("PointLights", nullptr, sizeof(PointLightData) * Constants::kMaxPointLights);
-    spot_light_uniform_ = rhi->CreateUniformBuffer("SpotLights", nullptr, sizeof(SpotLightData) * Constants::kMaxSpotLights);
-    shadow_map_uniform_ = rhi->CreateUniformBuffer("ShadowMapInformation", nullptr, sizeof(ShadowMapInformation));
-
-    const std::vector<std::shared_ptr<ITexture>> cascaded_shadow_map_textures = rhi->GetShadowMapTextures();
+    point_light_storage_ = rhi->CreateStorageBuffer("PointLights", nullptr, sizeof(PointLightData) * Constants::kMaxPointLights);
+    spot_light_storage_ = rhi->CreateStorageBuffer("SpotLights", nullptr, sizeof(SpotLightData) * Constants::kMaxSpotLights);
+    light_cluster_storage_ = rhi->CreateStorageBuffer("LightClusters", nullptr, sizeof(LightCluster) * Constants::kLightClusterCount);
+    light_index_storage_ = rhi->CreateStorageBuffer("LightIndices", nullptr, sizeof(uint32) * Constants::kMaxLightClusterIndexCount);
+
+    const std::vector<std::shared_ptr<ITexture>>& cascaded_shadow_map_textures = rhi->GetShadowMapTextures();
     for (uint32 cascade_index = 0; cascade_index < cascaded_shadow_map_textures.size(); ++cascade_index)
     {
-        shadow_texture_uniform_map_.emplace("u_cascaded_shadow_map[" + std::to_string(cascade_index) + "]", cascaded_shadow_map_textures[cascade_index]);
+        const uint32 uniform_identifier = ShaderNameTable::GetTable().Intern("u_cascaded_shadow_map[" + std::to_string(cascade_index) + "]");
+        shadow_texture_uniform_map_.emplace(uniform_identifier, cascaded_shadow_map_textures[cascade_index]);
     }
 }
 
-std::shared_ptr<IUniformBuffer> UniformManager::GetCameraUniform() const
+void UniformManager::WriteUniform(IRenderHardware* rhi, UniformBlock uniform_block, const void* data, uint32 data_size)
 {
-    return camera_uniform_;
+    const auto block_index = static_cast<uint32>(uniform_block);
+    uniform_ranges_[block_index] = rhi->WriteUniformData(data, data_size, uniform_block_sizes_[block_index]);
 }
 
-std::shared_ptr<IUniformBuffer> UniformManager::GetMaterialUniform() const
+void UniformManager::BindUniform(IRenderHardware* rhi, UniformBlock uniform_block) const
 {
-    return material_uniform_;
+    const auto block_index = static_cast<uint32>(uniform_block);
+    rhi->BindUniformRange(uniform_block_name_identifiers_[block_index], uniform_ranges_[block_index]);
 }
 
-std::shared_ptr<IUniformBuffer> UniformManager::GetModelUniform() const
+void UniformManager::WriteInstances(IRenderHardware* rhi, const void* data, uint32 data_size)
 {
-    return model_uniform_;
+    instance_range_ = rhi->WriteStorageData(data, data_size);
 }
 
-std::shared_ptr<IUniformBuffer> UniformManager::GetLightInformationUniform() const
+void UniformManager::BindInstances(IRenderHardware* rhi) const
 {
-    return light_info_uniform_;
+    rhi->BindStorageRange(instance_block_name_identifier_, instance_range_);
 }
 
-std::shared_ptr<IUniformBuffer> UniformManager::GetDirectionalLightUniform() const
+const std::shared_ptr<IStorageBuffer>& UniformManager::GetPointLightStorage() const
 {
-    return directional_light_uniform_;
+    return point_light_storage_;
 }
 
-std::shared_ptr<IUniformBuffer> UniformManager::GetPointLightUniform() const
+const std::shared_ptr<IStorageBuffer>& UniformManager::GetSpotLightStorage() const
 {
-    return point_light_uniform_;
+    return spot_light_storage_;
 }
 
-std::shared_ptr<IUniformBuffer> UniformManager::GetSpotLightUniform() const
+const std::shared_ptr<IStorageBuffer>& UniformManager::GetLightClusterStorage() const
 {
-    return spot_light_uniform_;
+    return light_cluster_storage_;
 }
 
-std::shared_ptr<IUniformBuffer> UniformManager::GetShadowMapUniform() const
+const std::shared_ptr<IStorageBuffer>& UniformManager::GetLightIndexStorage() const
 {
-    return shadow_map_uniform_;
+    return light_index_storage_;
 }
 
-const std::unordered_map<std::string, std::shared_ptr<ITexture>>& UniformManager::GetShadowTextureUniformMap() const
+const std::unordered_map<uint32, std::shared_ptr<ITexture>>& UniformManager::GetShadowTextureUniformMap() const
 {
     return shadow_texture_uniform_map_;
 }
 
-const std::string& UniformManager::GetDiffuseMapUniformSamplerName() const
+uint32 UniformManager::GetDiffuseMapUniformSamplerIdentifier() const
 {
-    return diffuse_map_uniform_sampler_name_;
+    return diffuse_map_uniform_sampler_identifier_;
 }
 
 const std::string& UniformManager::GetSkyDomeApexColorUniformName() const
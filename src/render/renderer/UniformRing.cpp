@@ -0,0 +1,55 @@
+#include "render/renderer/UniformRing.hpp"
+#include <cassert>
+
+namespace zero::render
+{
+
+UniformRing::UniformRing(uint32 region_count, uint32 region_size, uint32 alignment)
+: region_count_(region_count)
+, region_size_(region_size)
+, alignment_(alignment)
+, region_index_(region_count - 1)
+, used_size_(0)
+{
+    assert(region_count_ > 0);
+    assert(alignment_ > 0);
+}
+
+void UniformRing::BeginRegion()
+{
+    region_index_ = (region_index_ + 1) % region_count_;
+    used_size_ = 0;
+}
+
+UniformRange UniformRing::Allocate(uint32 size)
+{
+    const uint32 offset = ((used_size_ + alignment_ - 1) / alignment_) * alignment_;
+    if (offset + size > region_size_)
+    {
+        return UniformRange{GetRegionOffset(), 0};
+    }
+    used_size_ = offset + size;
+    return UniformRange{GetRegionOffset() + offset, size};
+}
+
+uint32 UniformRing::GetRegionIndex() const
+{
+    return region_index_;
+}
+
+uint32 UniformRing::GetRegionOffset() const
+{
+    return region_index_ * region_size_;
+}
+
+uint32 UniformRing::GetUsedSize() const
+{
+    return used_size_;
+}
+
+uint32 UniformRing::GetSize() const
+{
+    return region_count_ * region_size_;
+}
+
+} // namespace zero::render
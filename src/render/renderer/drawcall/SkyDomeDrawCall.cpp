@@ -9,7 +9,7 @@ SkyDomeDrawCall::SkyDomeDrawCall(ModelData model_data,
                                  std::shared_ptr<IMesh> mesh,
                                  std::shared_ptr<IProgram> program,
                                  std::shared_ptr<UniformManager> uniform_manager)
-: draw_key_()
+: sort_key_(DrawKey::Create(DrawLayer::BACKGROUND, false, 0, 0, 0, 0.0F))
 , model_data_(model_data)
 , apex_color_(apex_color)
 , center_color_(center_color)
@@ -17,15 +17,11 @@ SkyDomeDrawCall::SkyDomeDrawCall(ModelData model_data,
 , program_(std::move(program))
 , uniform_manager_(std::move(uniform_manager))
 {
-    // Ensure the sky dome draw call is called first
-    draw_key_.mesh_id_ = 0;
-    draw_key_.texture_id_ = 0;
-    draw_key_.material_id_ = 0;
 }
 
-const DrawKey& SkyDomeDrawCall::GetDrawKey()
+uint64 SkyDomeDrawCall::GetSortKey() const
 {
-    return draw_key_;
+    return sort_key_;
 }
 
 void SkyDomeDrawCall::Draw(IRenderHardware *rhi)
@@ -35,9 +31,9 @@ void SkyDomeDrawCall::Draw(IRenderHardware *rhi)
     rhi->BindShaderProgram(program_);
     rhi->SetFillMode(IRenderHardware::FillMode::FILL_MODE_SOLID);
     rhi->SetCullMode(IRenderHardware::CullMode::CULL_MODE_NONE);
-    rhi->UpdateUniformData(uniform_manager_->GetModelUniform(), &model_data_, sizeof(model_data_), 0);
-    rhi->BindUniformBuffer(uniform_manager_->GetModelUniform());
-    rhi->BindUniformBuffer(uniform_manager_->GetCameraUniform());
+    uniform_manager_->WriteUniform(rhi, UniformBlock::MODEL, &model_data_, sizeof(model_data_));
+    uniform_manager_->BindUniform(rhi, UniformBlock::MODEL);
+    uniform_manager_->BindUniform(rhi, UniformBlock::CAMERA);
     rhi->DrawMesh(sky_dome_mesh_);
 }
 
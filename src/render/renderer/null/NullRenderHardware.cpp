@@ -0,0 +1,317 @@
+#include "render/renderer/null/NullRenderHardware.hpp"
+#include "render/renderer/null/NullResources.hpp"
+#include "render/Constants.hpp"
+#include "core/Logger.hpp"
+#include <cassert>
+
+namespace zero::render
+{
+
+const char* NullRenderHardware::kTitle = "NullRenderHardware";
+
+namespace
+{
+
+/**
+ * @brief A common uniform buffer offset alignment of GPUs
+ */
+constexpr uint32 kUniformRangeAlignment = 256U;
+
+/**
+ * @brief A common storage buffer offset alignment of GPUs
+ */
+constexpr uint32 kStorageRangeAlignment = 16U;
+
+} // namespace
+
+NullRenderHardware::NullRenderHardware()
+: diffuse_map_sampler_(nullptr)
+, shadow_map_sampler_(nullptr)
+, shadow_map_textures_()
+, shadow_map_frame_buffers_()
+, draw_commands_()
+, uniform_ring_(Constants::kUniformRingRegionCount, Constants::kUniformRingRegionSize, kUniformRangeAlignment)
+, storage_ring_(Constants::kUniformRingRegionCount, Constants::kStorageRingRegionSize, kStorageRangeAlignment)
+, state_cache_()
+, program_count_(0)
+, statistics_()
+{
+}
+
+void NullRenderHardware::Initialize()
+{
+    LOG_VERBOSE(kTitle, "Initializing headless render hardware");
+    diffuse_map_sampler_ = std::make_shared<NullSampler>();
+    shadow_map_sampler_ = std::make_shared<NullSampler>();
+    for (uint32 i = 0; i < Constants::kShadowCascadeCount; ++i)
+    {
+        shadow_map_textures_.push_back(std::make_shared<NullTexture>());
+        shadow_map_frame_buffers_.push_back(std::make_shared<NullFrameBuffer>());
+    }
+}
+
+void NullRenderHardware::Shutdown()
+{
+    diffuse_map_sampler_ = nullptr;
+    shadow_map_sampler_ = nullptr;
+    shadow_map_textures_.clear();
+    shadow_map_frame_buffers_.clear();
+}
+
+void NullRenderHardware::SetViewport(uint32 /* x */, uint32 /* y */, uint32 /* width */, uint32 /* height */)
+{
+}
+
+void NullRenderHardware::SetFillMode(FillMode fill_mode)
+{
+    if (!state_cache_.SetFillMode(fill_mode))
+    {
+        ++statistics_.filtered_state_change_count_;
+    }
+}
+
+void NullRenderHardware::SetCullMode(CullMode cull_mode)
+{
+    if (!state_cache_.SetCullMode(cull_mode))
+    {
+        ++statistics_.filtered_state_change_count_;
+    }
+}
+
+void NullRenderHardware::SetClearColor(const math::Vec4f& /* color */)
+{
+}
+
+void NullRenderHardware::Clear()
+{
+}
+
+std::shared_ptr<ISampler> NullRenderHardware::GetDiffuseMapSampler()
+{
+    return diffuse_map_sampler_;
+}
+
+std::shared_ptr<ISampler> NullRenderHardware::GetShadowMapSampler()
+{
+    return shadow_map_sampler_;
+}
+
+const std::vector<std::shared_ptr<ITexture>>& NullRenderHardware::GetShadowMapTextures()
+{
+    return shadow_map_textures_;
+}
+
+const std::vector<std::shared_ptr<IFrameBuffer>>& NullRenderHardware::GetShadowMapFrameBuffers()
+{
+    return shadow_map_frame_buffers_;
+}
+
+void NullRenderHardware::UpdateUniformData(const std::shared_ptr<IUniformBuffer>& uniform_buffer, const void* /* data */, uint32 data_size, uint32 data_offset)
+{
+    assert(uniform_buffer != nullptr);
+    assert(data_offset + data_size <= uniform_buffer->GetSize());
+    ++statistics_.uniform_update_count_;
+    statistics_.uniform_update_bytes_ += data_size;
+}
+
+void NullRenderHardware::UpdateStorageData(const std::shared_ptr<IStorageBuffer>& storage_buffer, const void* /* data */, uint32 data_size, uint32 data_offset)
+{
+    assert(storage_buffer != nullptr);
+    assert(data_offset + data_size <= storage_buffer->GetSize());
+    ++statistics_.storage_update_count_;
+    statistics_.storage_update_bytes_ += data_size;
+}
+
+void NullRenderHardware::UpdateDrawCommands(const DrawIndirectCommand* draw_commands, uint32 draw_command_count)
+{
+    draw_commands_.assign(draw_commands, draw_commands + draw_command_count);
+    ++statistics_.draw_command_update_count_;
+}
+
+void NullRenderHardware::BeginUniformFrame()
+{
+    uniform_ring_.BeginRegion();
+    storage_ring_.BeginRegion();
+}
+
+void NullRenderHardware::EndUniformFrame()
+{
+    // Count the uniform data of the frame as a single update
+    if (uniform_ring_.GetUsedSize() > 0)
+    {
+        ++statistics_.uniform_update_count_;
+        statistics_.uniform_update_bytes_ += uniform_ring_.GetUsedSize();
+    }
+}
+
+UniformRange NullRenderHardware::WriteUniformData(const void* /* data */, uint32 data_size, uint32 block_size)
+{
+    assert(data_size <= block_size);
+    const UniformRange uniform_range = uniform_ring_.Allocate(block_size);
+    // Binding nothing would leave the data of an earlier write bound, such as the camera of another pass
+    assert(uniform_range.size_ > 0 && "The uniform ring region of the frame is full");
+    if (uniform_range.size_ == 0)
+    {
+        LOG_ERROR(kTitle, "The uniform ring region of the frame is full");
+        return uniform_range;
+    }
+    ++statistics_.uniform_write_count_;
+    statistics_.uniform_write_bytes_ += data_size;
+    return uniform_range;
+}
+
+UniformRange NullRenderHardware::WriteStorageData(const void* /* data */, uint32 data_size)
+{
+    const UniformRange storage_range = storage_ring_.Allocate(data_size);
+    assert(storage_range.size_ > 0 && "The storage ring region of the frame is full");
+    if (storage_range.size_ == 0)
+    {
+        LOG_ERROR(kTitle, "The storage ring region of the frame is full");
+        return storage_range;
+    }
+    ++statistics_.storage_write_count_;
+    statistics_.storage_write_bytes_ += data_size;
+    return storage_range;
+}
+
+std::shared_ptr<IMesh> NullRenderHardware::CreateMesh(MeshData* mesh_data)
+{
+    return std::make_shared<NullMesh>(static_cast<uint32>(mesh_data->indices_.size()));
+}
+
+std::shared_ptr<IShader> NullRenderHardware::CreateShader(const ShaderStage& shader_stage)
+{
+    return std::make_shared<NullShader>(shader_stage.type_);
+}
+
+std::shared_ptr<IProgram> NullRenderHardware::CreateShaderProgram(const std::vector<std::shared_ptr<IShader>>& shaders)
+{
+    if (shaders.empty())
+    {
+        LOG_ERROR(kTitle, "Cannot create a shader program without any shaders");
+        return nullptr;
+    }
+    // Identifier 0 is the unbound program
+    return std::make_shared<NullProgram>(++program_count_);
+}
+
+std::shared_ptr<ITexture> NullRenderHardware::CreateTexture(std::unique_ptr<Image> /* image */)
+{
+    return std::make_shared<NullTexture>();
+}
+
+std::shared_ptr<IUniformBuffer> NullRenderHardware::CreateUniformBuffer(std::string buffer_name, const void* /* initial_data */, uint32 buffer_size)
+{
+    return std::make_shared<NullUniformBuffer>(std::move(buffer_name), buffer_size);
+}
+
+std::shared_ptr<IStorageBuffer> NullRenderHardware::CreateStorageBuffer(std::string buffer_name, const void* /* initial_data */, uint32 buffer_size)
+{
+    return std::make_shared<NullStorageBuffer>(std::move(buffer_name), buffer_size);
+}
+
+void NullRenderHardware::BeginFrame(const std::shared_ptr<IFrameBuffer>& /* frame_buffer */)
+{
+}
+
+void NullRenderHardware::EndFrame()
+{
+    state_cache_.SetProgram(0);
+    ++statistics_.frame_count_;
+}
+
+void NullRenderHardware::BindShaderProgram(const std::shared_ptr<IProgram>& shader_program)
+{
+    assert(shader_program != nullptr);
+    if (!state_cache_.SetProgram(static_cast<const NullProgram*>(shader_program.get())->GetIdentifier()))
+    {
+        ++statistics_.filtered_state_change_count_;
+        return;
+    }
+    ++statistics_.program_bind_count_;
+}
+
+void NullRenderHardware::BindTexture(const std::shared_ptr<ITexture>& /* texture */, const std::shared_ptr<ISampler>& texture_sampler, uint32 /* uniform_name_identifier */)
+{
+    assert(texture_sampler != nullptr);
+    ++statistics_.texture_bind_count_;
+}
+
+void NullRenderHardware::BindUniformBuffer(const std::shared_ptr<IUniformBuffer>& uniform_buffer)
+{
+    assert(uniform_buffer != nullptr);
+    ++statistics_.uniform_buffer_bind_count_;
+}
+
+void NullRenderHardware::BindStorageRange(uint32 /* block_name_identifier */, const UniformRange& storage_range)
+{
+    assert(storage_range.size_ > 0 && "The storage block was not written this frame");
+    assert(storage_range.offset_ + storage_range.size_ <= storage_ring_.GetSize());
+    ++statistics_.storage_buffer_bind_count_;
+}
+
+void NullRenderHardware::BindStorageBuffer(const std::shared_ptr<IStorageBuffer>& storage_buffer)
+{
+    assert(storage_buffer != nullptr);
+    ++statistics_.storage_buffer_bind_count_;
+}
+
+void NullRenderHardware::BindUniformRange(uint32 /* block_name_identifier */, const UniformRange& uniform_range)
+{
+    assert(uniform_range.size_ > 0 && "The uniform block was not written this frame");
+    assert(uniform_range.offset_ + uniform_range.size_ <= uniform_ring_.GetSize());
+    ++statistics_.uniform_buffer_bind_count_;
+}
+
+void NullRenderHardware::DrawMesh(const std::shared_ptr<IMesh>& mesh)
+{
+    assert(mesh != nullptr);
+    ++statistics_.draw_count_;
+    ++statistics_.instance_count_;
+}
+
+void NullRenderHardware::DrawMeshInstanced(const std::shared_ptr<IMesh>& mesh, uint32 instance_count, uint32 /* first_instance */)
+{
+    assert(mesh != nullptr);
+    ++statistics_.draw_count_;
+    statistics_.instance_count_ += instance_count;
+}
+
+void NullRenderHardware::MultiDrawMeshIndirect(const std::shared_ptr<IMesh>& mesh, uint32 first_command, uint32 command_count)
+{
+    assert(mesh != nullptr);
+    assert(first_command + command_count <= draw_commands_.size());
+    ++statistics_.draw_count_;
+    for (uint32 i = first_command; i < first_command + command_count; ++i)
+    {
+        statistics_.instance_count_ += draw_commands_[i].instance_count_;
+    }
+}
+
+uint32 NullRenderHardware::GetFilteredStateChangeCount() const
+{
+    return statistics_.filtered_state_change_count_;
+}
+
+void NullRenderHardware::ResetFilteredStateChangeCount()
+{
+    statistics_.filtered_state_change_count_ = 0;
+}
+
+GeometryArena::Statistics NullRenderHardware::GetGeometryStatistics() const
+{
+    // Null meshes do not share geometry buffers
+    return GeometryArena::Statistics{};
+}
+
+const NullRenderHardware::Statistics& NullRenderHardware::GetStatistics() const
+{
+    return statistics_;
+}
+
+void NullRenderHardware::ResetStatistics()
+{
+    statistics_ = Statistics{};
+}
+
+} // namespace zero::render
@@ -3,32 +3,41 @@
 namespace zero::render
 {
 
-GLMesh::GLMesh(GLuint vao_identifier, GLuint vertex_buffer, GLuint index_buffer, uint32 index_data_size)
-: vao_id_(vao_identifier)
-, vertex_buffer_id_(vertex_buffer)
-, index_buffer_id_(index_buffer)
-, index_data_size_(index_data_size)
+GLMesh::GLMesh(std::shared_ptr<GeometryArena> geometry_arena, const GeometryArena::Allocation& allocation)
+: geometry_arena_(std::move(geometry_arena))
+, allocation_(allocation)
 {
 }
 
-GLuint GLMesh::GetVAOIdentifier() const
+GLMesh::~GLMesh()
 {
-    return vao_id_;
+    geometry_arena_->Free(allocation_);
 }
 
-GLuint GLMesh::GetVertexBufferIdentifier() const
+uint32 GLMesh::GetPageIndex() const
 {
-    return vertex_buffer_id_;
+    return allocation_.page_index_;
 }
 
-GLuint GLMesh::GetIndexBufferIdentifier() const
+uint32 GLMesh::GetIndexCount() const
 {
-    return index_buffer_id_;
+    return allocation_.index_count_;
 }
 
-uint32 GLMesh::GetIndexDataSize() const
+uint32 GLMesh::GetFirstIndex() const
 {
-    return index_data_size_;
+    return allocation_.first_index_;
+}
+
+uint32 GLMesh::GetBaseVertex() const
+{
+    return allocation_.base_vertex_;
+}
+
+uint32 GLMesh::GetGeometryIdentifier() const
+{
+    // The meshes of a page share its buffers
+    return allocation_.page_index_;
 }
 
 } // namespace zero::render
\ No newline at end of file
@@ -1,12 +1,66 @@
 #include "render/renderer/opengl/GLProgram.hpp"
 #include "render/renderer/opengl/GLShader.hpp"
+#include "render/renderer/ShaderNameTable.hpp"
 #include "core/Logger.hpp"
 
 namespace zero::render
 {
 
+namespace
+{
+
+/**
+ * @brief Get the name of an active resource of a program
+ */
+std::string GetResourceName(GLuint program_id, GLenum program_interface, GLuint resource_index)
+{
+    const GLenum name_length_property = GL_NAME_LENGTH;
+    GLint name_length = 0;
+    glGetProgramResourceiv(program_id, program_interface, resource_index, 1, &name_length_property, 1, nullptr, &name_length);
+    std::string name(static_cast<std::size_t>(name_length), '\0');
+    glGetProgramResourceName(program_id, program_interface, resource_index, name_length, &name_length, name.data());
+    name.resize(static_cast<std::size_t>(name_length));
+    return name;
+}
+
+bool IsSamplerType(GLenum type)
+{
+    switch (type)
+    {
+        case GL_SAMPLER_1D:
+        case GL_SAMPLER_2D:
+        case GL_SAMPLER_3D:
+        case GL_SAMPLER_CUBE:
+        case GL_SAMPLER_1D_SHADOW:
+        case GL_SAMPLER_2D_SHADOW:
+        case GL_SAMPLER_1D_ARRAY:
+        case GL_SAMPLER_2D_ARRAY:
+        case GL_SAMPLER_1D_ARRAY_SHADOW:
+        case GL_SAMPLER_2D_ARRAY_SHADOW:
+        case GL_SAMPLER_CUBE_SHADOW:
+        case GL_SAMPLER_CUBE_MAP_ARRAY:
+        case GL_SAMPLER_CUBE_MAP_ARRAY_SHADOW:
+        case GL_SAMPLER_2D_MULTISAMPLE:
+        case GL_SAMPLER_2D_MULTISAMPLE_ARRAY:
+        case GL_SAMPLER_2D_RECT:
+        case GL_SAMPLER_2D_RECT_SHADOW:
+        case GL_SAMPLER_BUFFER:
+        case GL_INT_SAMPLER_2D:
+        case GL_UNSIGNED_INT_SAMPLER_2D:
+            return true;
+        default:
+            return false;
+    }
+}
+
+} // namespace
+
 GLProgram::GLProgram(GLuint program_id)
 : program_id_(program_id)
+, uniform_locations_()
+, uniform_block_bindings_()
+, storage_block_bindings_()
+, texture_units_()
 , matrix4x4_map_()
 , matrix3x3_map_()
 , vec4f_map_()
@@ -14,99 +68,150 @@ GLProgram::GLProgram(GLuint program_id)
 , int32_map_()
 , float_map_()
 {
+    Reflect();
+}
+
+GLProgram::~GLProgram()
+{
+    glDeleteProgram(program_id_);
 }
 
 void GLProgram::SetUniform(const std::string& name, math::Matrix4x4 value)
 {
-    matrix4x4_map_[name] = value;
+    matrix4x4_map_[ShaderNameTable::GetTable().Intern(name)] = value;
 }
 
 void GLProgram::SetUniform(const std::string& name, math::Matrix3x3 value)
 {
-    matrix3x3_map_[name] = value;
+    matrix3x3_map_[ShaderNameTable::GetTable().Intern(name)] = value;
 }
 
 void GLProgram::SetUniform(const std::string& name, math::Vec4f value)
 {
-    vec4f_map_[name] = value;
+    vec4f_map_[ShaderNameTable::GetTable().Intern(name)] = value;
 }
 
 void GLProgram::SetUniform(const std::string& name, math::Vec3f value)
 {
-    vec3f_map_[name] = value;
+    vec3f_map_[ShaderNameTable::GetTable().Intern(name)] = value;
 }
 
 void GLProgram::SetUniform(const std::string& name, int32 value)
 {
-    int32_map_[name] = value;
+    int32_map_[ShaderNameTable::GetTable().Intern(name)] = value;
 }
 
 void GLProgram::SetUniform(const std::string& name, float value)
 {
-    float_map_[name] = value;
+    float_map_[ShaderNameTable::GetTable().Intern(name)] = value;
 }
 
-const GLProgram::UniformMap<math::Matrix4x4>& GLProgram::GetMatrix4x4Map() const
-{
-    return matrix4x4_map_;
-}
-
-const GLProgram::UniformMap<math::Matrix3x3>& GLProgram::GetMatrix3x3Map() const
+GLuint GLProgram::GetIdentifier() const
 {
-    return matrix3x3_map_;
+    return program_id_;
 }
 
-const GLProgram::UniformMap<math::Vec4f>& GLProgram::GetVec4fMap() const
+uint32 GLProgram::GetUniformBlockBinding(uint32 name_identifier) const
 {
-    return vec4f_map_;
+    return FindBinding(uniform_block_bindings_, name_identifier);
 }
 
-const GLProgram::UniformMap<math::Vec3f>& GLProgram::GetVec3fMap() const
+uint32 GLProgram::GetStorageBlockBinding(uint32 name_identifier) const
 {
-    return vec3f_map_;
+    return FindBinding(storage_block_bindings_, name_identifier);
 }
 
-const GLProgram::UniformMap<int32>& GLProgram::GetInt32Map() const
+uint32 GLProgram::GetTextureUnit(uint32 name_identifier) const
 {
-    return int32_map_;
+    return FindBinding(texture_units_, name_identifier);
 }
 
-const GLProgram::UniformMap<float>& GLProgram::GetFloatMap() const
+void GLProgram::FlushUniforms() const
 {
-    return float_map_;
+    const auto flush = [this](const auto& uniform_map, const auto& set_uniform)
+    {
+        for (const auto& [name_identifier, value] : uniform_map)
+        {
+            const auto iter = uniform_locations_.find(name_identifier);
+            if (iter != uniform_locations_.end())
+            {
+                set_uniform(iter->second, value);
+            }
+        }
+    };
+    flush(matrix4x4_map_, [](GLint location, const math::Matrix4x4& value) { glUniformMatrix4fv(location, 1, GL_TRUE, &value[0][0]); });
+    flush(matrix3x3_map_, [](GLint location, const math::Matrix3x3& value) { glUniformMatrix3fv(location, 1, GL_TRUE, &value[0][0]); });
+    flush(vec4f_map_, [](GLint location, const math::Vec4f& value) { glUniform4fv(location, 1, value.Data()); });
+    flush(vec3f_map_, [](GLint location, const math::Vec3f& value) { glUniform3fv(location, 1, value.Data()); });
+    flush(int32_map_, [](GLint location, int32 value) { glUniform1i(location, value); });
+    flush(float_map_, [](GLint location, float value) { glUniform1f(location, value); });
 }
 
-GLuint GLProgram::GetIdentifier() const
+void GLProgram::Reflect()
 {
-    return program_id_;
-}
+    ShaderNameTable& name_table = ShaderNameTable::GetTable();
 
-void GLProgram::FlushUniforms() const
-{
-    for (const auto& iter : matrix4x4_map_)
-    {
-        glUniformMatrix4fv(glGetUniformLocation(program_id_, iter.first.c_str()), 1, GL_TRUE, &iter.second[0][0]);
-    }
-    for (const auto& iter : matrix3x3_map_)
+    // Every block is bound to the binding point of its index
+    GLint uniform_block_count = 0;
+    glGetProgramInterfaceiv(program_id_, GL_UNIFORM_BLOCK, GL_ACTIVE_RESOURCES, &uniform_block_count);
+    for (GLuint block_index = 0; block_index < static_cast<GLuint>(uniform_block_count); ++block_index)
     {
-        glUniformMatrix3fv(glGetUniformLocation(program_id_, iter.first.c_str()), 1, GL_TRUE, &iter.second[0][0]);
+        glUniformBlockBinding(program_id_, block_index, block_index);
+        uniform_block_bindings_.emplace(name_table.Intern(GetResourceName(program_id_, GL_UNIFORM_BLOCK, block_index)), block_index);
     }
-    for (const auto& iter : vec4f_map_)
-    {
-        glUniform4fv(glGetUniformLocation(program_id_, iter.first.c_str()), 1, (iter.second).Data());
-    }
-    for (const auto& iter : vec3f_map_)
-    {
-        glUniform3fv(glGetUniformLocation(program_id_, iter.first.c_str()), 1, (iter.second).Data());
-    }
-    for (const auto& iter : int32_map_)
+
+    GLint storage_block_count = 0;
+    glGetProgramInterfaceiv(program_id_, GL_SHADER_STORAGE_BLOCK, GL_ACTIVE_RESOURCES, &storage_block_count);
+    for (GLuint block_index = 0; block_index < static_cast<GLuint>(storage_block_count); ++block_index)
     {
-        glUniform1i(glGetUniformLocation(program_id_, iter.first.c_str()), iter.second);
+        glShaderStorageBlockBinding(program_id_, block_index, block_index);
+        storage_block_bindings_.emplace(name_table.Intern(GetResourceName(program_id_, GL_SHADER_STORAGE_BLOCK, block_index)), block_index);
     }
-    for (const auto& iter : float_map_)
+
+    // Cache the locations of the default block uniforms. Samplers are assigned texture units in order.
+    GLint uniform_count = 0;
+    glGetProgramInterfaceiv(program_id_, GL_UNIFORM, GL_ACTIVE_RESOURCES, &uniform_count);
+    const GLenum properties[] = {GL_BLOCK_INDEX, GL_TYPE, GL_LOCATION, GL_ARRAY_SIZE};
+    uint32 texture_unit = 0;
+    for (GLuint uniform_index = 0; uniform_index < static_cast<GLuint>(uniform_count); ++uniform_index)
     {
-        glUniform1f(glGetUniformLocation(program_id_, iter.first.c_str()), iter.second);
+        GLint values[4] = {0, 0, 0, 0};
+        glGetProgramResourceiv(program_id_, GL_UNIFORM, uniform_index, 4, properties, 4, nullptr, values);
+        const GLint block_index = values[0];
+        const auto type = static_cast<GLenum>(values[1]);
+        const GLint location = values[2];
+        const GLint array_size = values[3];
+        if (block_index != -1 || location < 0)
+        {
+            continue;
+        }
+
+        // Arrays are reported by their first element. Every element is cached under its own name.
+        std::string name = GetResourceName(program_id_, GL_UNIFORM, uniform_index);
+        const bool is_array = name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0;
+        if (is_array)
+        {
+            name.resize(name.size() - 3);
+            uniform_locations_.emplace(name_table.Intern(name), location);
+        }
+        for (GLint element = 0; element < array_size; ++element)
+        {
+            const uint32 name_identifier = name_table.Intern(is_array ? name + "[" + std::to_string(element) + "]" : name);
+            uniform_locations_.emplace(name_identifier, location + element);
+            if (IsSamplerType(type))
+            {
+                glProgramUniform1i(program_id_, location + element, static_cast<GLint>(texture_unit));
+                texture_units_.emplace(name_identifier, texture_unit);
+                ++texture_unit;
+            }
+        }
     }
 }
 
+uint32 GLProgram::FindBinding(const std::unordered_map<uint32, uint32>& bindings, uint32 name_identifier)
+{
+    const auto iter = bindings.find(name_identifier);
+    return iter == bindings.end() ? kUnusedBinding : iter->second;
+}
+
 } // namespace zero::render
\ No newline at end of file
@@ -5,10 +5,13 @@
 #include "render/renderer/opengl/GLRenderHardware.hpp"
 #include "render/renderer/opengl/GLSampler.hpp"
 #include "render/renderer/opengl/GLShader.hpp"
+#include "render/renderer/opengl/GLStorageBuffer.hpp"
 #include "render/renderer/opengl/GLTexture.hpp"
 #include "render/renderer/opengl/GLUniformBuffer.hpp"
 #include "core/Logger.hpp"
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 
 namespace zero::render
 {
@@ -38,14 +41,23 @@ const char* GLRenderHardware::kTitle = "GLRenderHardware";
 GLRenderHardware::GLRenderHardware()
 : diffuse_map_sampler_(nullptr)
 , shadow_map_sampler_(nullptr)
-, meshes_()
-, shaders_()
-, programs_()
-, textures_()
+, geometry_arena_(std::make_shared<GeometryArena>(Constants::kGeometryPageVertexCount, Constants::kGeometryPageIndexCount))
+, geometry_pages_()
+, geometry_vertex_array_(0)
 , uniform_buffers_()
+, storage_buffers_()
+, draw_command_buffer_(0)
+, draw_command_capacity_(0)
+, uniform_ring_(Constants::kUniformRingRegionCount, Constants::kUniformRingRegionSize, 1)
+, uniform_ring_buffer_(0)
+, uniform_ring_data_(nullptr)
+, storage_ring_(Constants::kUniformRingRegionCount, Constants::kStorageRingRegionSize, 1)
+, storage_ring_buffer_(0)
+, storage_ring_data_(nullptr)
+, uniform_ring_fences_()
+, state_cache_()
 , bound_shader_program_(nullptr)
-, available_texture_unit_index_(0)
-, available_uniform_buffer_binding_point(0)
+, used_texture_unit_count_(0)
 {
 }
 
@@ -130,14 +142,54 @@ void GLRenderHardware::Initialize()
                  GL_RGBA,           // Format of the pixel data
                  GL_UNSIGNED_BYTE,  // Data type of the pixel data
                  data);             // Pointer to the image data in memory
-    textures_.push_back(empty_texture);
     glBindTexture(GL_TEXTURE_2D, 0);
     empty_texture_ = std::make_shared<GLTexture>(empty_texture, GL_TEXTURE_2D);
 
+    // Create the uniform and storage rings. The mappings are coherent, so writes are visible to the draws issued after them.
+    GLint uniform_offset_alignment = 1;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniform_offset_alignment);
+    uniform_ring_ = UniformRing(Constants::kUniformRingRegionCount, Constants::kUniformRingRegionSize, static_cast<uint32>(uniform_offset_alignment));
+    const GLbitfield ring_flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glCreateBuffers(1, &uniform_ring_buffer_);
+    glNamedBufferStorage(uniform_ring_buffer_, uniform_ring_.GetSize(), nullptr, ring_flags);
+    uniform_ring_data_ = static_cast<uint8*>(glMapNamedBufferRange(uniform_ring_buffer_,
+                                                                   0,
+                                                                   uniform_ring_.GetSize(),
+                                                                   ring_flags));
+
+    GLint storage_offset_alignment = 1;
+    glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &storage_offset_alignment);
+    storage_ring_ = UniformRing(Constants::kUniformRingRegionCount, Constants::kStorageRingRegionSize, static_cast<uint32>(storage_offset_alignment));
+    glCreateBuffers(1, &storage_ring_buffer_);
+    glNamedBufferStorage(storage_ring_buffer_, storage_ring_.GetSize(), nullptr, ring_flags);
+    storage_ring_data_ = static_cast<uint8*>(glMapNamedBufferRange(storage_ring_buffer_,
+                                                                   0,
+                                                                   storage_ring_.GetSize(),
+                                                                   ring_flags));
+
+    // Create the vertex array of the shared geometry buffers. The buffers are attached when a page is drawn.
+    constexpr uint32 position_attribute_index = 0;
+    constexpr uint32 normal_attribute_index = 1;
+    constexpr uint32 uv_attribute_index = 2;
+    constexpr uint32 vertex_buffer_binding_index = 0;
+    glCreateVertexArrays(1, &geometry_vertex_array_);
+    for (uint32 attribute_index : {position_attribute_index, normal_attribute_index, uv_attribute_index})
+    {
+        glEnableVertexArrayAttrib(geometry_vertex_array_, attribute_index);
+        glVertexArrayAttribBinding(geometry_vertex_array_, attribute_index, vertex_buffer_binding_index);
+    }
+    glVertexArrayAttribFormat(geometry_vertex_array_, position_attribute_index, 3, GL_FLOAT, GL_FALSE, offsetof(Vertex, position_));
+    glVertexArrayAttribFormat(geometry_vertex_array_, normal_attribute_index,   3, GL_FLOAT, GL_FALSE, offsetof(Vertex, normal_));
+    glVertexArrayAttribFormat(geometry_vertex_array_, uv_attribute_index,       2, GL_FLOAT, GL_FALSE, offsetof(Vertex, texture_coordinate_));
+    CreateGeometryPages();
+
 #if LOGGING_ENABLED
     glEnable(GL_DEBUG_OUTPUT);
     glDebugMessageCallback(GLMessageCallback, nullptr);
 #endif
+
+    // The state set above is not tracked
+    state_cache_.Invalidate();
 }
 
 void GLRenderHardware::Shutdown()
@@ -146,25 +198,32 @@ void GLRenderHardware::Shutdown()
     GLuint shadow_sampler_id = shadow_map_sampler_->GetIdentifier();
     glDeleteSamplers(1, &diffuse_sampler_id);
     glDeleteSamplers(1, &shadow_sampler_id);
-    for (const std::shared_ptr<GLMesh>& gl_mesh : meshes_)
+    for (const GeometryPage& geometry_page : geometry_pages_)
     {
-        GLuint vao_id = gl_mesh->GetVAOIdentifier();
-        GLuint vertex_buffer_id = gl_mesh->GetVertexBufferIdentifier();
-        GLuint index_buffer_id = gl_mesh->GetIndexBufferIdentifier();
-        glDeleteVertexArrays(1, &vao_id);
-        glDeleteBuffers(1, &vertex_buffer_id);
-        glDeleteBuffers(1, &index_buffer_id);
+        glDeleteBuffers(1, &geometry_page.vertex_buffer_);
+        glDeleteBuffers(1, &geometry_page.index_buffer_);
     }
-    for (GLuint program_id : programs_)
+    geometry_pages_.clear();
+    glDeleteVertexArrays(1, &geometry_vertex_array_);
+    // Shaders, programs, and textures delete their objects when released. Release the ones owned here while the
+    // context is still current.
+    shadow_map_textures_.clear();
+    empty_texture_ = nullptr;
+    glDeleteBuffers(static_cast<GLint>(uniform_buffers_.size()), uniform_buffers_.data());
+    glDeleteBuffers(static_cast<GLint>(storage_buffers_.size()), storage_buffers_.data());
+    glDeleteBuffers(1, &draw_command_buffer_);
+    for (GLsync& fence : uniform_ring_fences_)
     {
-        glDeleteProgram(program_id);
+        glDeleteSync(fence);
+        fence = nullptr;
     }
-    for (GLuint shader_id : shaders_)
-    {
-        glDeleteShader(shader_id);
-    }
-    glDeleteTextures(static_cast<GLint>(textures_.size()), textures_.data());
-    glDeleteBuffers(static_cast<GLint>(uniform_buffers_.size()), uniform_buffers_.data());
+    glUnmapNamedBuffer(uniform_ring_buffer_);
+    glDeleteBuffers(1, &uniform_ring_buffer_);
+    uniform_ring_data_ = nullptr;
+    glUnmapNamedBuffer(storage_ring_buffer_);
+    glDeleteBuffers(1, &storage_ring_buffer_);
+    storage_ring_data_ = nullptr;
+    state_cache_.Invalidate();
 }
 
 void GLRenderHardware::SetViewport(uint32 x, uint32 y, uint32 width, uint32 height)
@@ -174,6 +233,11 @@ void GLRenderHardware::SetViewport(uint32 x, uint32 y, uint32 width, uint32 heig
 
 void GLRenderHardware::SetFillMode(FillMode fill_mode)
 {
+    if (!state_cache_.SetFillMode(fill_mode))
+    {
+        return;
+    }
+
     switch (fill_mode)
     {
         case FillMode::FILL_MODE_WIREFRAME:
@@ -187,6 +251,11 @@ void GLRenderHardware::SetFillMode(FillMode fill_mode)
 
 void GLRenderHardware::SetCullMode(CullMode cull_mode)
 {
+    if (!state_cache_.SetCullMode(cull_mode))
+    {
+        return;
+    }
+
     switch (cull_mode)
     {
         case CullMode::CULL_MODE_NONE:
@@ -233,7 +302,7 @@ const std::vector<std::shared_ptr<IFrameBuffer>>& GLRenderHardware::GetShadowMap
     return shadow_map_frame_buffers_;
 }
 
-void GLRenderHardware::UpdateUniformData(std::shared_ptr<IUniformBuffer> uniform_buffer,
+void GLRenderHardware::UpdateUniformData(const std::shared_ptr<IUniformBuffer>& uniform_buffer,
                                          const void *data,
                                          uint32 data_size,
                                          uint32 data_offset)
@@ -249,50 +318,127 @@ void GLRenderHardware::UpdateUniformData(std::shared_ptr<IUniformBuffer> uniform
         return;
     }
 
-    std::shared_ptr<GLUniformBuffer> gl_uniform_buffer = std::static_pointer_cast<GLUniformBuffer>(uniform_buffer);
+    auto* gl_uniform_buffer = static_cast<GLUniformBuffer*>(uniform_buffer.get());
     glNamedBufferSubData(gl_uniform_buffer->GetIdentifier(), data_offset, data_size, data);
 }
 
-//////////////////////////////////////////////////
-////////// Create Methods
-//////////////////////////////////////////////////
+void GLRenderHardware::UpdateStorageData(const std::shared_ptr<IStorageBuffer>& storage_buffer,
+                                         const void* data,
+                                         uint32 data_size,
+                                         uint32 data_offset)
+{
+    if (!storage_buffer)
+    {
+        return;
+    }
 
-std::shared_ptr<IMesh> GLRenderHardware::CreateMesh(MeshData* mesh_data)
+    if (data_size + data_offset > storage_buffer->GetSize())
+    {
+        LOG_ERROR(kTitle, "Data size is greater than total storage buffer size");
+        return;
+    }
+
+    auto* gl_storage_buffer = static_cast<GLStorageBuffer*>(storage_buffer.get());
+    glNamedBufferSubData(gl_storage_buffer->GetIdentifier(), data_offset, data_size, data);
+}
+
+void GLRenderHardware::UpdateDrawCommands(const DrawIndirectCommand* draw_commands, uint32 draw_command_count)
 {
-    GLuint vao;
-    glGenVertexArrays(1, &vao);
-    glBindVertexArray(vao);
+    const auto data_size = static_cast<GLsizeiptr>(sizeof(DrawIndirectCommand) * draw_command_count);
+    if (draw_command_count > draw_command_capacity_)
+    {
+        // Grow geometrically so that the buffer is rarely reallocated
+        draw_command_capacity_ = std::max(draw_command_count, draw_command_capacity_ * 2);
+        if (draw_command_buffer_ == 0)
+        {
+            glCreateBuffers(1, &draw_command_buffer_);
+        }
+        glNamedBufferData(draw_command_buffer_,
+                          static_cast<GLsizeiptr>(sizeof(DrawIndirectCommand) * draw_command_capacity_),
+                          nullptr,
+                          GL_DYNAMIC_DRAW);
+    }
+    glNamedBufferSubData(draw_command_buffer_, 0, data_size, draw_commands);
+}
 
-    GLuint vertex_buffer;
-    glGenBuffers(1, &vertex_buffer);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer);
-    uint32 data_size = sizeof(Vertex) * mesh_data->vertices_.size();
-    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(data_size), mesh_data->vertices_.data(), GL_STATIC_DRAW);
+void GLRenderHardware::BeginUniformFrame()
+{
+    uniform_ring_.BeginRegion();
+    storage_ring_.BeginRegion();
 
-    constexpr uint32 position_attribute_index = 0;
-    constexpr uint32 normal_attribute_index = 1;
-    constexpr uint32 uv_attribute_index = 2;
-    glEnableVertexAttribArray(position_attribute_index);
-    glEnableVertexAttribArray(normal_attribute_index);
-    glEnableVertexAttribArray(uv_attribute_index);
-    glVertexAttribPointer(position_attribute_index,    3, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<void*>(offsetof(Vertex, position_)));
-    glVertexAttribPointer(normal_attribute_index,      3, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<void*>(offsetof(Vertex, normal_)));
-    glVertexAttribPointer(uv_attribute_index,          2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<void*>(offsetof(Vertex, texture_coordinate_)));
+    // Wait for the GPU to finish reading the frame that last wrote to the regions
+    GLsync& fence = uniform_ring_fences_[uniform_ring_.GetRegionIndex()];
+    if (fence)
+    {
+        constexpr GLuint64 kFenceTimeout = 1000000000; // 1 second in nanoseconds
+        while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, kFenceTimeout) == GL_TIMEOUT_EXPIRED)
+        {
+            LOG_WARN(kTitle, "Waiting for the GPU to release a uniform ring region");
+        }
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+}
 
-    uint32 index_count = mesh_data->indices_.size();
-    GLuint index_buffer;
-    glGenBuffers(1, &index_buffer);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, index_buffer);
-    data_size = sizeof(uint32) * index_count;
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(data_size), mesh_data->indices_.data(), GL_STATIC_DRAW);
+void GLRenderHardware::EndUniformFrame()
+{
+    uniform_ring_fences_[uniform_ring_.GetRegionIndex()] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
 
-    glBindVertexArray(0);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+UniformRange GLRenderHardware::WriteUniformData(const void* data, uint32 data_size, uint32 block_size)
+{
+    assert(data_size <= block_size);
+    const UniformRange uniform_range = uniform_ring_.Allocate(block_size);
+    // Binding nothing would leave the data of an earlier write bound, such as the camera of another pass
+    assert(uniform_range.size_ > 0 && "The uniform ring region of the frame is full");
+    if (uniform_range.size_ == 0)
+    {
+        LOG_ERROR(kTitle, "The uniform ring region of the frame is full");
+        return uniform_range;
+    }
+    if (data_size > 0)
+    {
+        std::memcpy(uniform_ring_data_ + uniform_range.offset_, data, data_size);
+    }
+    return uniform_range;
+}
+
+UniformRange GLRenderHardware::WriteStorageData(const void* data, uint32 data_size)
+{
+    const UniformRange storage_range = storage_ring_.Allocate(data_size);
+    assert(storage_range.size_ > 0 && "The storage ring region of the frame is full");
+    if (storage_range.size_ == 0)
+    {
+        LOG_ERROR(kTitle, "The storage ring region of the frame is full");
+        return storage_range;
+    }
+    std::memcpy(storage_ring_data_ + storage_range.offset_, data, data_size);
+    return storage_range;
+}
+
+//////////////////////////////////////////////////
+////////// Create Methods
+//////////////////////////////////////////////////
 
-    std::shared_ptr<GLMesh> mesh = std::make_shared<GLMesh>(vao, vertex_buffer, index_buffer, index_count);
-    meshes_.push_back(mesh);
-    return mesh;
+std::shared_ptr<IMesh> GLRenderHardware::CreateMesh(MeshData* mesh_data)
+{
+    const auto vertex_count = static_cast<uint32>(mesh_data->vertices_.size());
+    const auto index_count = static_cast<uint32>(mesh_data->indices_.size());
+    const GeometryArena::Allocation allocation = geometry_arena_->Allocate(vertex_count, index_count);
+    CreateGeometryPages();
+
+    // Indices are relative to the mesh. Draws offset them by the base vertex.
+    const GeometryPage& geometry_page = geometry_pages_[allocation.page_index_];
+    glNamedBufferSubData(geometry_page.vertex_buffer_,
+                         static_cast<GLintptr>(sizeof(Vertex) * allocation.base_vertex_),
+                         static_cast<GLsizeiptr>(sizeof(Vertex) * vertex_count),
+                         mesh_data->vertices_.data());
+    glNamedBufferSubData(geometry_page.index_buffer_,
+                         static_cast<GLintptr>(sizeof(uint32) * allocation.first_index_),
+                         static_cast<GLsizeiptr>(sizeof(uint32) * index_count),
+                         mesh_data->indices_.data());
+
+    return std::make_shared<GLMesh>(geometry_arena_, allocation);
 }
 
 std::shared_ptr<IShader> GLRenderHardware::CreateShader(const ShaderStage& shader_stage)
@@ -334,11 +480,11 @@ std::shared_ptr<IShader> GLRenderHardware::CreateShader(const ShaderStage& shade
         compile_error_message.resize(message_length);
         glGetShaderInfoLog(shader_id, message_length, &message_length, compile_error_message.data());
         LOG_ERROR(kTitle, "Failed to compile OpenGL shader. Error: " + compile_error_message);
+        glDeleteShader(shader_id);
         return nullptr;
     }
 
     std::shared_ptr<GLShader> shader = std::make_shared<GLShader>(shader_id, shader_stage.type_);
-    shaders_.push_back(shader_id);
     return shader;
 }
 
@@ -367,6 +513,7 @@ std::shared_ptr<IProgram> GLRenderHardware::CreateShaderProgram(const std::vecto
         linker_error_message.resize(message_length);
         glGetProgramInfoLog(program_id, message_length, &message_length, linker_error_message.data());
         LOG_ERROR(kTitle, "Failed to link OpenGL program. Error: " + linker_error_message);
+        glDeleteProgram(program_id);
         return nullptr;
     }
 
@@ -377,7 +524,6 @@ std::shared_ptr<IProgram> GLRenderHardware::CreateShaderProgram(const std::vecto
     }
 
     std::shared_ptr<GLProgram> program = std::make_shared<GLProgram>(program_id);
-    programs_.push_back(program_id);
     return program;
 }
 
@@ -425,9 +571,9 @@ std::shared_ptr<ITexture> GLRenderHardware::CreateTexture(std::unique_ptr<Image>
 
     glActiveTexture(texture_unit);
     glBindTexture(target, 0);
+    state_cache_.Invalidate();
 
     std::shared_ptr<GLTexture> texture = std::make_shared<GLTexture>(texture_id, target);
-    textures_.push_back(texture_id);
     return texture;
 }
 
@@ -450,17 +596,36 @@ std::shared_ptr<IUniformBuffer> GLRenderHardware::CreateUniformBuffer(std::strin
     return uniform_buffer;
 }
 
+std::shared_ptr<IStorageBuffer> GLRenderHardware::CreateStorageBuffer(std::string buffer_name, const void* initial_data, uint32 buffer_size)
+{
+    if (buffer_name.empty())
+    {
+        LOG_ERROR(kTitle, "Storage buffer names cannot be empty");
+        return nullptr;
+    }
+
+    GLuint buffer_id;
+    glGenBuffers(1, &buffer_id);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, buffer_id);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, buffer_size, initial_data, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+    std::shared_ptr<GLStorageBuffer> storage_buffer = std::make_shared<GLStorageBuffer>(buffer_id, buffer_size, std::move(buffer_name));
+    storage_buffers_.push_back(buffer_id);
+    return storage_buffer;
+}
+
 //////////////////////////////////////////////////
 ////////// Frame and Bind Methods
 //////////////////////////////////////////////////
 
-void GLRenderHardware::BeginFrame(std::shared_ptr<IFrameBuffer> frame_buffer)
+void GLRenderHardware::BeginFrame(const std::shared_ptr<IFrameBuffer>& frame_buffer)
 {
     // Bind to default frame buffer if null
     GLuint fbo_id = 0;
     if (frame_buffer)
     {
-        std::shared_ptr<GLFrameBuffer> gl_frame_buffer = std::static_pointer_cast<GLFrameBuffer>(frame_buffer);
+        auto* gl_frame_buffer = static_cast<GLFrameBuffer*>(frame_buffer.get());
         fbo_id = gl_frame_buffer->GetIdentifier();
     }
     glBindFramebuffer(GL_FRAMEBUFFER, fbo_id);
@@ -473,88 +638,253 @@ void GLRenderHardware::EndFrame()
 
     // Unbind shader programs
     bound_shader_program_ = nullptr;
-    glUseProgram(0);
+    if (state_cache_.SetProgram(0))
+    {
+        glUseProgram(0);
+    }
 
-    // Reset all texture units
-    for (uint32 texture_unit = 0; texture_unit < available_texture_unit_index_; ++texture_unit)
+    // Reset all texture units used by the frame
+    for (uint32 texture_unit = 0; texture_unit < used_texture_unit_count_; ++texture_unit)
     {
-        glActiveTexture(GL_TEXTURE0 + texture_unit);
-        glBindTexture(GL_TEXTURE_2D, 0);
+        if (state_cache_.SetTexture(texture_unit, 0))
+        {
+            glActiveTexture(GL_TEXTURE0 + texture_unit);
+            glBindTexture(GL_TEXTURE_2D, 0);
+        }
     }
 
-    // Reset available texture units and buffer binding points
-    available_texture_unit_index_ = 0;
-    available_uniform_buffer_binding_point = 0;
+    used_texture_unit_count_ = 0;
+}
+
+uint32 GLRenderHardware::GetFilteredStateChangeCount() const
+{
+    return state_cache_.GetFilteredCount();
+}
+
+void GLRenderHardware::ResetFilteredStateChangeCount()
+{
+    state_cache_.ResetFilteredCount();
 }
 
-void GLRenderHardware::BindShaderProgram(std::shared_ptr<IProgram> shader_program)
+GeometryArena::Statistics GLRenderHardware::GetGeometryStatistics() const
+{
+    return geometry_arena_->GetStatistics();
+}
+
+void GLRenderHardware::BindShaderProgram(const std::shared_ptr<IProgram>& shader_program)
 {
     assert(shader_program != nullptr);
 
-    bound_shader_program_ = std::static_pointer_cast<GLProgram>(shader_program);
-    glUseProgram(bound_shader_program_->GetIdentifier());
+    bound_shader_program_ = static_cast<GLProgram*>(shader_program.get());
+    if (state_cache_.SetProgram(bound_shader_program_->GetIdentifier()))
+    {
+        glUseProgram(bound_shader_program_->GetIdentifier());
+    }
     bound_shader_program_->FlushUniforms();
 }
 
-void GLRenderHardware::BindTexture(std::shared_ptr<ITexture> texture, std::shared_ptr<ISampler> texture_sampler, const std::string& uniform_name)
+void GLRenderHardware::BindTexture(const std::shared_ptr<ITexture>& texture, const std::shared_ptr<ISampler>& texture_sampler, uint32 uniform_name_identifier)
 {
     assert(texture_sampler != nullptr);
+    assert(bound_shader_program_ != nullptr);
 
-    std::shared_ptr<GLSampler> gl_sampler = std::static_pointer_cast<GLSampler>(texture_sampler);
+    // Programs that do not sample the texture have no texture unit for it
+    const uint32 texture_unit = bound_shader_program_->GetTextureUnit(uniform_name_identifier);
+    if (texture_unit == GLProgram::kUnusedBinding)
+    {
+        return;
+    }
+
+    auto* gl_sampler = static_cast<GLSampler*>(texture_sampler.get());
 
     // Bind texture to texture unit
-    glActiveTexture(GL_TEXTURE0 + available_texture_unit_index_);
-    std::shared_ptr<GLTexture> gl_texture = empty_texture_;
+    GLTexture* gl_texture = empty_texture_.get();
     if (texture)
     {
-        gl_texture = std::static_pointer_cast<GLTexture>(texture);
+        gl_texture = static_cast<GLTexture*>(texture.get());
+    }
+    if (state_cache_.SetTexture(texture_unit, gl_texture->GetIdentifier()))
+    {
+        glActiveTexture(GL_TEXTURE0 + texture_unit);
+        glBindTexture(gl_texture->GetTarget(), gl_texture->GetIdentifier());
     }
-    glBindTexture(gl_texture->GetTarget(), gl_texture->GetIdentifier());
 
     // Bind texture sampler to texture unit
-    glBindSampler(available_texture_unit_index_, gl_sampler->GetIdentifier());
-
-    // Map shader uniform name to texture unit
-    glUniform1i(glGetUniformLocation(bound_shader_program_->GetIdentifier(), uniform_name.c_str()), static_cast<int32>(available_texture_unit_index_));
+    if (state_cache_.SetSampler(texture_unit, gl_sampler->GetIdentifier()))
+    {
+        glBindSampler(texture_unit, gl_sampler->GetIdentifier());
+    }
 
-    // Increment to the next available texture unit
-    ++available_texture_unit_index_;
+    used_texture_unit_count_ = std::max(used_texture_unit_count_, texture_unit + 1);
 }
 
-void GLRenderHardware::BindUniformBuffer(std::shared_ptr<IUniformBuffer> uniform_buffer)
+void GLRenderHardware::BindUniformBuffer(const std::shared_ptr<IUniformBuffer>& uniform_buffer)
 {
     assert(uniform_buffer != nullptr);
     assert(bound_shader_program_ != nullptr);
 
-    std::shared_ptr<GLUniformBuffer> gl_uniform_buffer = std::static_pointer_cast<GLUniformBuffer>(uniform_buffer);
+    auto* gl_uniform_buffer = static_cast<GLUniformBuffer*>(uniform_buffer.get());
+
+    // Programs that do not read the block have no binding point for it
+    const uint32 binding_point = bound_shader_program_->GetUniformBlockBinding(gl_uniform_buffer->GetNameIdentifier());
+    if (binding_point == GLProgram::kUnusedBinding)
+    {
+        return;
+    }
+
+    const RenderStateCache::BufferBinding buffer_binding{gl_uniform_buffer->GetIdentifier(), 0, 0};
+    if (state_cache_.SetUniformBuffer(binding_point, buffer_binding))
+    {
+        glBindBufferBase(GL_UNIFORM_BUFFER, binding_point, gl_uniform_buffer->GetIdentifier());
+    }
+}
+
+void GLRenderHardware::BindUniformRange(uint32 block_name_identifier, const UniformRange& uniform_range)
+{
+    assert(bound_shader_program_ != nullptr);
+    assert(uniform_range.size_ > 0 && "The uniform block was not written this frame");
+    if (uniform_range.size_ == 0)
+    {
+        return;
+    }
+
+    // Programs that do not read the block have no binding point for it
+    const uint32 binding_point = bound_shader_program_->GetUniformBlockBinding(block_name_identifier);
+    if (binding_point == GLProgram::kUnusedBinding)
+    {
+        return;
+    }
+
+    const RenderStateCache::BufferBinding buffer_binding{uniform_ring_buffer_, uniform_range.offset_, uniform_range.size_};
+    if (state_cache_.SetUniformBuffer(binding_point, buffer_binding))
+    {
+        glBindBufferRange(GL_UNIFORM_BUFFER, binding_point, uniform_ring_buffer_, uniform_range.offset_, uniform_range.size_);
+    }
+}
+
+void GLRenderHardware::BindStorageRange(uint32 block_name_identifier, const UniformRange& storage_range)
+{
+    assert(bound_shader_program_ != nullptr);
+    assert(storage_range.size_ > 0 && "The storage block was not written this frame");
+    if (storage_range.size_ == 0)
+    {
+        return;
+    }
+
+    // Programs that do not read the block have no binding point for it
+    const uint32 binding_point = bound_shader_program_->GetStorageBlockBinding(block_name_identifier);
+    if (binding_point == GLProgram::kUnusedBinding)
+    {
+        return;
+    }
 
-    glBindBuffer(GL_UNIFORM_BUFFER, gl_uniform_buffer->GetIdentifier());
+    const RenderStateCache::BufferBinding buffer_binding{storage_ring_buffer_, storage_range.offset_, storage_range.size_};
+    if (state_cache_.SetStorageBuffer(binding_point, buffer_binding))
+    {
+        glBindBufferRange(GL_SHADER_STORAGE_BUFFER, binding_point, storage_ring_buffer_, storage_range.offset_, storage_range.size_);
+    }
+}
 
-    // Retrieve uniform buffer index from name
-    const std::string& uniform_name = gl_uniform_buffer->GetName();
-    GLuint uniform_block_index = glGetUniformBlockIndex(bound_shader_program_->GetIdentifier(), uniform_name.c_str());
+void GLRenderHardware::BindStorageBuffer(const std::shared_ptr<IStorageBuffer>& storage_buffer)
+{
+    assert(storage_buffer != nullptr);
+    assert(bound_shader_program_ != nullptr);
 
-    // Bind buffer to binding point
-    glBindBufferBase(GL_UNIFORM_BUFFER, available_uniform_buffer_binding_point, gl_uniform_buffer->GetIdentifier());
+    auto* gl_storage_buffer = static_cast<GLStorageBuffer*>(storage_buffer.get());
 
-    // Bind program uniform buffer index to binding point
-    glUniformBlockBinding(bound_shader_program_->GetIdentifier(), uniform_block_index, available_uniform_buffer_binding_point);
+    // Programs that do not read the buffer have no binding point for it
+    const uint32 binding_point = bound_shader_program_->GetStorageBlockBinding(gl_storage_buffer->GetNameIdentifier());
+    if (binding_point == GLProgram::kUnusedBinding)
+    {
+        return;
+    }
 
-    // Increment to the next available binding point
-    ++available_uniform_buffer_binding_point;
+    const RenderStateCache::BufferBinding buffer_binding{gl_storage_buffer->GetIdentifier(), 0, 0};
+    if (state_cache_.SetStorageBuffer(binding_point, buffer_binding))
+    {
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding_point, gl_storage_buffer->GetIdentifier());
+    }
 }
 
 //////////////////////////////////////////////////
 ////////// Draw Method
 //////////////////////////////////////////////////
 
-void GLRenderHardware::DrawMesh(std::shared_ptr<IMesh> mesh)
+void GLRenderHardware::DrawMesh(const std::shared_ptr<IMesh>& mesh)
+{
+    assert(bound_shader_program_ != nullptr);
+
+    auto* gl_mesh = static_cast<GLMesh*>(mesh.get());
+    BindGeometry(*gl_mesh);
+    glDrawElementsBaseVertex(GL_TRIANGLES,
+                             static_cast<GLsizei>(gl_mesh->GetIndexCount()),
+                             GL_UNSIGNED_INT,
+                             reinterpret_cast<const void*>(sizeof(uint32) * gl_mesh->GetFirstIndex()),
+                             static_cast<GLint>(gl_mesh->GetBaseVertex()));
+}
+
+void GLRenderHardware::DrawMeshInstanced(const std::shared_ptr<IMesh>& mesh, uint32 instance_count, uint32 first_instance)
 {
     assert(bound_shader_program_ != nullptr);
 
-    std::shared_ptr<GLMesh> gl_mesh = std::static_pointer_cast<GLMesh>(mesh);
-    glBindVertexArray(gl_mesh->GetVAOIdentifier());
-    glDrawElements(GL_TRIANGLES, static_cast<GLint>(gl_mesh->GetIndexDataSize()), GL_UNSIGNED_INT, nullptr);
+    auto* gl_mesh = static_cast<GLMesh*>(mesh.get());
+    BindGeometry(*gl_mesh);
+    glDrawElementsInstancedBaseVertexBaseInstance(GL_TRIANGLES,
+                                                  static_cast<GLsizei>(gl_mesh->GetIndexCount()),
+                                                  GL_UNSIGNED_INT,
+                                                  reinterpret_cast<const void*>(sizeof(uint32) * gl_mesh->GetFirstIndex()),
+                                                  static_cast<GLsizei>(instance_count),
+                                                  static_cast<GLint>(gl_mesh->GetBaseVertex()),
+                                                  first_instance);
+}
+
+void GLRenderHardware::MultiDrawMeshIndirect(const std::shared_ptr<IMesh>& mesh, uint32 first_command, uint32 command_count)
+{
+    assert(bound_shader_program_ != nullptr);
+    assert(first_command + command_count <= draw_command_capacity_);
+
+    auto* gl_mesh = static_cast<GLMesh*>(mesh.get());
+    BindGeometry(*gl_mesh);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, draw_command_buffer_);
+    glMultiDrawElementsIndirect(GL_TRIANGLES,
+                                GL_UNSIGNED_INT,
+                                reinterpret_cast<const void*>(sizeof(DrawIndirectCommand) * first_command),
+                                static_cast<GLsizei>(command_count),
+                                0);
+}
+
+//////////////////////////////////////////////////
+////////// Geometry Methods
+//////////////////////////////////////////////////
+
+void GLRenderHardware::CreateGeometryPages()
+{
+    for (auto page_index = static_cast<uint32>(geometry_pages_.size()); page_index < geometry_arena_->GetPageCount(); ++page_index)
+    {
+        GeometryPage geometry_page{0, 0};
+        glCreateBuffers(1, &geometry_page.vertex_buffer_);
+        glCreateBuffers(1, &geometry_page.index_buffer_);
+        glNamedBufferStorage(geometry_page.vertex_buffer_,
+                             static_cast<GLsizeiptr>(sizeof(Vertex) * geometry_arena_->GetPageVertexCapacity(page_index)),
+                             nullptr,
+                             GL_DYNAMIC_STORAGE_BIT);
+        glNamedBufferStorage(geometry_page.index_buffer_,
+                             static_cast<GLsizeiptr>(sizeof(uint32) * geometry_arena_->GetPageIndexCapacity(page_index)),
+                             nullptr,
+                             GL_DYNAMIC_STORAGE_BIT);
+        geometry_pages_.push_back(geometry_page);
+    }
+}
+
+void GLRenderHardware::BindGeometry(const GLMesh& gl_mesh)
+{
+    const GeometryPage& geometry_page = geometry_pages_[gl_mesh.GetPageIndex()];
+    if (state_cache_.SetVertexBuffer(geometry_page.vertex_buffer_))
+    {
+        glVertexArrayVertexBuffer(geometry_vertex_array_, 0, geometry_page.vertex_buffer_, 0, sizeof(Vertex));
+        glVertexArrayElementBuffer(geometry_vertex_array_, geometry_page.index_buffer_);
+        glBindVertexArray(geometry_vertex_array_);
+    }
 }
 
 } // namespace zero::render
\ No newline at end of file
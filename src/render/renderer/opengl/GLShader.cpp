@@ -9,6 +9,11 @@ GLShader::GLShader(GLuint shader_id, IShader::Type type)
 {
 }
 
+GLShader::~GLShader()
+{
+    glDeleteShader(id_);
+}
+
 IShader::Type GLShader::GetType() const
 {
     return type_;
@@ -0,0 +1,35 @@
+#include "render/renderer/opengl/GLStorageBuffer.hpp"
+#include "render/renderer/ShaderNameTable.hpp"
+
+namespace zero::render
+{
+
+GLStorageBuffer::GLStorageBuffer(GLuint ssbo_id, uint32 buffer_size, std::string name)
+: ssbo_id_(ssbo_id)
+, buffer_size_(buffer_size)
+, name_(std::move(name))
+, name_identifier_(ShaderNameTable::GetTable().Intern(name_))
+{
+}
+
+uint32 GLStorageBuffer::GetSize()
+{
+    return buffer_size_;
+}
+
+const std::string& GLStorageBuffer::GetName()
+{
+    return name_;
+}
+
+GLuint GLStorageBuffer::GetIdentifier() const
+{
+    return ssbo_id_;
+}
+
+uint32 GLStorageBuffer::GetNameIdentifier() const
+{
+    return name_identifier_;
+}
+
+} // namespace zero::render
\ No newline at end of file
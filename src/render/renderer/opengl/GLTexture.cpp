@@ -9,6 +9,11 @@ GLTexture::GLTexture(GLuint id, GLenum target)
 {
 }
 
+GLTexture::~GLTexture()
+{
+    glDeleteTextures(1, &id_);
+}
+
 GLenum GLTexture::GetTarget() const
 {
     return target_;
@@ -1,4 +1,5 @@
 #include "render/renderer/opengl/GLUniformBuffer.hpp"
+#include "render/renderer/ShaderNameTable.hpp"
 
 namespace zero::render
 {
@@ -7,6 +8,7 @@ GLUniformBuffer::GLUniformBuffer(GLuint ubo_id, uint32 buffer_size, std::string
 : ubo_id_(ubo_id)
 , buffer_size_(buffer_size)
 , name_(std::move(name))
+, name_identifier_(ShaderNameTable::GetTable().Intern(name_))
 {
 }
 
@@ -25,4 +27,9 @@ GLuint GLUniformBuffer::GetIdentifier() const
     return ubo_id_;
 }
 
+uint32 GLUniformBuffer::GetNameIdentifier() const
+{
+    return name_identifier_;
+}
+
 } // namespace zero::render
\ No newline at end of file
@@ -1,6 +1,5 @@
 #include "render/renderer/renderpass/CascadedShadowMapRenderPass.hpp"
 #include "render/renderer/UniformBufferData.hpp"
-#include "render/renderer/DrawCallComparator.hpp"
 #include "core/Logger.hpp"
 
 namespace zero::render
@@ -10,62 +9,85 @@ const char* CascadedShadowMapRenderPass::kTitle = "CascadedShadowMapRenderPass";
 
 CascadedShadowMapRenderPass::CascadedShadowMapRenderPass(uint32 cascade_index)
 : cascade_index_(cascade_index)
-, camera_uniform_(nullptr)
-, draw_calls_()
+, uniform_manager_(nullptr)
+, render_resources_(nullptr)
+, shadow_map_frame_buffer_(nullptr)
+, draw_call_queue_()
+, indirect_draw_list_()
 {
 }
 
-void CascadedShadowMapRenderPass::Initialize(IRenderHardware* rhi, std::shared_ptr<IUniformBuffer> camera_uniform)
+void CascadedShadowMapRenderPass::Initialize(IRenderHardware* rhi,
+                                             std::shared_ptr<UniformManager> uniform_manager,
+                                             std::shared_ptr<const RenderResources> render_resources)
 {
-    camera_uniform_ = std::move(camera_uniform);
+    uniform_manager_ = std::move(uniform_manager);
+    render_resources_ = std::move(render_resources);
+    const std::vector<std::shared_ptr<IFrameBuffer>>& shadow_map_frame_buffers = rhi->GetShadowMapFrameBuffers();
+    assert(cascade_index_ < shadow_map_frame_buffers.size());
+    shadow_map_frame_buffer_ = shadow_map_frame_buffers[cascade_index_];
 }
 
-void CascadedShadowMapRenderPass::Submit(std::unique_ptr<IDrawCall> draw_call)
+void CascadedShadowMapRenderPass::Submit(const DrawPacket& draw_packet, uint64 sort_key)
 {
-    draw_calls_.push_back(std::move(draw_call));
+    draw_call_queue_.Submit(draw_packet, sort_key);
 }
 
-void CascadedShadowMapRenderPass::Sort()
+void CascadedShadowMapRenderPass::Submit(DrawCallPtr draw_call)
 {
-    std::sort(draw_calls_.begin(), draw_calls_.end(), DrawCallComparator::CompareDrawCalls);
+    draw_call_queue_.Submit(std::move(draw_call));
 }
 
-void CascadedShadowMapRenderPass::Render(IRenderView* render_view, IRenderHardware* rhi)
+void CascadedShadowMapRenderPass::Sort(ThreadPool& thread_pool)
 {
-    if (draw_calls_.empty())
+    draw_call_queue_.Sort(thread_pool);
+}
+
+void CascadedShadowMapRenderPass::Record(IRenderView* render_view, CommandBuffer& command_buffer)
+{
+    if (draw_call_queue_.IsEmpty())
     {
-        LOG_DEBUG(kTitle, "No draw calls to render for cascade index: " + std::to_string(cascade_index_));
+        LOG_VERBOSE(kTitle, "No draw calls to render for cascade");
         return;
     }
 
-    LOG_DEBUG(kTitle, "Rendering cascade index: " + std::to_string(cascade_index_));
+    LOG_VERBOSE(kTitle, "Rendering cascade");
 
-    const std::vector<std::shared_ptr<IFrameBuffer>> shadow_map_frame_buffers = rhi->GetShadowMapFrameBuffers();
-    const CascadedShadowMap cascaded_shadow_map = render_view->GetCascadedShadowMap();
-    assert(shadow_map_frame_buffers.size() == cascaded_shadow_map.GetCascadeCount());
+    const CascadedShadowMap& cascaded_shadow_map = render_view->GetCascadedShadowMap();
+    assert(cascade_index_ < cascaded_shadow_map.GetCascadeCount());
 
-    const std::vector<math::Matrix4x4> light_view_matrices = cascaded_shadow_map.GetLightViewMatrices();
-    const std::vector<math::Matrix4x4> light_projection_matrices = cascaded_shadow_map.GetProjectionMatrices();
+    const std::vector<math::Matrix4x4>& light_view_matrices = cascaded_shadow_map.GetLightViewMatrices();
+    const std::vector<math::Matrix4x4>& light_projection_matrices = cascaded_shadow_map.GetProjectionMatrices();
 
-    rhi->BeginFrame(shadow_map_frame_buffers[cascade_index_]);
-    rhi->SetViewport(0, 0, Constants::kShadowMapWidth, Constants::kShadowMapHeight);
-    rhi->Clear();
-    rhi->SetCullMode(IRenderHardware::CullMode::CULL_MODE_BACK);
-    rhi->SetFillMode(IRenderHardware::FillMode::FILL_MODE_SOLID);
+    command_buffer.BeginFrame(shadow_map_frame_buffer_);
+    command_buffer.SetViewport(0, 0, Constants::kShadowMapWidth, Constants::kShadowMapHeight);
+    command_buffer.Clear();
+    command_buffer.SetCullMode(IRenderHardware::CullMode::CULL_MODE_BACK);
+    command_buffer.SetFillMode(IRenderHardware::FillMode::FILL_MODE_SOLID);
 
     const CameraData camera_data{light_projection_matrices[cascade_index_], light_view_matrices[cascade_index_], math::Vec3f::Zero()};
-    rhi->UpdateUniformData(camera_uniform_, &camera_data, sizeof(camera_data), 0);
-    for (const std::unique_ptr<IDrawCall>& draw_call : draw_calls_)
+    command_buffer.WriteUniform(UniformBlock::CAMERA, &camera_data, sizeof(camera_data));
+    indirect_draw_list_.Build(draw_call_queue_, *render_resources_);
+    indirect_draw_list_.Record(command_buffer, [this, &command_buffer](const DrawPacket& draw_packet, uint32 first_command, uint32 command_count)
     {
-        draw_call->Draw(rhi);
-    }
+        DrawShadowCasters(command_buffer, draw_packet, first_command, command_count);
+    });
 
-    rhi->EndFrame();
+    command_buffer.EndFrame();
 }
 
 void CascadedShadowMapRenderPass::ClearDrawCalls()
 {
-    draw_calls_.clear();
+    draw_call_queue_.Clear();
+}
+
+void CascadedShadowMapRenderPass::DrawShadowCasters(CommandBuffer& command_buffer, const DrawPacket& draw_packet, uint32 first_command, uint32 command_count) const
+{
+    command_buffer.BindShaderProgram(render_resources_->GetProgram(draw_packet.program_handle_));
+    command_buffer.BindUniform(UniformBlock::CAMERA);
+    command_buffer.BindUniform(UniformBlock::SHADOW_MAP_INFORMATION);
+    command_buffer.BindInstances();
+    command_buffer.MultiDrawMeshIndirect(render_resources_->GetMesh(draw_packet.mesh_handle_), first_command, command_count);
 }
 
 } // namespace zero::render
\ No newline at end of file
@@ -1,6 +1,5 @@
 #include "render/renderer/renderpass/EntityRenderPass.hpp"
 #include "render/renderer/UniformBufferData.hpp"
-#include "render/renderer/DrawCallComparator.hpp"
 #include "core/Logger.hpp"
 
 namespace zero::render
@@ -9,54 +8,95 @@ namespace zero::render
 const char* EntityRenderPass::kTitle = "EntityRenderPass";
 
 EntityRenderPass::EntityRenderPass()
-: camera_uniform_(nullptr)
-, draw_calls_()
+: uniform_manager_(nullptr)
+, render_resources_(nullptr)
+, diffuse_map_sampler_(nullptr)
+, shadow_map_sampler_(nullptr)
+, draw_call_queue_()
+, indirect_draw_list_()
 {
 }
 
-void EntityRenderPass::Initialize(IRenderHardware* rhi, std::shared_ptr<IUniformBuffer> camera_uniform)
+void EntityRenderPass::Initialize(IRenderHardware* rhi,
+                                  std::shared_ptr<UniformManager> uniform_manager,
+                                  std::shared_ptr<const RenderResources> render_resources)
 {
-    camera_uniform_ = std::move(camera_uniform);
+    uniform_manager_ = std::move(uniform_manager);
+    render_resources_ = std::move(render_resources);
+    diffuse_map_sampler_ = rhi->GetDiffuseMapSampler();
+    shadow_map_sampler_ = rhi->GetShadowMapSampler();
 }
 
-void EntityRenderPass::Submit(std::unique_ptr<IDrawCall> draw_call)
+void EntityRenderPass::Submit(const DrawPacket& draw_packet, uint64 sort_key)
 {
-    draw_calls_.push_back(std::move(draw_call));
+    draw_call_queue_.Submit(draw_packet, sort_key);
 }
 
-void EntityRenderPass::Sort()
+void EntityRenderPass::Submit(DrawCallPtr draw_call)
 {
-    std::sort(draw_calls_.begin(), draw_calls_.end(), DrawCallComparator::CompareDrawCalls);
+    draw_call_queue_.Submit(std::move(draw_call));
 }
 
-void EntityRenderPass::Render(IRenderView* render_view, IRenderHardware* rhi)
+void EntityRenderPass::Sort(ThreadPool& thread_pool)
 {
-    if (draw_calls_.empty())
+    draw_call_queue_.Sort(thread_pool);
+}
+
+void EntityRenderPass::Record(IRenderView* render_view, CommandBuffer& command_buffer)
+{
+    if (draw_call_queue_.IsEmpty())
     {
-        LOG_DEBUG(kTitle, "No draw calls to render");
+        LOG_VERBOSE(kTitle, "No draw calls to render");
         return;
     }
 
-    LOG_DEBUG(kTitle, "Rendering entities");
-    rhi->BeginFrame(nullptr);
+    LOG_VERBOSE(kTitle, "Rendering entities");
+    command_buffer.BeginFrame(nullptr);
 
     const Camera& camera = render_view->GetCamera();
-    rhi->SetViewport(camera.viewport_.x_, camera.viewport_.y_, camera.viewport_.width_, camera.viewport_.height_);
-    rhi->Clear();
+    command_buffer.SetViewport(camera.viewport_.x_, camera.viewport_.y_, camera.viewport_.width_, camera.viewport_.height_);
+    command_buffer.Clear();
 
     const CameraData camera_data{camera.GetProjectionMatrix(), camera.GetViewMatrix(), camera.position_};
-    rhi->UpdateUniformData(camera_uniform_, &camera_data, sizeof(camera_data), 0);
-    for (const std::unique_ptr<IDrawCall>& draw_call : draw_calls_)
+    command_buffer.WriteUniform(UniformBlock::CAMERA, &camera_data, sizeof(camera_data));
+    indirect_draw_list_.Build(draw_call_queue_, *render_resources_);
+    indirect_draw_list_.Record(command_buffer, [this, &command_buffer](const DrawPacket& draw_packet, uint32 first_command, uint32 command_count)
     {
-        draw_call->Draw(rhi);
-    }
+        DrawEntities(command_buffer, draw_packet, first_command, command_count);
+    });
 
-    rhi->EndFrame();
+    command_buffer.EndFrame();
 }
 
 void EntityRenderPass::ClearDrawCalls()
 {
-    draw_calls_.clear();
+    draw_call_queue_.Clear();
+}
+
+void EntityRenderPass::DrawEntities(CommandBuffer& command_buffer, const DrawPacket& draw_packet, uint32 first_command, uint32 command_count) const
+{
+    command_buffer.BindShaderProgram(render_resources_->GetProgram(draw_packet.program_handle_));
+    command_buffer.SetCullMode(draw_packet.two_sided_ ? IRenderHardware::CullMode::CULL_MODE_NONE : IRenderHardware::CullMode::CULL_MODE_BACK);
+    command_buffer.SetFillMode(draw_packet.wireframe_enabled_ ? IRenderHardware::FillMode::FILL_MODE_WIREFRAME : IRenderHardware::FillMode::FILL_MODE_SOLID);
+
+    // Bind uniforms
+    command_buffer.BindUniform(UniformBlock::CAMERA);
+    command_buffer.BindUniform(UniformBlock::LIGHT_INFORMATION);
+    command_buffer.BindUniform(UniformBlock::DIRECTIONAL_LIGHTS);
+    command_buffer.BindUniform(UniformBlock::SHADOW_MAP_INFORMATION);
+    command_buffer.BindStorageBuffer(uniform_manager_->GetPointLightStorage());
+    command_buffer.BindStorageBuffer(uniform_manager_->GetSpotLightStorage());
+    command_buffer.BindStorageBuffer(uniform_manager_->GetLightClusterStorage());
+    command_buffer.BindStorageBuffer(uniform_manager_->GetLightIndexStorage());
+    command_buffer.BindInstances();
+
+    // Bind textures. The render hardware falls back to an empty texture if there is none.
+    command_buffer.BindTexture(render_resources_->GetTexture(draw_packet.texture_handle_), diffuse_map_sampler_, uniform_manager_->GetDiffuseMapUniformSamplerIdentifier());
+    for (const auto& [uniform_identifier, shadow_map_texture]: uniform_manager_->GetShadowTextureUniformMap())
+    {
+        command_buffer.BindTexture(shadow_map_texture, shadow_map_sampler_, uniform_identifier);
+    }
+    command_buffer.MultiDrawMeshIndirect(render_resources_->GetMesh(draw_packet.mesh_handle_), first_command, command_count);
 }
 
 } // namespace zero::render
\ No newline at end of file
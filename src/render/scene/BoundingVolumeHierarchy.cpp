@@ -0,0 +1,439 @@
+#include <algorithm>
+#include <array>
+#include "render/scene/BoundingVolumeHierarchy.hpp"
+#include "render/scene/CullingManager.hpp"
+#include "component/Transform.hpp"
+#include "component/Volume.hpp"
+
+namespace zero::render
+{
+
+namespace
+{
+
+float GetAxis(const math::Vec3f& vector, uint32 axis)
+{
+	return axis == 0 ? vector.x_ : (axis == 1 ? vector.y_ : vector.z_);
+}
+
+float SurfaceArea(const math::Box& box)
+{
+	const math::Vec3f size = box.Size();
+	return 2.0F * (size.x_ * size.y_ + size.y_ * size.z_ + size.z_ * size.x_);
+}
+
+math::Box CreateBox(const math::Sphere& sphere)
+{
+	const math::Vec3f extent(sphere.radius_, sphere.radius_, sphere.radius_);
+	return math::Box(sphere.center_ - extent, sphere.center_ + extent);
+}
+
+bool IsSameBox(const math::Box& lhs, const math::Box& rhs)
+{
+	// Box::operator== is epsilon based. Refitting must never leave a box smaller than its contents.
+	return lhs.Contains(rhs) && rhs.Contains(lhs);
+}
+
+} // namespace
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy()
+: registry_(nullptr)
+, nodes_()
+, primitives_()
+, primitive_leaves_()
+, chunk_nodes_()
+, needs_rebuild_(true)
+, refit_count_(0)
+, generation_(0)
+{
+}
+
+BoundingVolumeHierarchy::~BoundingVolumeHierarchy()
+{
+	Detach();
+}
+
+void BoundingVolumeHierarchy::Update(entt::registry& registry)
+{
+	if (registry_ != &registry)
+	{
+		Detach();
+		Attach(registry);
+	}
+
+	if (needs_rebuild_)
+	{
+		Rebuild(registry);
+		return;
+	}
+
+	// Refit the leaves of the volumes that moved since the last update
+	for (uint32 primitive_index = 0; primitive_index < primitives_.size(); ++primitive_index)
+	{
+		Primitive& primitive = primitives_[primitive_index];
+		const Volume& volume = registry.get<const Volume>(primitive.entity_);
+		if (volume.version_ == primitive.version_)
+		{
+			continue;
+		}
+		primitive.version_ = volume.version_;
+		primitive.sphere_ = volume.bounding_volume_;
+		primitive.box_ = CreateBox(primitive.sphere_);
+		primitive.centroid_ = primitive.sphere_.center_;
+		Refit(primitive_leaves_[primitive_index]);
+		++refit_count_;
+	}
+
+	// Refitting never changes the topology, so the hierarchy degrades as entities move away from their neighbours
+	if (refit_count_ > primitives_.size())
+	{
+		Rebuild(registry);
+	}
+}
+
+void BoundingVolumeHierarchy::Query(const IViewVolume& view_volume,
+                                    const entt::registry& registry,
+                                    std::vector<Entity>& entities) const
+{
+	if (nodes_.empty())
+	{
+		return;
+	}
+	QueryNode(0, view_volume, registry, nullptr, entities);
+}
+
+uint32 BoundingVolumeHierarchy::GetChunkCount() const
+{
+	return static_cast<uint32>(chunk_nodes_.size());
+}
+
+void BoundingVolumeHierarchy::QueryChunk(uint32 chunk_index,
+                                         const IViewVolume& view_volume,
+                                         const entt::registry& registry,
+                                         CullingHistory* culling_history,
+                                         std::vector<Entity>& entities) const
+{
+	QueryNode(chunk_nodes_[chunk_index], view_volume, registry, culling_history, entities);
+}
+
+void BoundingVolumeHierarchy::QueryNode(uint32 root_node_index,
+                                        const IViewVolume& view_volume,
+                                        const entt::registry& registry,
+                                        CullingHistory* culling_history,
+                                        std::vector<Entity>& entities) const
+{
+	// A node is only pushed with its sibling and the depth is bounded, so the stack cannot overflow
+	std::array<uint32, kMaxDepth + 2> node_stack{};
+	uint32 stack_size = 0;
+	node_stack[stack_size++] = root_node_index;
+
+	while (stack_size > 0)
+	{
+		const Node& node = nodes_[node_stack[--stack_size]];
+		const IViewVolume::Containment containment = view_volume.Classify(node.box_);
+		if (containment == IViewVolume::Containment::OUTSIDE)
+		{
+			continue;
+		}
+
+		if (containment == IViewVolume::Containment::INSIDE)
+		{
+			const uint32 last_primitive = node.first_primitive_ + node.primitive_count_;
+			for (uint32 primitive_index = node.first_primitive_; primitive_index < last_primitive; ++primitive_index)
+			{
+				CullingManager::AcceptHierarchy(registry, primitives_[primitive_index].entity_, entities);
+			}
+			continue;
+		}
+
+		if (node.left_child_ == 0)
+		{
+			const uint32 last_primitive = node.first_primitive_ + node.primitive_count_;
+			for (uint32 primitive_index = node.first_primitive_; primitive_index < last_primitive; ++primitive_index)
+			{
+				const Primitive& primitive = primitives_[primitive_index];
+				if (culling_history == nullptr)
+				{
+					CullingManager::CullHierarchy(view_volume, registry, primitive.entity_, entities);
+				}
+				else if (!culling_history->IsCulled(view_volume, primitive.sphere_, primitive.version_, culling_history->GetHierarchyState(primitive_index)))
+				{
+					CullingManager::CullVisibleHierarchy(view_volume, registry, primitive.entity_, entities);
+				}
+			}
+			continue;
+		}
+
+		node_stack[stack_size++] = node.left_child_ + 1;
+		node_stack[stack_size++] = node.left_child_;
+	}
+}
+
+uint32 BoundingVolumeHierarchy::GetEntityCount() const
+{
+	return static_cast<uint32>(primitives_.size());
+}
+
+uint32 BoundingVolumeHierarchy::GetNodeCount() const
+{
+	return static_cast<uint32>(nodes_.size());
+}
+
+uint32 BoundingVolumeHierarchy::GetGeneration() const
+{
+	return generation_;
+}
+
+void BoundingVolumeHierarchy::Attach(entt::registry& registry)
+{
+	registry_ = &registry;
+	registry.on_construct<Transform>().connect<&BoundingVolumeHierarchy::OnMembershipChanged>(*this);
+	registry.on_construct<Volume>().connect<&BoundingVolumeHierarchy::OnMembershipChanged>(*this);
+	registry.on_construct<DynamicVolume>().connect<&BoundingVolumeHierarchy::OnMembershipChanged>(*this);
+	registry.on_destroy<Transform>().connect<&BoundingVolumeHierarchy::OnMembershipChanged>(*this);
+	registry.on_destroy<Volume>().connect<&BoundingVolumeHierarchy::OnMembershipChanged>(*this);
+	registry.on_destroy<DynamicVolume>().connect<&BoundingVolumeHierarchy::OnMembershipChanged>(*this);
+	// Notified when the Transform hierarchy changes
+	registry.on_update<Transform>().connect<&BoundingVolumeHierarchy::OnMembershipChanged>(*this);
+	needs_rebuild_ = true;
+}
+
+void BoundingVolumeHierarchy::Detach()
+{
+	if (registry_ == nullptr)
+	{
+		return;
+	}
+	registry_->on_construct<Transform>().disconnect<&BoundingVolumeHierarchy::OnMembershipChanged>(*this);
+	registry_->on_construct<Volume>().disconnect<&BoundingVolumeHierarchy::OnMembershipChanged>(*this);
+	registry_->on_construct<DynamicVolume>().disconnect<&BoundingVolumeHierarchy::OnMembershipChanged>(*this);
+	registry_->on_destroy<Transform>().disconnect<&BoundingVolumeHierarchy::OnMembershipChanged>(*this);
+	registry_->on_destroy<Volume>().disconnect<&BoundingVolumeHierarchy::OnMembershipChanged>(*this);
+	registry_->on_destroy<DynamicVolume>().disconnect<&BoundingVolumeHierarchy::OnMembershipChanged>(*this);
+	registry_->on_update<Transform>().disconnect<&BoundingVolumeHierarchy::OnMembershipChanged>(*this);
+	registry_ = nullptr;
+}
+
+void BoundingVolumeHierarchy::OnMembershipChanged(entt::registry& /* registry */, Entity /* entity */)
+{
+	needs_rebuild_ = true;
+}
+
+void BoundingVolumeHierarchy::Rebuild(const entt::registry& registry)
+{
+	needs_rebuild_ = false;
+	refit_count_ = 0;
+	++generation_;
+	nodes_.clear();
+	primitives_.clear();
+	chunk_nodes_.clear();
+
+	// Dynamic volumes are tracked by the spatial hash grid
+	auto volume_view = registry.view<const Transform, const Volume>(entt::exclude<DynamicVolume>);
+	for (Entity entity : volume_view)
+	{
+		if (!CullingManager::IsHierarchyRoot(registry, entity))
+		{
+			continue;
+		}
+		const Volume& volume = volume_view.get<const Volume>(entity);
+		primitives_.push_back(Primitive{entity,
+		                                volume.version_,
+		                                volume.bounding_volume_,
+		                                CreateBox(volume.bounding_volume_),
+		                                volume.bounding_volume_.center_});
+	}
+
+	primitive_leaves_.resize(primitives_.size());
+	if (primitives_.empty())
+	{
+		return;
+	}
+
+	// A binary tree with N leaves has at most 2N - 1 nodes
+	nodes_.reserve(primitives_.size() * 2);
+	nodes_.push_back(Node{math::Box(), 0, kInvalidIndex, 0, static_cast<uint32>(primitives_.size())});
+	BuildNode(0, 0);
+	SplitChunks();
+}
+
+void BoundingVolumeHierarchy::SplitChunks()
+{
+	// Repeatedly replace the largest inner chunk with its children. Replacing a node with its children in place
+	// keeps the chunks in the depth first order of Query.
+	chunk_nodes_.reserve(kMaxChunkCount);
+	chunk_nodes_.push_back(0);
+	while (chunk_nodes_.size() < kMaxChunkCount)
+	{
+		auto largest_chunk = chunk_nodes_.end();
+		for (auto it = chunk_nodes_.begin(); it != chunk_nodes_.end(); ++it)
+		{
+			const Node& node = nodes_[*it];
+			if (node.left_child_ != 0 && (largest_chunk == chunk_nodes_.end() || node.primitive_count_ > nodes_[*largest_chunk].primitive_count_))
+			{
+				largest_chunk = it;
+			}
+		}
+		if (largest_chunk == chunk_nodes_.end())
+		{
+			break;
+		}
+		const uint32 left_child = nodes_[*largest_chunk].left_child_;
+		*largest_chunk = left_child + 1;
+		chunk_nodes_.insert(largest_chunk, left_child);
+	}
+}
+
+void BoundingVolumeHierarchy::BuildNode(uint32 node_index, uint32 depth)
+{
+	const uint32 first_primitive = nodes_[node_index].first_primitive_;
+	const uint32 primitive_count = nodes_[node_index].primitive_count_;
+	const uint32 last_primitive = first_primitive + primitive_count;
+
+	math::Box box = primitives_[first_primitive].box_;
+	math::Box centroid_box(primitives_[first_primitive].centroid_, primitives_[first_primitive].centroid_);
+	for (uint32 primitive_index = first_primitive + 1; primitive_index < last_primitive; ++primitive_index)
+	{
+		const Primitive& primitive = primitives_[primitive_index];
+		box.Merge(primitive.box_);
+		centroid_box.Merge(math::Box(primitive.centroid_, primitive.centroid_));
+	}
+	nodes_[node_index].box_ = box;
+
+	if (primitive_count <= kMaxLeafSize || depth >= kMaxDepth)
+	{
+		std::fill(primitive_leaves_.begin() + first_primitive, primitive_leaves_.begin() + last_primitive, node_index);
+		return;
+	}
+
+	// Split along the longest axis of the centroids
+	const math::Vec3f centroid_extent = centroid_box.Size();
+	uint32 axis = 0;
+	if (centroid_extent.y_ > GetAxis(centroid_extent, axis))
+	{
+		axis = 1;
+	}
+	if (centroid_extent.z_ > GetAxis(centroid_extent, axis))
+	{
+		axis = 2;
+	}
+	const float axis_min = GetAxis(centroid_box.min_, axis);
+	const float axis_extent = GetAxis(centroid_extent, axis);
+
+	auto primitives_begin = primitives_.begin() + first_primitive;
+	auto primitives_end = primitives_.begin() + last_primitive;
+	auto primitives_middle = primitives_begin;
+
+	if (axis_extent > math::kEpsilon)
+	{
+		// Binned surface area heuristic
+		const float bin_scale = static_cast<float>(kBinCount) / axis_extent;
+		const auto get_bin = [&](const Primitive& primitive) {
+			const auto bin = static_cast<uint32>((GetAxis(primitive.centroid_, axis) - axis_min) * bin_scale);
+			return std::min(bin, kBinCount - 1);
+		};
+
+		std::array<math::Box, kBinCount> bin_boxes{};
+		std::array<uint32, kBinCount> bin_counts{};
+		for (auto it = primitives_begin; it != primitives_end; ++it)
+		{
+			const uint32 bin = get_bin(*it);
+			bin_boxes[bin] = bin_counts[bin] == 0 ? it->box_ : math::Box::Merge(bin_boxes[bin], it->box_);
+			++bin_counts[bin];
+		}
+
+		// Sweep from the right to compute the cost of every right partition
+		std::array<float, kBinCount> right_costs{};
+		math::Box right_box;
+		uint32 right_count = 0;
+		for (uint32 bin = kBinCount - 1; bin > 0; --bin)
+		{
+			if (bin_counts[bin] > 0)
+			{
+				right_box = right_count == 0 ? bin_boxes[bin] : math::Box::Merge(right_box, bin_boxes[bin]);
+				right_count += bin_counts[bin];
+			}
+			right_costs[bin] = right_count == 0 ? 0.0F : SurfaceArea(right_box) * static_cast<float>(right_count);
+		}
+
+		// Sweep from the left and select the cheapest split
+		uint32 split_bin = 0;
+		float split_cost = 0.0F;
+		math::Box left_box;
+		uint32 left_count = 0;
+		for (uint32 bin = 1; bin < kBinCount; ++bin)
+		{
+			if (bin_counts[bin - 1] > 0)
+			{
+				left_box = left_count == 0 ? bin_boxes[bin - 1] : math::Box::Merge(left_box, bin_boxes[bin - 1]);
+				left_count += bin_counts[bin - 1];
+			}
+			if (left_count == 0 || left_count == primitive_count)
+			{
+				continue;
+			}
+			const float cost = SurfaceArea(left_box) * static_cast<float>(left_count) + right_costs[bin];
+			if (split_bin == 0 || cost < split_cost)
+			{
+				split_bin = bin;
+				split_cost = cost;
+			}
+		}
+
+		if (split_bin != 0)
+		{
+			primitives_middle = std::partition(primitives_begin, primitives_end, [&](const Primitive& primitive) {
+				return get_bin(primitive) < split_bin;
+			});
+		}
+	}
+
+	if (primitives_middle == primitives_begin || primitives_middle == primitives_end)
+	{
+		// Coincident centroids. Split the primitives in half.
+		primitives_middle = primitives_begin + primitive_count / 2;
+		std::nth_element(primitives_begin, primitives_middle, primitives_end, [axis](const Primitive& lhs, const Primitive& rhs) {
+			return GetAxis(lhs.centroid_, axis) < GetAxis(rhs.centroid_, axis);
+		});
+	}
+
+	const auto left_count = static_cast<uint32>(primitives_middle - primitives_begin);
+	const auto left_child = static_cast<uint32>(nodes_.size());
+	nodes_[node_index].left_child_ = left_child;
+	nodes_.push_back(Node{math::Box(), 0, node_index, first_primitive, left_count});
+	nodes_.push_back(Node{math::Box(), 0, node_index, first_primitive + left_count, primitive_count - left_count});
+	BuildNode(left_child, depth + 1);
+	BuildNode(left_child + 1, depth + 1);
+}
+
+void BoundingVolumeHierarchy::Refit(uint32 node_index)
+{
+	while (node_index != kInvalidIndex)
+	{
+		Node& node = nodes_[node_index];
+		math::Box box;
+		if (node.left_child_ == 0)
+		{
+			box = primitives_[node.first_primitive_].box_;
+			const uint32 last_primitive = node.first_primitive_ + node.primitive_count_;
+			for (uint32 primitive_index = node.first_primitive_ + 1; primitive_index < last_primitive; ++primitive_index)
+			{
+				box.Merge(primitives_[primitive_index].box_);
+			}
+		}
+		else
+		{
+			box = math::Box::Merge(nodes_[node.left_child_].box_, nodes_[node.left_child_ + 1].box_);
+		}
+
+		// Ancestors are unchanged once a node keeps its box
+		if (IsSameBox(box, node.box_))
+		{
+			return;
+		}
+		node.box_ = box;
+		node_index = node.parent_;
+	}
+}
+
+} // namespace zero::render
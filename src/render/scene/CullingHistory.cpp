@@ -0,0 +1,61 @@
+#include "render/scene/CullingHistory.hpp"
+#include "render/scene/BoundingVolumeHierarchy.hpp"
+#include "render/scene/SpatialHashGrid.hpp"
+
+namespace zero::render
+{
+
+CullingHistory::CullingHistory()
+: hierarchy_states_()
+, grid_states_()
+, hierarchy_generation_(0)
+, grid_generation_(0)
+, view_epoch_(0)
+{
+}
+
+void CullingHistory::BeginFrame(const BoundingVolumeHierarchy& bounding_volume_hierarchy,
+                                const SpatialHashGrid& spatial_hash_grid,
+                                bool is_view_unchanged)
+{
+	if (!is_view_unchanged || view_epoch_ == 0)
+	{
+		++view_epoch_;
+	}
+
+	// Rebuilds reorder the roots. Refits and relinks keep the index of every root.
+	if (hierarchy_generation_ != bounding_volume_hierarchy.GetGeneration())
+	{
+		hierarchy_generation_ = bounding_volume_hierarchy.GetGeneration();
+		hierarchy_states_.assign(bounding_volume_hierarchy.GetEntityCount(), State{});
+	}
+	if (grid_generation_ != spatial_hash_grid.GetGeneration())
+	{
+		grid_generation_ = spatial_hash_grid.GetGeneration();
+		grid_states_.assign(spatial_hash_grid.GetEntityCount(), State{});
+	}
+}
+
+bool CullingHistory::IsCulled(const IViewVolume& view_volume, const math::Sphere& sphere, uint32 volume_version, State& state) const
+{
+	if (state.view_epoch_ == view_epoch_ && state.volume_version_ == volume_version)
+	{
+		return state.is_culled_;
+	}
+	state.is_culled_ = view_volume.IsCulled(sphere, state.plane_hint_);
+	state.volume_version_ = volume_version;
+	state.view_epoch_ = view_epoch_;
+	return state.is_culled_;
+}
+
+CullingHistory::State& CullingHistory::GetHierarchyState(uint32 primitive_index)
+{
+	return hierarchy_states_[primitive_index];
+}
+
+CullingHistory::State& CullingHistory::GetGridState(uint32 entry_index)
+{
+	return grid_states_[entry_index];
+}
+
+} // namespace zero::render
@@ -1,49 +1,325 @@
+#include <algorithm>
+#include <cassert>
 #include "render/scene/CullingManager.hpp"
 #include "component/Camera.hpp"
+#include "component/Light.hpp"
 #include "component/Material.hpp"
 #include "component/Mesh.hpp"
 #include "component/Transform.hpp"
 #include "component/Volume.hpp"
+#include "math/Intersection.hpp"
 #include "render/scene/ViewVolumeBuilder.hpp"
 #include "render/scene/OrthographicViewVolume.hpp"
+#include "render/Constants.hpp"
 
 namespace zero::render
 {
 
-std::vector<Entity> CullingManager::GetRenderableEntities(const Camera& camera, const entt::registry& registry)
+namespace
 {
-	return GetViewableEntities(camera, registry);
+
+template<typename LightType>
+uint32 RankLights(const IViewVolume& view_volume,
+                  const math::Vec3f& camera_position,
+                  const entt::registry& registry,
+                  uint32 max_light_count,
+                  std::vector<CullingManager::RankedLight>& ranked_lights)
+{
+	ranked_lights.clear();
+	uint32 culled_count = 0;
+	auto light_view = registry.view<const LightType, const Transform>();
+	for (Entity entity : light_view)
+	{
+		const LightType& light = light_view.template get<const LightType>(entity);
+		const math::Sphere light_sphere(light_view.template get<const Transform>(entity).GetPosition(),
+		                                light.attenuation_.GetRange(Constants::kMinLightIntensity));
+		if (view_volume.IsCulled(light_sphere))
+		{
+			++culled_count;
+			continue;
+		}
+
+		const float brightness = math::Max(light.color_.x_, math::Max(light.color_.y_, light.color_.z_))
+		                         * (light.ambient_intensity_ + light.diffuse_intensity_);
+		ranked_lights.push_back(CullingManager::RankedLight{entity, CullingManager::GetLightInfluence(camera_position, light_sphere, brightness)});
+	}
+
+	// Break ties by entity so that the selected lights do not depend on the registry order
+	const auto is_more_influential = [](const CullingManager::RankedLight& lhs, const CullingManager::RankedLight& rhs) {
+		if (lhs.influence_ != rhs.influence_)
+		{
+			return lhs.influence_ > rhs.influence_;
+		}
+		return lhs.entity_ < rhs.entity_;
+	};
+	if (ranked_lights.size() > max_light_count)
+	{
+		std::partial_sort(ranked_lights.begin(), ranked_lights.begin() + max_light_count, ranked_lights.end(), is_more_influential);
+		ranked_lights.resize(max_light_count);
+	}
+	else
+	{
+		std::sort(ranked_lights.begin(), ranked_lights.end(), is_more_influential);
+	}
+	return culled_count;
 }
 
-std::vector<Entity> CullingManager::GetShadowCastingEntities(const math::Box& box, const entt::registry& registry)
+} // namespace
+
+void CullingManager::GetRenderableEntities(const Camera& camera,
+                                           const BoundingVolumeHierarchy& bounding_volume_hierarchy,
+                                           const SpatialHashGrid& spatial_hash_grid,
+                                           const entt::registry& registry,
+                                           std::vector<Entity>& renderable_entities)
+{
+	// Build the view volume on the stack to avoid a heap allocation per frame
+	switch (camera.GetProjectionType())
+	{
+		case Camera::ProjectionType::ORTHOGRAPHIC:
+		{
+			const OrthographicViewVolume view_volume = ViewVolumeBuilder::CreateOrthographic(camera);
+			bounding_volume_hierarchy.Query(view_volume, registry, renderable_entities);
+			spatial_hash_grid.Query(view_volume, registry, renderable_entities);
+			break;
+		}
+		default:
+		{
+			const PerspectiveViewVolume view_volume = ViewVolumeBuilder::CreatePerspective(camera);
+			bounding_volume_hierarchy.Query(view_volume, registry, renderable_entities);
+			spatial_hash_grid.Query(view_volume, registry, renderable_entities);
+			break;
+		}
+	}
+}
+
+void CullingManager::GetShadowCastingEntities(const math::Box& box,
+                                              const BoundingVolumeHierarchy& bounding_volume_hierarchy,
+                                              const SpatialHashGrid& spatial_hash_grid,
+                                              const entt::registry& registry,
+                                              std::vector<Entity>& shadow_casting_entities)
 {
 	const OrthographicViewVolume culler{box.min_, box.max_};
-	return CullEntities(&culler, registry);
+	const auto first_entity = static_cast<std::vector<Entity>::difference_type>(shadow_casting_entities.size());
+	bounding_volume_hierarchy.Query(culler, registry, shadow_casting_entities);
+	spatial_hash_grid.Query(culler, registry, shadow_casting_entities);
+
+	const auto is_shadow_disabled = [&registry](Entity entity) {
+		return !registry.get<const Material>(entity).casts_shadows_;
+	};
+	shadow_casting_entities.erase(std::remove_if(shadow_casting_entities.begin() + first_entity,
+	                                             shadow_casting_entities.end(),
+	                                             is_shadow_disabled),
+	                              shadow_casting_entities.end());
+}
+
+uint32 CullingManager::GetShadowCascadeMasks(Span<const math::Box> cascade_boxes,
+                                             Span<const float> min_cascade_radii,
+                                             const entt::registry& registry,
+                                             Span<const Entity> entities,
+                                             std::vector<uint8>& cascade_masks)
+{
+	assert(cascade_boxes.size() <= kMaxShadowCascadeCount);
+	assert(cascade_boxes.size() == min_cascade_radii.size());
+	uint32 small_count = 0;
+	cascade_masks.resize(entities.size());
+	for (uint32 entity_index = 0; entity_index < entities.size(); ++entity_index)
+	{
+		const Entity entity = entities[entity_index];
+		uint8 cascade_mask = 0;
+		if (registry.get<const Material>(entity).casts_shadows_)
+		{
+			const math::Sphere& bounding_volume = registry.get<const Volume>(entity).bounding_volume_;
+			for (uint32 cascade_index = 0; cascade_index < cascade_boxes.size(); ++cascade_index)
+			{
+				const bool intersects = math::Intersection::BoxSphereIntersect(cascade_boxes[cascade_index], bounding_volume);
+				const bool is_large_enough = bounding_volume.radius_ >= min_cascade_radii[cascade_index];
+				small_count += static_cast<uint32>(intersects && !is_large_enough);
+				cascade_mask |= static_cast<uint8>(static_cast<uint8>(intersects && is_large_enough) << cascade_index);
+			}
+		}
+		cascade_masks[entity_index] = cascade_mask;
+	}
+	return small_count;
+}
+
+uint32 CullingManager::CullSmallEntities(const Camera& camera,
+                                         float min_pixel_radius,
+                                         const entt::registry& registry,
+                                         std::vector<Entity>& entities)
+{
+	if (min_pixel_radius <= 0.0F)
+	{
+		return 0;
+	}
+
+	// Pixels per world unit at unit depth for perspective projections, and at any depth for orthographic projections
+	const float tan_half_vertical_fov = math::Tan(camera.GetVerticalFieldOfView().rad_ * 0.5F);
+	const float half_viewport_height = static_cast<float>(camera.viewport_.height_) * 0.5F;
+	const math::Vec3f view_direction = camera.GetViewDirection();
+	const auto entity_count = static_cast<uint32>(entities.size());
+	if (camera.GetProjectionType() == Camera::ProjectionType::ORTHOGRAPHIC)
+	{
+		const float min_radius = min_pixel_radius * camera.near_clip_ * tan_half_vertical_fov / half_viewport_height;
+		entities.erase(std::remove_if(entities.begin(), entities.end(), [&registry, min_radius](Entity entity) {
+			return registry.get<const Volume>(entity).bounding_volume_.radius_ < min_radius;
+		}), entities.end());
+	}
+	else
+	{
+		// radius * pixel_scale / depth < min_pixel_radius, without dividing by the depth
+		const float pixel_scale = half_viewport_height / tan_half_vertical_fov;
+		entities.erase(std::remove_if(entities.begin(), entities.end(), [&](Entity entity) {
+			const math::Sphere& bounding_volume = registry.get<const Volume>(entity).bounding_volume_;
+			const float depth = math::Vec3f::Dot(bounding_volume.center_ - camera.position_, view_direction);
+			return depth > bounding_volume.radius_ && bounding_volume.radius_ * pixel_scale < min_pixel_radius * depth;
+		}), entities.end());
+	}
+	return entity_count - static_cast<uint32>(entities.size());
+}
+
+uint32 CullingManager::RankPointLights(const IViewVolume& view_volume,
+                                       const math::Vec3f& camera_position,
+                                       const entt::registry& registry,
+                                       uint32 max_light_count,
+                                       std::vector<RankedLight>& ranked_lights)
+{
+	return RankLights<PointLight>(view_volume, camera_position, registry, max_light_count, ranked_lights);
+}
+
+uint32 CullingManager::RankSpotLights(const IViewVolume& view_volume,
+                                      const math::Vec3f& camera_position,
+                                      const entt::registry& registry,
+                                      uint32 max_light_count,
+                                      std::vector<RankedLight>& ranked_lights)
+{
+	return RankLights<SpotLight>(view_volume, camera_position, registry, max_light_count, ranked_lights);
 }
 
-std::vector<Entity> CullingManager::GetViewableEntities(const Camera& camera, const entt::registry& registry)
+float CullingManager::GetLightInfluence(const math::Vec3f& camera_position, const math::Sphere& light_sphere, float brightness)
 {
-	const std::unique_ptr<IViewVolume> culler = ViewVolumeBuilder::create(camera);
-	return CullEntities(culler.get(), registry);
+	const float distance = (light_sphere.center_ - camera_position).Magnitude();
+	if (distance <= light_sphere.radius_)
+	{
+		return brightness;
+	}
+	const float range_ratio = light_sphere.radius_ / distance;
+	return brightness * range_ratio * range_ratio;
 }
 
-std::vector<Entity> CullingManager::CullEntities(const IViewVolume* culler, const entt::registry& registry)
+void CullingManager::CullParallel(ThreadPool& thread_pool,
+                                  Span<const IViewVolume* const> view_volumes,
+                                  const BoundingVolumeHierarchy& bounding_volume_hierarchy,
+                                  const SpatialHashGrid& spatial_hash_grid,
+                                  const entt::registry& registry,
+                                  Span<CullingHistory> culling_histories,
+                                  std::vector<std::vector<Entity>>& chunk_entities,
+                                  Span<std::vector<Entity>> entities)
 {
-	// Viewable entities must have Transform, Material, and Volume components
-	auto renderable_view = registry.view<const Transform, const Volume, const Material, const Mesh>();
-	std::vector<Entity> viewable_entities{};
-	// Get all root entities that are visible
-	for (Entity renderable_entity : renderable_view)
+	assert(view_volumes.size() == entities.size());
+	assert(culling_histories.empty() || culling_histories.size() == view_volumes.size());
+	const uint32 hierarchy_chunk_count = bounding_volume_hierarchy.GetChunkCount();
+	const uint32 chunk_count = hierarchy_chunk_count + spatial_hash_grid.GetChunkCount();
+	const uint32 task_count = view_volumes.size() * chunk_count;
+	if (chunk_entities.size() < task_count)
 	{
-		const Material& material = renderable_view.get<const Material>(renderable_entity);
-		const Volume& volume = renderable_view.get<const Volume>(renderable_entity);
-		if (!material.visible_ || culler->IsCulled(volume.bounding_volume_))
+		chunk_entities.resize(task_count);
+	}
+
+	// The tasks only read the spatial structures and the registry. Each task writes to its own list.
+	thread_pool.ParallelFor(task_count, [&](uint32 task_index) {
+		const uint32 view_index = task_index / chunk_count;
+		const uint32 chunk_index = task_index % chunk_count;
+		const IViewVolume& view_volume = *view_volumes[view_index];
+		// The chunks of a view share its history but never the same roots
+		CullingHistory* culling_history = culling_histories.empty() ? nullptr : &culling_histories[view_index];
+		std::vector<Entity>& task_entities = chunk_entities[task_index];
+		task_entities.clear();
+		if (chunk_index < hierarchy_chunk_count)
 		{
-			continue;
+			bounding_volume_hierarchy.QueryChunk(chunk_index, view_volume, registry, culling_history, task_entities);
 		}
-		viewable_entities.push_back(renderable_entity);
+		else
+		{
+			spatial_hash_grid.QueryChunk(chunk_index - hierarchy_chunk_count, view_volume, registry, culling_history, task_entities);
+		}
+	});
+
+	thread_pool.ParallelFor(view_volumes.size(), [&](uint32 view_index) {
+		std::vector<Entity>& view_entities = entities[view_index];
+		view_entities.clear();
+		for (uint32 chunk_index = 0; chunk_index < chunk_count; ++chunk_index)
+		{
+			const std::vector<Entity>& task_entities = chunk_entities[view_index * chunk_count + chunk_index];
+			view_entities.insert(view_entities.end(), task_entities.begin(), task_entities.end());
+		}
+	});
+}
+
+bool CullingManager::IsHierarchyRoot(const entt::registry& registry, Entity entity)
+{
+	const Entity parent = registry.get<const Transform>(entity).GetParent();
+	return parent == NullEntity || registry.try_get<const Volume>(parent) == nullptr;
+}
+
+void CullingManager::CullHierarchy(const IViewVolume& view_volume,
+                                   const entt::registry& registry,
+                                   Entity entity,
+                                   std::vector<Entity>& entities)
+{
+	if (view_volume.IsCulled(registry.get<const Volume>(entity).bounding_volume_))
+	{
+		return;
+	}
+	CullVisibleHierarchy(view_volume, registry, entity, entities);
+}
+
+void CullingManager::CullVisibleHierarchy(const IViewVolume& view_volume,
+                                          const entt::registry& registry,
+                                          Entity entity,
+                                          std::vector<Entity>& entities)
+{
+	const std::vector<Entity>& children = registry.get<const Transform>(entity).GetChildren();
+	if (!children.empty())
+	{
+		const math::Sphere& bounding_volume = registry.get<const Volume>(entity).bounding_volume_;
+		const math::Vec3f extent(bounding_volume.radius_, bounding_volume.radius_, bounding_volume.radius_);
+		const math::Box bounding_box(bounding_volume.center_ - extent, bounding_volume.center_ + extent);
+		if (view_volume.Classify(bounding_box) == IViewVolume::Containment::INSIDE)
+		{
+			AcceptHierarchy(registry, entity, entities);
+			return;
+		}
+	}
+
+	AppendRenderable(registry, entity, entities);
+	for (Entity child : children)
+	{
+		if (registry.try_get<const Volume>(child) != nullptr)
+		{
+			CullHierarchy(view_volume, registry, child, entities);
+		}
+	}
+}
+
+void CullingManager::AcceptHierarchy(const entt::registry& registry, Entity entity, std::vector<Entity>& entities)
+{
+	AppendRenderable(registry, entity, entities);
+	for (Entity child : registry.get<const Transform>(entity).GetChildren())
+	{
+		if (registry.try_get<const Volume>(child) != nullptr)
+		{
+			AcceptHierarchy(registry, child, entities);
+		}
+	}
+}
+
+void CullingManager::AppendRenderable(const entt::registry& registry, Entity entity, std::vector<Entity>& entities)
+{
+	const Material* material = registry.try_get<const Material>(entity);
+	if (material != nullptr && material->visible_ && registry.try_get<const Mesh>(entity) != nullptr)
+	{
+		entities.push_back(entity);
 	}
-	return viewable_entities;
 }
 
-} // namespace zero::render
\ No newline at end of file
+} // namespace zero::render
@@ -0,0 +1,189 @@
+#include <algorithm>
+#include <cmath>
+#include "render/scene/LightClusterBuilder.hpp"
+#include "math/Box.hpp"
+#include "math/Intersection.hpp"
+
+namespace zero::render
+{
+
+namespace
+{
+
+constexpr uint32 kLightCountBits = 16;
+constexpr uint32 kMaxClusterLightCount = (1U << kLightCountBits) - 1U;
+
+math::Sphere CreateViewSphere(const math::Matrix4x4& view_matrix, const math::Vec3f& position, const Attenuation& attenuation, float far_clip)
+{
+	const math::Vec4f view_position = view_matrix * math::Vec4f(position.x_, position.y_, position.z_, 1.0F);
+	const float radius = math::Min(attenuation.GetRange(Constants::kMinLightIntensity), far_clip);
+	return math::Sphere(math::Vec3f(view_position.x_, view_position.y_, -view_position.z_), radius);
+}
+
+/**
+ * @return the view depth of the near side of a depth slice
+ */
+float GetSliceDepth(const Camera& camera, uint32 slice_index)
+{
+	const float exponent = static_cast<float>(slice_index) / static_cast<float>(Constants::kLightClusterCountZ);
+	return camera.near_clip_ * std::pow(camera.far_clip_ / camera.near_clip_, exponent);
+}
+
+bool IsInDepthRange(const math::Sphere& sphere, float near_depth, float far_depth)
+{
+	return sphere.radius_ > 0.0F
+	       && (sphere.center_.z_ + sphere.radius_) >= near_depth
+	       && (sphere.center_.z_ - sphere.radius_) <= far_depth;
+}
+
+} // namespace
+
+LightClusterBuilder::LightClusterBuilder()
+: point_light_spheres_()
+, spot_light_spheres_()
+, slice_states_()
+{
+	point_light_spheres_.reserve(Constants::kMaxPointLights);
+	spot_light_spheres_.reserve(Constants::kMaxSpotLights);
+}
+
+void LightClusterBuilder::Build(ThreadPool& thread_pool,
+                                const Camera& camera,
+                                Span<const PointLightEntry> point_lights,
+                                Span<const SpotLightEntry> spot_lights,
+                                LightClusterGrid& light_cluster_grid)
+{
+	const math::Matrix4x4 view_matrix = camera.GetViewMatrix();
+	const float depth_range = std::log(camera.far_clip_ / camera.near_clip_);
+	light_cluster_grid.view_matrix_ = view_matrix;
+	light_cluster_grid.projection_matrix_ = camera.GetProjectionMatrix();
+	light_cluster_grid.depth_scale_ = static_cast<float>(Constants::kLightClusterCountZ) / depth_range;
+	light_cluster_grid.depth_bias_ = -static_cast<float>(Constants::kLightClusterCountZ) * std::log(camera.near_clip_) / depth_range;
+	light_cluster_grid.clusters_.resize(Constants::kLightClusterCount);
+	light_cluster_grid.light_indices_.clear();
+
+	point_light_spheres_.clear();
+	spot_light_spheres_.clear();
+	const uint32 point_light_count = std::min(point_lights.size(), Constants::kMaxPointLights);
+	const uint32 spot_light_count = std::min(spot_lights.size(), Constants::kMaxSpotLights);
+	for (uint32 i = 0; i < point_light_count; ++i)
+	{
+		const PointLightEntry& point_light = point_lights[i];
+		point_light_spheres_.push_back(CreateViewSphere(view_matrix, point_light.position_, point_light.light_.attenuation_, camera.far_clip_));
+	}
+	for (uint32 i = 0; i < spot_light_count; ++i)
+	{
+		const SpotLightEntry& spot_light = spot_lights[i];
+		spot_light_spheres_.push_back(CreateViewSphere(view_matrix, spot_light.position_, spot_light.light_.attenuation_, camera.far_clip_));
+	}
+
+	LightCluster* clusters = light_cluster_grid.clusters_.data();
+	thread_pool.ParallelFor(Constants::kLightClusterCountZ, [this, &camera, clusters](uint32 slice_index)
+	{
+		BuildSlice(slice_index, camera, clusters + (slice_index * kSliceClusterCount));
+	});
+
+	// Concatenate the light indices of the slices and make the cluster offsets absolute
+	uint32 light_index_count = 0;
+	for (uint32 slice_index = 0; slice_index < Constants::kLightClusterCountZ; ++slice_index)
+	{
+		const std::vector<uint32>& slice_light_indices = slice_states_[slice_index].light_indices_;
+		LightCluster* slice_clusters = clusters + (slice_index * kSliceClusterCount);
+		for (uint32 cluster_index = 0; cluster_index < kSliceClusterCount; ++cluster_index)
+		{
+			LightCluster& cluster = slice_clusters[cluster_index];
+			const uint32 cluster_light_count = (cluster.light_counts_ & kMaxClusterLightCount) + (cluster.light_counts_ >> kLightCountBits);
+			if (light_index_count + cluster.light_index_offset_ + cluster_light_count > Constants::kMaxLightClusterIndexCount)
+			{
+				cluster = LightCluster{0, 0};
+				continue;
+			}
+			cluster.light_index_offset_ += light_index_count;
+		}
+
+		const uint32 copy_count = std::min(static_cast<uint32>(slice_light_indices.size()),
+		                                   Constants::kMaxLightClusterIndexCount - light_index_count);
+		light_cluster_grid.light_indices_.insert(light_cluster_grid.light_indices_.end(),
+		                                         slice_light_indices.begin(),
+		                                         slice_light_indices.begin() + copy_count);
+		light_index_count += copy_count;
+	}
+}
+
+void LightClusterBuilder::BuildSlice(uint32 slice_index, const Camera& camera, LightCluster* clusters)
+{
+	SliceState& slice_state = slice_states_[slice_index];
+	slice_state.point_light_candidates_.clear();
+	slice_state.spot_light_candidates_.clear();
+	slice_state.light_indices_.clear();
+
+	const float near_depth = GetSliceDepth(camera, slice_index);
+	const float far_depth = GetSliceDepth(camera, slice_index + 1);
+	for (uint32 i = 0; i < static_cast<uint32>(point_light_spheres_.size()); ++i)
+	{
+		if (IsInDepthRange(point_light_spheres_[i], near_depth, far_depth))
+		{
+			slice_state.point_light_candidates_.push_back(i);
+		}
+	}
+	for (uint32 i = 0; i < static_cast<uint32>(spot_light_spheres_.size()); ++i)
+	{
+		if (IsInDepthRange(spot_light_spheres_[i], near_depth, far_depth))
+		{
+			slice_state.spot_light_candidates_.push_back(i);
+		}
+	}
+
+	// The view space extents of the screen at unit depth for a perspective camera, or at any depth for an orthographic one
+	const bool is_perspective = camera.GetProjectionType() == Camera::ProjectionType::PERSPECTIVE;
+	float half_height = math::Tan(camera.GetVerticalFieldOfView().rad_ * 0.5F);
+	if (!is_perspective)
+	{
+		half_height *= camera.near_clip_;
+	}
+	const float half_width = half_height * camera.viewport_.GetAspectRatio();
+	const float min_scale = is_perspective ? near_depth : 1.0F;
+	const float max_scale = is_perspective ? far_depth : 1.0F;
+
+	for (uint32 y = 0; y < Constants::kLightClusterCountY; ++y)
+	{
+		const float bottom = (-1.0F + (2.0F * static_cast<float>(y) / static_cast<float>(Constants::kLightClusterCountY))) * half_height;
+		const float top = (-1.0F + (2.0F * static_cast<float>(y + 1) / static_cast<float>(Constants::kLightClusterCountY))) * half_height;
+		for (uint32 x = 0; x < Constants::kLightClusterCountX; ++x)
+		{
+			const float left = (-1.0F + (2.0F * static_cast<float>(x) / static_cast<float>(Constants::kLightClusterCountX))) * half_width;
+			const float right = (-1.0F + (2.0F * static_cast<float>(x + 1) / static_cast<float>(Constants::kLightClusterCountX))) * half_width;
+			const math::Box cluster_box(math::Vec3f(math::Min(left * min_scale, left * max_scale),
+			                                        math::Min(bottom * min_scale, bottom * max_scale),
+			                                        near_depth),
+			                            math::Vec3f(math::Max(right * min_scale, right * max_scale),
+			                                        math::Max(top * min_scale, top * max_scale),
+			                                        far_depth));
+
+			const auto light_index_offset = static_cast<uint32>(slice_state.light_indices_.size());
+			uint32 point_light_count = 0;
+			for (uint32 light_index : slice_state.point_light_candidates_)
+			{
+				if (math::Intersection::BoxSphereIntersect(cluster_box, point_light_spheres_[light_index]))
+				{
+					slice_state.light_indices_.push_back(light_index);
+					++point_light_count;
+				}
+			}
+			uint32 spot_light_count = 0;
+			for (uint32 light_index : slice_state.spot_light_candidates_)
+			{
+				if (math::Intersection::BoxSphereIntersect(cluster_box, spot_light_spheres_[light_index]))
+				{
+					slice_state.light_indices_.push_back(light_index);
+					++spot_light_count;
+				}
+			}
+
+			clusters[(y * Constants::kLightClusterCountX) + x] = LightCluster{light_index_offset,
+			                                                                  point_light_count | (spot_light_count << kLightCountBits)};
+		}
+	}
+}
+
+} // namespace zero::render
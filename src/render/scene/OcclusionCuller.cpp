@@ -0,0 +1,340 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "render/scene/OcclusionCuller.hpp"
+#include "component/Transform.hpp"
+#include "component/Volume.hpp"
+
+namespace zero::render
+{
+
+namespace
+{
+
+constexpr float kFarDepth = std::numeric_limits<float>::max();
+
+constexpr uint8 kVisible = 0;
+constexpr uint8 kOccluded = 1;
+constexpr uint8 kOccluder = 2;
+
+/**
+ * @brief The triangles of a box. Bit 0, 1 and 2 of a corner index select the maximum x, y and z coordinate.
+ */
+constexpr std::array<uint8, 36> kBoxTriangles{
+	0, 2, 6, 0, 6, 4, // -x
+	1, 5, 7, 1, 7, 3, // +x
+	0, 4, 5, 0, 5, 1, // -y
+	2, 3, 7, 2, 7, 6, // +y
+	0, 1, 3, 0, 3, 2, // -z
+	4, 6, 7, 4, 7, 5, // +z
+};
+
+math::Box CreateBox(const math::Sphere& sphere)
+{
+	const math::Vec3f extent(sphere.radius_, sphere.radius_, sphere.radius_);
+	return math::Box(sphere.center_ - extent, sphere.center_ + extent);
+}
+
+} // namespace
+
+OcclusionCuller::OcclusionCuller()
+: view_projection_(math::Matrix4x4::Identity())
+, occluders_()
+, depth_buffer_(kWidth * kHeight, kFarDepth)
+, tile_depths_(kTileColumnCount * kTileRowCount, kFarDepth)
+, visibilities_()
+{
+	occluders_.reserve(kMaxOccluderCount);
+}
+
+uint32 OcclusionCuller::Cull(ThreadPool& thread_pool, const Camera& camera, const entt::registry& registry, std::vector<Entity>& entities)
+{
+	RenderOccluders(thread_pool, camera, registry, entities);
+	if (occluders_.empty())
+	{
+		return 0;
+	}
+
+	const auto entity_count = static_cast<uint32>(entities.size());
+	visibilities_.assign(entity_count, kVisible);
+	for (const OccluderEntry& occluder : occluders_)
+	{
+		visibilities_[occluder.entity_index_] = kOccluder;
+	}
+
+	const uint32 batch_count = (entity_count + kTestBatchSize - 1) / kTestBatchSize;
+	thread_pool.ParallelFor(batch_count, [&](uint32 batch_index) {
+		const uint32 last_index = std::min(entity_count, (batch_index + 1) * kTestBatchSize);
+		for (uint32 entity_index = batch_index * kTestBatchSize; entity_index < last_index; ++entity_index)
+		{
+			if (visibilities_[entity_index] == kOccluder)
+			{
+				continue;
+			}
+			const math::Sphere& bounding_volume = registry.get<const Volume>(entities[entity_index]).bounding_volume_;
+			visibilities_[entity_index] = IsOccluded(CreateBox(bounding_volume)) ? kOccluded : kVisible;
+		}
+	});
+
+	// Remove the occluded entities without changing the order of the others
+	uint32 visible_count = 0;
+	for (uint32 entity_index = 0; entity_index < entity_count; ++entity_index)
+	{
+		if (visibilities_[entity_index] != kOccluded)
+		{
+			entities[visible_count++] = entities[entity_index];
+		}
+	}
+	entities.resize(visible_count);
+	return entity_count - visible_count;
+}
+
+void OcclusionCuller::RenderOccluders(ThreadPool& thread_pool,
+                                      const Camera& camera,
+                                      const entt::registry& registry,
+                                      const std::vector<Entity>& entities)
+{
+	view_projection_ = camera.GetProjectionMatrix() * camera.GetViewMatrix();
+	occluders_.clear();
+
+	for (uint32 entity_index = 0; entity_index < entities.size(); ++entity_index)
+	{
+		const Entity entity = entities[entity_index];
+		const Occluder* occluder = registry.try_get<const Occluder>(entity);
+		if (occluder == nullptr)
+		{
+			continue;
+		}
+
+		OccluderEntry occluder_entry{entity_index, 0.0F, {}};
+		const math::Matrix4x4 model_view_projection = view_projection_ * registry.get<const Transform>(entity).GetLocalToWorldMatrix();
+		if (!ProjectBox(model_view_projection, occluder->box_, occluder_entry.corners_))
+		{
+			continue;
+		}
+
+		// Select occluders by the area of their screen space bounding rectangle
+		float min_x = static_cast<float>(kWidth);
+		float max_x = 0.0F;
+		float min_y = static_cast<float>(kHeight);
+		float max_y = 0.0F;
+		for (const math::Vec3f& corner : occluder_entry.corners_)
+		{
+			min_x = std::min(min_x, corner.x_);
+			max_x = std::max(max_x, corner.x_);
+			min_y = std::min(min_y, corner.y_);
+			max_y = std::max(max_y, corner.y_);
+		}
+		const float width = std::min(max_x, static_cast<float>(kWidth)) - std::max(min_x, 0.0F);
+		const float height = std::min(max_y, static_cast<float>(kHeight)) - std::max(min_y, 0.0F);
+		occluder_entry.screen_area_ = std::max(width, 0.0F) * std::max(height, 0.0F) / static_cast<float>(kWidth * kHeight);
+		if (occluder_entry.screen_area_ >= kMinOccluderScreenArea)
+		{
+			occluders_.push_back(occluder_entry);
+		}
+	}
+
+	if (occluders_.size() > kMaxOccluderCount)
+	{
+		std::nth_element(occluders_.begin(), occluders_.begin() + (kMaxOccluderCount - 1), occluders_.end(), [](const OccluderEntry& lhs, const OccluderEntry& rhs) {
+			return lhs.screen_area_ > rhs.screen_area_;
+		});
+		occluders_.resize(kMaxOccluderCount);
+	}
+
+	// Every task owns a row of tiles, so no two tasks write to the same pixel
+	thread_pool.ParallelFor(kTileRowCount, [this](uint32 tile_row) {
+		RasterizeTileRow(tile_row);
+	});
+}
+
+bool OcclusionCuller::IsOccluded(const math::Box& box) const
+{
+	std::array<math::Vec3f, kBoxCornerCount> corners{};
+	if (!ProjectBox(view_projection_, box, corners))
+	{
+		return false;
+	}
+
+	float min_x = corners[0].x_;
+	float max_x = corners[0].x_;
+	float min_y = corners[0].y_;
+	float max_y = corners[0].y_;
+	float nearest_depth = corners[0].z_;
+	for (const math::Vec3f& corner : corners)
+	{
+		min_x = std::min(min_x, corner.x_);
+		max_x = std::max(max_x, corner.x_);
+		min_y = std::min(min_y, corner.y_);
+		max_y = std::max(max_y, corner.y_);
+		nearest_depth = std::min(nearest_depth, corner.z_);
+	}
+
+	// Every pixel the projected box overlaps
+	const auto x_begin = static_cast<uint32>(std::floor(std::clamp(min_x, 0.0F, static_cast<float>(kWidth))));
+	const auto x_end = static_cast<uint32>(std::ceil(std::clamp(max_x, 0.0F, static_cast<float>(kWidth))));
+	const auto y_begin = static_cast<uint32>(std::floor(std::clamp(min_y, 0.0F, static_cast<float>(kHeight))));
+	const auto y_end = static_cast<uint32>(std::ceil(std::clamp(max_y, 0.0F, static_cast<float>(kHeight))));
+	if (x_begin >= x_end || y_begin >= y_end)
+	{
+		// Outside of the screen. Leave it to view frustum culling.
+		return false;
+	}
+
+	for (uint32 tile_row = y_begin / kTileSize; tile_row <= (y_end - 1) / kTileSize; ++tile_row)
+	{
+		for (uint32 tile_column = x_begin / kTileSize; tile_column <= (x_end - 1) / kTileSize; ++tile_column)
+		{
+			if (tile_depths_[tile_row * kTileColumnCount + tile_column] < nearest_depth)
+			{
+				// Every pixel in the tile is nearer than the box
+				continue;
+			}
+
+			const uint32 row_end = std::min(y_end, (tile_row + 1) * kTileSize);
+			const uint32 column_begin = std::max(x_begin, tile_column * kTileSize);
+			const uint32 column_end = std::min(x_end, (tile_column + 1) * kTileSize);
+			for (uint32 y = std::max(y_begin, tile_row * kTileSize); y < row_end; ++y)
+			{
+				const float* depth_row = &depth_buffer_[y * kWidth];
+				for (uint32 x = column_begin; x < column_end; ++x)
+				{
+					if (depth_row[x] >= nearest_depth)
+					{
+						return false;
+					}
+				}
+			}
+		}
+	}
+	return true;
+}
+
+uint32 OcclusionCuller::GetOccluderCount() const
+{
+	return static_cast<uint32>(occluders_.size());
+}
+
+bool OcclusionCuller::ProjectBox(const math::Matrix4x4& model_view_projection,
+                                 const math::Box& box,
+                                 std::array<math::Vec3f, kBoxCornerCount>& corners)
+{
+	for (uint32 corner_index = 0; corner_index < kBoxCornerCount; ++corner_index)
+	{
+		const math::Vec4f corner((corner_index & 1U) != 0 ? box.max_.x_ : box.min_.x_,
+		                         (corner_index & 2U) != 0 ? box.max_.y_ : box.min_.y_,
+		                         (corner_index & 4U) != 0 ? box.max_.z_ : box.min_.z_,
+		                         1.0F);
+		const math::Vec4f clip_corner = model_view_projection * corner;
+
+		// Boxes crossing the near plane are not clipped. Occluders are ignored and occludees are visible.
+		if (clip_corner.w_ <= math::kEpsilon || clip_corner.z_ < -clip_corner.w_)
+		{
+			return false;
+		}
+
+		const float inverse_w = 1.0F / clip_corner.w_;
+		corners[corner_index] = math::Vec3f((clip_corner.x_ * inverse_w * 0.5F + 0.5F) * static_cast<float>(kWidth),
+		                                    (clip_corner.y_ * inverse_w * 0.5F + 0.5F) * static_cast<float>(kHeight),
+		                                    clip_corner.z_ * inverse_w);
+	}
+	return true;
+}
+
+void OcclusionCuller::RasterizeTileRow(uint32 tile_row)
+{
+	const uint32 first_row = tile_row * kTileSize;
+	const uint32 last_row = first_row + kTileSize;
+	std::fill(depth_buffer_.begin() + first_row * kWidth, depth_buffer_.begin() + last_row * kWidth, kFarDepth);
+
+	for (const OccluderEntry& occluder : occluders_)
+	{
+		for (uint32 i = 0; i < kBoxTriangles.size(); i += 3)
+		{
+			RasterizeTriangle(occluder.corners_[kBoxTriangles[i]],
+			                  occluder.corners_[kBoxTriangles[i + 1]],
+			                  occluder.corners_[kBoxTriangles[i + 2]],
+			                  first_row,
+			                  last_row);
+		}
+	}
+
+	for (uint32 tile_column = 0; tile_column < kTileColumnCount; ++tile_column)
+	{
+		float tile_depth = std::numeric_limits<float>::lowest();
+		for (uint32 y = first_row; y < last_row; ++y)
+		{
+			const float* depth_row = &depth_buffer_[y * kWidth + tile_column * kTileSize];
+			for (uint32 x = 0; x < kTileSize; ++x)
+			{
+				tile_depth = std::max(tile_depth, depth_row[x]);
+			}
+		}
+		tile_depths_[tile_row * kTileColumnCount + tile_column] = tile_depth;
+	}
+}
+
+void OcclusionCuller::RasterizeTriangle(const math::Vec3f& v0,
+                                        const math::Vec3f& v1,
+                                        const math::Vec3f& v2,
+                                        uint32 first_row,
+                                        uint32 last_row)
+{
+	// Wind the triangle counter-clockwise so that the edge functions are positive inside
+	float area = (v1.x_ - v0.x_) * (v2.y_ - v0.y_) - (v1.y_ - v0.y_) * (v2.x_ - v0.x_);
+	const math::Vec3f& a = v0;
+	const math::Vec3f& b = area < 0.0F ? v2 : v1;
+	const math::Vec3f& c = area < 0.0F ? v1 : v2;
+	area = std::abs(area);
+	if (area < math::kEpsilon)
+	{
+		return;
+	}
+
+	// Pixels whose center is inside the bounding rectangle of the triangle
+	const float min_x = std::clamp(std::min({a.x_, b.x_, c.x_}), 0.0F, static_cast<float>(kWidth));
+	const float max_x = std::clamp(std::max({a.x_, b.x_, c.x_}), 0.0F, static_cast<float>(kWidth));
+	const float min_y = std::clamp(std::min({a.y_, b.y_, c.y_}), static_cast<float>(first_row), static_cast<float>(last_row));
+	const float max_y = std::clamp(std::max({a.y_, b.y_, c.y_}), static_cast<float>(first_row), static_cast<float>(last_row));
+	const auto x_begin = static_cast<uint32>(std::ceil(min_x - 0.5F));
+	const auto x_end = std::min(kWidth, static_cast<uint32>(std::floor(max_x - 0.5F) + 1.0F));
+	const auto y_begin = static_cast<uint32>(std::ceil(min_y - 0.5F));
+	const auto y_end = std::min(last_row, static_cast<uint32>(std::floor(max_y - 0.5F) + 1.0F));
+	if (x_begin >= x_end || y_begin >= y_end)
+	{
+		return;
+	}
+
+	// Edge functions opposite to each vertex. They are the barycentric weights of the vertices scaled by the area.
+	const auto edge = [](const math::Vec3f& from, const math::Vec3f& to, float x, float y) {
+		return (to.x_ - from.x_) * (y - from.y_) - (to.y_ - from.y_) * (x - from.x_);
+	};
+	const float step_a = b.y_ - c.y_;
+	const float step_b = c.y_ - a.y_;
+	const float step_c = a.y_ - b.y_;
+	const float inverse_area = 1.0F / area;
+
+	for (uint32 y = y_begin; y < y_end; ++y)
+	{
+		const float center_x = static_cast<float>(x_begin) + 0.5F;
+		const float center_y = static_cast<float>(y) + 0.5F;
+		const float row_a = edge(b, c, center_x, center_y);
+		const float row_b = edge(c, a, center_x, center_y);
+		const float row_c = edge(a, b, center_x, center_y);
+		float* depth_row = &depth_buffer_[y * kWidth];
+
+		// Branchless so that the compiler can vectorize the row
+		for (uint32 x = x_begin; x < x_end; ++x)
+		{
+			const auto offset = static_cast<float>(x - x_begin);
+			const float weight_a = row_a + step_a * offset;
+			const float weight_b = row_b + step_b * offset;
+			const float weight_c = row_c + step_c * offset;
+			const float depth = (weight_a * a.z_ + weight_b * b.z_ + weight_c * c.z_) * inverse_area;
+			const bool is_inside = weight_a >= 0.0F && weight_b >= 0.0F && weight_c >= 0.0F;
+			depth_row[x] = is_inside ? std::min(depth_row[x], depth) : depth_row[x];
+		}
+	}
+}
+
+} // namespace zero::render
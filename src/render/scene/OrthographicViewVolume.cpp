@@ -24,11 +24,25 @@ bool OrthographicViewVolume::IsCulled(const math::Sphere& sphere) const
     return !math::Intersection::BoxSphereIntersect(view_box_, sphere);
 }
 
+bool OrthographicViewVolume::IsCulled(const math::Sphere& sphere, uint8& /* plane_hint */) const
+{
+    return IsCulled(sphere);
+}
+
 bool OrthographicViewVolume::IsCulled(const math::Box& box) const
 {
     return !(view_box_.Intersects(box) || view_box_.Contains(box));
 }
 
+IViewVolume::Containment OrthographicViewVolume::Classify(const math::Box& box) const
+{
+    if (view_box_.Contains(box))
+    {
+        return Containment::INSIDE;
+    }
+    return view_box_.Intersects(box) ? Containment::INTERSECTS : Containment::OUTSIDE;
+}
+
 const zero::math::Box& OrthographicViewVolume::GetViewBox() const
 {
     return view_box_;
@@ -48,6 +48,22 @@ bool PerspectiveViewVolume::IsCulled(const math::Sphere& sphere) const
     return false;
 }
 
+bool PerspectiveViewVolume::IsCulled(const math::Sphere& sphere, uint8& plane_hint) const
+{
+    constexpr uint8 plane_count = 6;
+    const uint8 first_plane = plane_hint < plane_count ? plane_hint : 0;
+    for (uint8 i = 0; i < plane_count; ++i)
+    {
+        const uint8 plane_index = (first_plane + i) % plane_count;
+        if (planes_[plane_index].Distance(sphere.center_) < -(sphere.radius_ + padding_))
+        {
+            plane_hint = plane_index;
+            return true;
+        }
+    }
+    return false;
+}
+
 bool PerspectiveViewVolume::IsCulled(const math::Box& box) const
 {
     // Are the min/max points on the wrong side of a plane?
@@ -62,6 +78,31 @@ bool PerspectiveViewVolume::IsCulled(const math::Box& box) const
     return false;
 }
 
+IViewVolume::Containment PerspectiveViewVolume::Classify(const math::Box& box) const
+{
+    Containment containment = Containment::INSIDE;
+    for (const auto& plane : planes_)
+    {
+        // The corners furthest along (p-vertex) and against (n-vertex) the plane normal
+        const math::Vec3f p_vertex(plane.normal_.x_ >= 0.0F ? box.max_.x_ : box.min_.x_,
+                                   plane.normal_.y_ >= 0.0F ? box.max_.y_ : box.min_.y_,
+                                   plane.normal_.z_ >= 0.0F ? box.max_.z_ : box.min_.z_);
+        if (plane.Distance(p_vertex) < -padding_)
+        {
+            return Containment::OUTSIDE;
+        }
+
+        const math::Vec3f n_vertex(plane.normal_.x_ >= 0.0F ? box.min_.x_ : box.max_.x_,
+                                   plane.normal_.y_ >= 0.0F ? box.min_.y_ : box.max_.y_,
+                                   plane.normal_.z_ >= 0.0F ? box.min_.z_ : box.max_.z_);
+        if (plane.Distance(n_vertex) < -padding_)
+        {
+            containment = Containment::INTERSECTS;
+        }
+    }
+    return containment;
+}
+
 const zero::math::Plane& PerspectiveViewVolume::GetLeftPlane() const
 {
     return planes_[0];
@@ -3,25 +3,97 @@
 namespace zero::render
 {
 
-RenderView::RenderView(const Camera& camera,
-                       const SkyDome& sky_dome,
-                       const TimeDelta& time_delta,
-                       std::shared_ptr<CascadedShadowMap> cascaded_shadow_map,
-                       std::vector<Entity>&& renderable_entities,
-                       std::array<std::vector<Entity>, Constants::kShadowCascadeCount>&& shadow_casting_entities,
-                       std::vector<DirectionalLight>&& directional_lights,
-                       std::vector<std::pair<PointLight, Transform>>&& point_lights,
-                       std::vector<std::pair<SpotLight, Transform>>&& spot_lights)
-: camera_(camera)
-, sky_dome_(sky_dome)
-, time_delta_(time_delta)
-, cascaded_shadow_map_(std::move(cascaded_shadow_map))
-, renderable_entities_(std::move(renderable_entities))
-, shadow_casting_entities_(std::move(shadow_casting_entities))
-, directional_lights_(std::move(directional_lights))
-, point_lights_(std::move(point_lights))
-, spot_lights_(std::move(spot_lights))
+RenderView::RenderView()
+: camera_()
+, sky_dome_()
+, time_delta_()
+, cascaded_shadow_map_(Constants::kShadowCascadeCount)
+, draw_items_()
+, draw_item_count_(0)
+, shadow_draw_items_()
+, directional_lights_()
+, point_lights_()
+, spot_lights_()
+, light_cluster_grid_()
+, culling_statistics_()
 {
+	directional_lights_.reserve(Constants::kMaxDirectionalLights);
+	point_lights_.reserve(Constants::kMaxPointLights);
+	spot_lights_.reserve(Constants::kMaxSpotLights);
+}
+
+void RenderView::Reset()
+{
+	draw_item_count_ = 0;
+	for (std::vector<ShadowDrawItem>& shadow_draw_items : shadow_draw_items_)
+	{
+		shadow_draw_items.clear();
+	}
+	directional_lights_.clear();
+	point_lights_.clear();
+	spot_lights_.clear();
+	light_cluster_grid_.clusters_.clear();
+	light_cluster_grid_.light_indices_.clear();
+	culling_statistics_ = CullingStatistics{};
+}
+
+void RenderView::SetCamera(const Camera& camera)
+{
+	camera_ = camera;
+}
+
+void RenderView::SetSkyDome(const SkyDome& sky_dome)
+{
+	sky_dome_ = sky_dome;
+}
+
+void RenderView::SetTimeDelta(const TimeDelta& time_delta)
+{
+	time_delta_ = time_delta;
+}
+
+void RenderView::SetCascadedShadowMap(const CascadedShadowMap& cascaded_shadow_map)
+{
+	cascaded_shadow_map_ = cascaded_shadow_map;
+}
+
+void RenderView::SetCullingStatistics(const CullingStatistics& culling_statistics)
+{
+	culling_statistics_ = culling_statistics;
+}
+
+DrawItem& RenderView::AddDrawItem()
+{
+	if (draw_item_count_ == draw_items_.size())
+	{
+		draw_items_.emplace_back();
+	}
+	return draw_items_[draw_item_count_++];
+}
+
+void RenderView::AddShadowDrawItem(uint32 cascade_index, const ShadowDrawItem& shadow_draw_item)
+{
+	shadow_draw_items_[cascade_index].push_back(shadow_draw_item);
+}
+
+void RenderView::AddDirectionalLight(const DirectionalLight& directional_light)
+{
+	directional_lights_.push_back(directional_light);
+}
+
+void RenderView::AddPointLight(const PointLightEntry& point_light)
+{
+	point_lights_.push_back(point_light);
+}
+
+void RenderView::AddSpotLight(const SpotLightEntry& spot_light)
+{
+	spot_lights_.push_back(spot_light);
+}
+
+LightClusterGrid& RenderView::GetMutableLightClusterGrid()
+{
+	return light_cluster_grid_;
 }
 
 const Camera& RenderView::GetCamera()
@@ -41,33 +113,43 @@ const TimeDelta& RenderView::GetTimeDelta()
 
 const CascadedShadowMap& RenderView::GetCascadedShadowMap()
 {
-	return *cascaded_shadow_map_;
+	return cascaded_shadow_map_;
 }
 
-const std::vector<Entity>& RenderView::GetRenderableEntities()
+Span<const DrawItem> RenderView::GetDrawItems()
 {
-	return renderable_entities_;
+	return Span<const DrawItem>(draw_items_.data(), draw_item_count_);
 }
 
-const std::vector<Entity>& RenderView::GetShadowCastingEntities(uint32 cascade_index)
+Span<const ShadowDrawItem> RenderView::GetShadowDrawItems(uint32 cascade_index)
 {
-	return shadow_casting_entities_[cascade_index];
+	return shadow_draw_items_[cascade_index];
 }
 
-const std::vector<DirectionalLight>& RenderView::GetDirectionalLights()
+Span<const DirectionalLight> RenderView::GetDirectionalLights()
 {
 	return directional_lights_;
 }
 
-const std::vector<std::pair<PointLight, Transform>>& RenderView::GetPointLights()
+Span<const PointLightEntry> RenderView::GetPointLights()
 {
 	return point_lights_;
 }
 
-const std::vector<std::pair<SpotLight, Transform>>& RenderView::GetSpotLights()
+Span<const SpotLightEntry> RenderView::GetSpotLights()
 {
 	return spot_lights_;
 }
 
+const LightClusterGrid& RenderView::GetLightClusterGrid()
+{
+	return light_cluster_grid_;
+}
+
+const CullingStatistics& RenderView::GetCullingStatistics()
+{
+	return culling_statistics_;
+}
+
 } // namespace zero::render
 
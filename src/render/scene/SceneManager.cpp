@@ -1,30 +1,91 @@
 #include "render/scene/SceneManager.hpp"
-#include "render/scene/RenderView.hpp"
+#include <cstring>
 #include "render/scene/CullingManager.hpp"
 #include "render/scene/RenderView.hpp"
+#include "render/scene/ViewVolumeBuilder.hpp"
 #include "render/CascadedShadowMap.hpp"
 #include "component/Material.hpp"
 #include "component/Mesh.hpp"
 #include "component/Volume.hpp"
-#include <queue>
+#include "core/Logger.hpp"
 
 namespace zero::render
 {
 
-SceneManager::SceneManager()
-: render_view_(nullptr)
+namespace
+{
+
+/**
+ * @brief Exact comparison of the view volume parameters. Epsilon comparisons would reuse culling results of slightly moved views.
+ */
+template<typename T>
+bool IsIdentical(const T& lhs, const T& rhs)
+{
+	return std::memcmp(&lhs, &rhs, sizeof(T)) == 0;
+}
+
+} // namespace
+
+SceneManager::SceneManager(uint32 render_view_count,
+                           uint32 culling_worker_count,
+                           bool reuse_unchanged_culling_results,
+                           float min_screen_pixel_radius,
+                           float min_shadow_texel_radius)
+: render_views_()
+, free_render_views_()
+, free_render_views_mutex_()
+, render_view_(nullptr)
 , cascaded_shadow_map_(std::make_unique<CascadedShadowMap>(Constants::kShadowCascadeCount))
-, renderable_cache_()
+, bounding_volume_hierarchy_()
+, spatial_hash_grid_()
+, occlusion_culler_()
+, light_cluster_builder_()
+, inactive_sky_dome_()
+, culling_thread_pool_(culling_worker_count)
+, shadow_cascade_boxes_()
+, view_volumes_()
+, culled_chunk_entities_()
+, culled_entities_()
+, shadow_cascade_masks_()
+, shadow_size_culled_count_(0)
+, ranked_lights_()
+, light_culled_count_(0)
+, culling_histories_()
+, previous_camera_view_projection_()
+, previous_shadow_box_()
+, has_previous_view_(false)
+, reuse_unchanged_culling_results_(reuse_unchanged_culling_results)
+, min_screen_pixel_radius_(min_screen_pixel_radius)
+, min_shadow_texel_radius_(min_shadow_texel_radius)
 {
+	inactive_sky_dome_.is_active_ = false;
+	view_volumes_.reserve(culled_entities_.size());
+	render_view_count = render_view_count == 0 ? 1 : render_view_count;
+	render_views_.reserve(render_view_count);
+	free_render_views_.reserve(render_view_count);
+	for (uint32 i = 0; i < render_view_count; ++i)
+	{
+		render_views_.push_back(std::make_unique<RenderView>());
+		free_render_views_.push_back(render_views_.back().get());
+	}
 }
 
 void SceneManager::UpdateView(entt::registry& registry, const TimeDelta& time_delta)
 {
+	if (render_view_ == nullptr)
+	{
+		render_view_ = AcquireView();
+	}
+	render_view_->Reset();
+	bounding_volume_hierarchy_.Update(registry);
+	spatial_hash_grid_.Update(registry);
+
 	const Camera& camera = GetPrimaryCamera(registry);
-	std::vector<DirectionalLight> directional_lights = GetDirectionalLights(registry);
-	for (const DirectionalLight& directional_light : directional_lights)
+	auto directional_light_view = registry.view<const DirectionalLight>();
+	for (Entity entity : directional_light_view)
 	{
 		// Update the cascaded shadow map with the first directional light that casts shadows
+		const DirectionalLight& directional_light = directional_light_view.get<const DirectionalLight>(entity);
 		if (directional_light.casts_shadows_)
 		{
 			cascaded_shadow_map_->Update(camera, directional_light);
@@ -32,22 +93,55 @@ void SceneManager::UpdateView(entt::registry& registry, const TimeDelta& time_de
 		}
 	}
 
-	render_view_ = std::make_unique<RenderView>(camera,
-	                                            GetSkyDome(registry),
-	                                            time_delta,
-	                                            cascaded_shadow_map_,
-	                                            GetRenderableEntities(camera, registry),
-	                                            GetShadowCastingEntities(registry),
-	                                            std::move(directional_lights),
-	                                            GetPointLights(registry),
-	                                            GetSpotLights(registry));
-	// Cache is no longer needed
-	renderable_cache_.clear();
+	render_view_->SetCamera(camera);
+	render_view_->SetTimeDelta(time_delta);
+	render_view_->SetCascadedShadowMap(*cascaded_shadow_map_);
+	ExtractSkyDome(registry, render_view_);
+	CullScene(camera, registry);
+	light_cluster_builder_.Build(culling_thread_pool_,
+	                             camera,
+	                             render_view_->GetPointLights(),
+	                             render_view_->GetSpotLights(),
+	                             render_view_->GetMutableLightClusterGrid());
+
+	// Remove the draws that are too small or hidden behind occluders before the draw items are generated
+	CullingStatistics culling_statistics{};
+	culling_statistics.frustum_visible_count_ = static_cast<uint32>(culled_entities_[kCameraViewIndex].size());
+	culling_statistics.screen_size_culled_count_ = CullingManager::CullSmallEntities(camera,
+	                                                                                 min_screen_pixel_radius_,
+	                                                                                 registry,
+	                                                                                 culled_entities_[kCameraViewIndex]);
+	culling_statistics.occluded_count_ = occlusion_culler_.Cull(culling_thread_pool_, camera, registry, culled_entities_[kCameraViewIndex]);
+	culling_statistics.occluder_count_ = occlusion_culler_.GetOccluderCount();
+	culling_statistics.shadow_size_culled_count_ = shadow_size_culled_count_;
+	culling_statistics.light_culled_count_ = light_culled_count_;
+	render_view_->SetCullingStatistics(culling_statistics);
+
+	ExtractRenderables(registry, render_view_);
+	ExtractShadowCasters(registry, render_view_);
 }
 
-std::unique_ptr<RenderView> SceneManager::GetLatestView()
+RenderView* SceneManager::GetLatestView()
 {
-	return std::move(render_view_);
+	RenderView* render_view = render_view_;
+	render_view_ = nullptr;
+	return render_view;
+}
+
+void SceneManager::ReleaseView(RenderView* render_view)
+{
+	std::lock_guard<std::mutex> lock(free_render_views_mutex_);
+	free_render_views_.push_back(render_view);
+}
+
+RenderView* SceneManager::AcquireView()
+{
+	std::lock_guard<std::mutex> lock(free_render_views_mutex_);
+	// The number of views in flight is bounded by the render thread, so a view is always available
+	assert(!free_render_views_.empty());
+	RenderView* render_view = free_render_views_.back();
+	free_render_views_.pop_back();
+	return render_view;
 }
 
 const Camera& SceneManager::GetPrimaryCamera(const entt::registry& registry)
@@ -57,119 +151,190 @@ const Camera& SceneManager::GetPrimaryCamera(const entt::registry& registry)
 	return camera_view.get<const Camera>(camera_view.front());
 }
 
-SkyDome SceneManager::GetSkyDome(const entt::registry& registry)
+void SceneManager::ExtractSkyDome(const entt::registry& registry, RenderView* render_view) const
 {
 	auto sky_dome_view = registry.view<const SkyDome>();
-
-	SkyDome inactive_sky_dome{};
-	inactive_sky_dome.is_active_ = false;
-
 	for (Entity sky_dome_entity : sky_dome_view)
 	{
 		// Get the first active sky dome
 		const SkyDome& sky_dome = sky_dome_view.get<const SkyDome>(sky_dome_entity);
 		if (sky_dome.is_active_)
 		{
-			return sky_dome;
+			render_view->SetSkyDome(sky_dome);
+			return;
 		}
 	}
-
-	return inactive_sky_dome;
+	render_view->SetSkyDome(inactive_sky_dome_);
 }
 
-std::vector<DirectionalLight> SceneManager::GetDirectionalLights(const entt::registry& registry)
+void SceneManager::ExtractLights(const IViewVolume& camera_view_volume,
+                                 const math::Vec3f& camera_position,
+                                 const entt::registry& registry,
+                                 RenderView* render_view)
 {
-	std::vector<DirectionalLight> directional_lights;
-
 	auto directional_light_view = registry.view<const DirectionalLight>();
-	directional_lights.reserve(directional_light_view.size());
-
 	for (Entity entity : directional_light_view)
 	{
-		const DirectionalLight& directional_light = directional_light_view.get<const DirectionalLight>(entity);
-		directional_lights.push_back(directional_light);
+		if (render_view->GetDirectionalLights().size() == Constants::kMaxDirectionalLights)
+		{
+			break;
+		}
+		render_view->AddDirectionalLight(directional_light_view.get<const DirectionalLight>(entity));
 	}
 
-	if (directional_lights.size() > Constants::kMaxDirectionalLights)
+	// Only the lights that reach the view are kept. The light budget goes to the most influential ones.
+	light_culled_count_ = CullingManager::RankPointLights(camera_view_volume,
+	                                                      camera_position,
+	                                                      registry,
+	                                                      Constants::kMaxPointLights,
+	                                                      ranked_lights_);
+	auto point_light_view = registry.view<const PointLight, const Transform>();
+	for (const CullingManager::RankedLight& ranked_light : ranked_lights_)
 	{
-		directional_lights.resize(Constants::kMaxDirectionalLights);
+		const auto& [point_light, transform] = point_light_view.get(ranked_light.entity_);
+		render_view->AddPointLight(PointLightEntry{point_light, transform.GetPosition()});
 	}
 
-	return directional_lights;
-}
-
-std::vector<std::pair<PointLight, Transform>> SceneManager::GetPointLights(const entt::registry& registry)
-{
-	std::vector<std::pair<PointLight, Transform>> point_lights;
-
-	auto point_light_view = registry.view<const PointLight, const Transform>();
-	point_lights.reserve(point_light_view.size_hint());
-
-	for (Entity entity : point_light_view)
+	light_culled_count_ += CullingManager::RankSpotLights(camera_view_volume,
+	                                                      camera_position,
+	                                                      registry,
+	                                                      Constants::kMaxSpotLights,
+	                                                      ranked_lights_);
+	auto spot_light_view = registry.view<const SpotLight, const Transform>();
+	for (const CullingManager::RankedLight& ranked_light : ranked_lights_)
 	{
-		const PointLight& point_light = point_light_view.get<const PointLight>(entity);
-		const Transform& transform = point_light_view.get<const Transform>(entity);
-		point_lights.emplace_back(point_light, transform);
+		const auto& [spot_light, transform] = spot_light_view.get(ranked_light.entity_);
+		render_view->AddSpotLight(SpotLightEntry{spot_light, transform.GetPosition(), spot_light.direction_});
 	}
+}
 
-	if (point_lights.size() > Constants::kMaxPointLights)
+void SceneManager::CullScene(const Camera& camera, const entt::registry& registry)
+{
+	// The view projection matrix covers the projection type, the clipping planes, and the camera transform
+	const math::Matrix4x4 camera_view_projection = camera.GetProjectionMatrix() * camera.GetViewMatrix();
+	const bool is_camera_unchanged = has_previous_view_ && IsIdentical(camera_view_projection, previous_camera_view_projection_);
+	previous_camera_view_projection_ = camera_view_projection;
+
+	// Build the camera's view volume on the stack to avoid a heap allocation per frame.
+	// The lights are culled against the same view volume as the renderable entities.
+	switch (camera.GetProjectionType())
 	{
-		point_lights.resize(Constants::kMaxPointLights);
+		case Camera::ProjectionType::ORTHOGRAPHIC:
+		{
+			const OrthographicViewVolume camera_view_volume = ViewVolumeBuilder::CreateOrthographic(camera);
+			CullScene(camera_view_volume, is_camera_unchanged, registry);
+			ExtractLights(camera_view_volume, camera.position_, registry, render_view_);
+			break;
+		}
+		default:
+		{
+			const PerspectiveViewVolume camera_view_volume = ViewVolumeBuilder::CreatePerspective(camera);
+			CullScene(camera_view_volume, is_camera_unchanged, registry);
+			ExtractLights(camera_view_volume, camera.position_, registry, render_view_);
+			break;
+		}
 	}
-
-	return point_lights;
 }
 
-std::vector<std::pair<SpotLight, Transform>> SceneManager::GetSpotLights(const entt::registry& registry)
+void SceneManager::CullScene(const IViewVolume& camera_view_volume, bool is_camera_unchanged, const entt::registry& registry)
 {
-	std::vector<std::pair<SpotLight, Transform>> spot_lights;
+	static_assert(Constants::kShadowCascadeCount <= CullingManager::kMaxShadowCascadeCount);
 
-	auto spot_light_view = registry.view<const SpotLight, const Transform>();
-	spot_lights.reserve(spot_light_view.size_hint());
+	// The amount the shadow map's bounding box is increased to avoid culling shadow casting entities
+	constexpr float bounding_box_expansion_factor = 2.0F;
 
-	for (Entity entity : spot_light_view)
+	const std::vector<math::Box>& world_bounding_boxes = cascaded_shadow_map_->GetWorldBoundingBoxes();
+	const math::Vec3f& light_direction = cascaded_shadow_map_->GetLightDirection();
+	for (uint32 cascade_index = 0; cascade_index < Constants::kShadowCascadeCount; ++cascade_index)
 	{
-		const SpotLight& spot_light = spot_light_view.get<const SpotLight>(entity);
-		const Transform& transform = spot_light_view.get<const Transform>(entity);
-		spot_lights.emplace_back(spot_light, transform);
+		math::Box world_bounding_box = world_bounding_boxes[cascade_index];
+
+		// Avoid culling shadow casting entities that are just outside the world bounding box of the cascaded shadow map
+		// by increasing the size of the box in the opposite direction of the light.
+		world_bounding_box.min_ -= light_direction * bounding_box_expansion_factor;
+		shadow_cascade_boxes_[cascade_index] = world_bounding_box;
 	}
 
-	if (spot_lights.size() > Constants::kMaxSpotLights)
+	// The shadow casters of every cascade are culled at once against the merged boxes
+	math::Box shadow_box = shadow_cascade_boxes_[0];
+	for (uint32 cascade_index = 1; cascade_index < Constants::kShadowCascadeCount; ++cascade_index)
 	{
-		spot_lights.resize(Constants::kMaxSpotLights);
+		shadow_box = math::Box::Merge(shadow_box, shadow_cascade_boxes_[cascade_index]);
 	}
-
-	return spot_lights;
+	const OrthographicViewVolume shadow_view_volume{shadow_box.min_, shadow_box.max_};
+
+	const bool is_shadow_box_unchanged = has_previous_view_ && IsIdentical(shadow_box, previous_shadow_box_);
+	previous_shadow_box_ = shadow_box;
+	culling_histories_[kCameraViewIndex].BeginFrame(bounding_volume_hierarchy_,
+	                                                spatial_hash_grid_,
+	                                                is_camera_unchanged && reuse_unchanged_culling_results_);
+	culling_histories_[kShadowViewIndex].BeginFrame(bounding_volume_hierarchy_,
+	                                                spatial_hash_grid_,
+	                                                is_shadow_box_unchanged && reuse_unchanged_culling_results_);
+	has_previous_view_ = true;
+
+	// The camera and the shadow casters share no mutable state, so they are culled concurrently
+	view_volumes_.clear();
+	view_volumes_.push_back(&camera_view_volume);
+	view_volumes_.push_back(&shadow_view_volume);
+	CullingManager::CullParallel(culling_thread_pool_,
+	                             view_volumes_,
+	                             bounding_volume_hierarchy_,
+	                             spatial_hash_grid_,
+	                             registry,
+	                             Span<CullingHistory>(culling_histories_.data(), kViewCount),
+	                             culled_chunk_entities_,
+	                             Span<std::vector<Entity>>(culled_entities_.data(), kViewCount));
+
+	// Farther cascades cover more of the world with each texel, so they drop larger casters
+	std::array<float, Constants::kShadowCascadeCount> min_cascade_radii{};
+	for (uint32 cascade_index = 0; cascade_index < Constants::kShadowCascadeCount; ++cascade_index)
+	{
+		min_cascade_radii[cascade_index] = min_shadow_texel_radius_ * cascaded_shadow_map_->GetTexelSize(cascade_index);
+	}
+	shadow_size_culled_count_ = CullingManager::GetShadowCascadeMasks(Span<const math::Box>(shadow_cascade_boxes_.data(), Constants::kShadowCascadeCount),
+	                                                                  Span<const float>(min_cascade_radii.data(), Constants::kShadowCascadeCount),
+	                                                                  registry,
+	                                                                  culled_entities_[kShadowViewIndex],
+	                                                                  shadow_cascade_masks_);
 }
 
-std::vector<Entity> SceneManager::GetRenderableEntities(const Camera& camera, const entt::registry& registry)
+void SceneManager::ExtractRenderables(const entt::registry& registry, RenderView* render_view) const
 {
-	return CullingManager::GetRenderableEntities(camera, registry);
+	const auto drawable_view = registry.view<const Transform, const Material, const Mesh>();
+	for (const Entity entity : culled_entities_[kCameraViewIndex])
+	{
+		const auto& [transform, material, mesh] = drawable_view.get(entity);
+		DrawItem& draw_item = render_view->AddDrawItem();
+		draw_item.mesh_id_ = mesh.mesh_id_;
+		// Assignment reuses the string capacity of the previous frame's material
+		draw_item.material_ = material;
+		draw_item.model_matrix_ = transform.GetLocalToWorldMatrix();
+	}
 }
 
-std::array<std::vector<Entity>, Constants::kShadowCascadeCount> SceneManager::GetShadowCastingEntities(const entt::registry& registry)
+void SceneManager::ExtractShadowCasters(const entt::registry& registry, RenderView* render_view) const
 {
-
-	std::array<std::vector<Entity>, Constants::kShadowCascadeCount> shadow_casting_renderables;
-	const std::vector<math::Box> world_bounding_boxes = cascaded_shadow_map_->GetWorldBoundingBoxes();
-	const math::Vec3f light_direction = cascaded_shadow_map_->GetLightDirection();
-	for (uint32 cascade_index = 0; cascade_index < Constants::kShadowCascadeCount; ++cascade_index)
+	const auto drawable_view = registry.view<const Transform, const Mesh>();
+	const std::vector<Entity>& shadow_casting_entities = culled_entities_[kShadowViewIndex];
+	for (uint32 entity_index = 0; entity_index < shadow_casting_entities.size(); ++entity_index)
 	{
-		// The amount the shadow map's bounding box is increased to avoid culling shadow casting entities
-		constexpr float bounding_box_expansion_factor = 2.0F;
-
-		math::Box world_bounding_box = world_bounding_boxes[cascade_index];
-
-		// Avoid culling shadow casting entities that are just outside the world bounding box of the cascaded shadow map
-		// by increasing the size of the box in the opposite direction of the light.
-		world_bounding_box.min_ -= light_direction * bounding_box_expansion_factor;
+		const uint8 cascade_mask = shadow_cascade_masks_[entity_index];
+		if (cascade_mask == 0)
+		{
+			continue;
+		}
 
-		// Cull shadow casting renderables for the world bounding box
-		shadow_casting_renderables[cascade_index] = CullingManager::GetShadowCastingEntities(world_bounding_box, registry);
+		const auto& [transform, mesh] = drawable_view.get(shadow_casting_entities[entity_index]);
+		const ShadowDrawItem shadow_draw_item{mesh.mesh_id_, transform.GetLocalToWorldMatrix()};
+		for (uint32 cascade_index = 0; cascade_index < Constants::kShadowCascadeCount; ++cascade_index)
+		{
+			if ((cascade_mask & (1U << cascade_index)) != 0)
+			{
+				render_view->AddShadowDrawItem(cascade_index, shadow_draw_item);
+			}
+		}
 	}
-
-	return shadow_casting_renderables;
 }
 
 } // namespace zero::render
-
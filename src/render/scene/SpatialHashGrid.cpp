@@ -0,0 +1,380 @@
+#include <algorithm>
+#include <cmath>
+#include "render/scene/SpatialHashGrid.hpp"
+#include "render/scene/CullingManager.hpp"
+#include "render/scene/OrthographicViewVolume.hpp"
+#include "render/scene/SphereViewVolume.hpp"
+#include "component/Transform.hpp"
+#include "component/Volume.hpp"
+
+namespace zero::render
+{
+
+namespace
+{
+
+math::Box CreateBox(const math::Sphere& sphere)
+{
+	const math::Vec3f extent(sphere.radius_, sphere.radius_, sphere.radius_);
+	return math::Box(sphere.center_ - extent, sphere.center_ + extent);
+}
+
+} // namespace
+
+SpatialHashGrid::SpatialHashGrid(float cell_size)
+: inverse_cell_size_(1.0F / cell_size)
+, registry_(nullptr)
+, cells_()
+, cell_table_()
+, entries_()
+, refit_cells_()
+, occupied_cell_count_(0)
+, generation_(0)
+, needs_rebuild_(true)
+{
+}
+
+SpatialHashGrid::~SpatialHashGrid()
+{
+	Detach();
+}
+
+void SpatialHashGrid::Update(entt::registry& registry)
+{
+	if (registry_ != &registry)
+	{
+		Detach();
+		Attach(registry);
+	}
+
+	if (needs_rebuild_)
+	{
+		Rebuild(registry);
+		return;
+	}
+
+	for (uint32 entry_index = 0; entry_index < entries_.size(); ++entry_index)
+	{
+		Entry& entry = entries_[entry_index];
+		const Volume& volume = registry.get<const Volume>(entry.entity_);
+		if (volume.version_ == entry.version_)
+		{
+			continue;
+		}
+		entry.version_ = volume.version_;
+		entry.sphere_ = volume.bounding_volume_;
+		entry.box_ = CreateBox(entry.sphere_);
+
+		const CellKey key = GetCellKey(entry.sphere_.center_);
+		const CellKey& current_key = cells_[entry.cell_].key_;
+		if (key.x_ == current_key.x_ && key.y_ == current_key.y_ && key.z_ == current_key.z_)
+		{
+			// The loose box may need to shrink as well as grow
+			MarkCellForRefit(entry.cell_);
+			continue;
+		}
+
+		UnlinkEntry(entry_index);
+		LinkEntry(entry_index, FindOrCreateCell(key));
+	}
+
+	for (uint32 cell_index : refit_cells_)
+	{
+		Cell& cell = cells_[cell_index];
+		cell.needs_refit_ = false;
+		if (cell.entry_count_ == 0)
+		{
+			continue;
+		}
+		cell.loose_box_ = entries_[cell.first_entry_].box_;
+		for (uint32 entry_index = entries_[cell.first_entry_].next_entry_; entry_index != kInvalidIndex; entry_index = entries_[entry_index].next_entry_)
+		{
+			cell.loose_box_.Merge(entries_[entry_index].box_);
+		}
+	}
+	refit_cells_.clear();
+
+	// Entities leave empty cells behind. Compact the cells once most of them are empty.
+	if (cells_.size() > kMinTableSize && occupied_cell_count_ * 2 < cells_.size())
+	{
+		RelinkEntries();
+	}
+}
+
+void SpatialHashGrid::Query(const IViewVolume& view_volume, const entt::registry& registry, std::vector<Entity>& entities) const
+{
+	QueryCells(0, static_cast<uint32>(cells_.size()), view_volume, registry, nullptr, entities);
+}
+
+uint32 SpatialHashGrid::GetChunkCount() const
+{
+	return std::min(kMaxChunkCount, static_cast<uint32>(cells_.size()));
+}
+
+void SpatialHashGrid::QueryChunk(uint32 chunk_index,
+                                 const IViewVolume& view_volume,
+                                 const entt::registry& registry,
+                                 CullingHistory* culling_history,
+                                 std::vector<Entity>& entities) const
+{
+	const uint32 chunk_count = GetChunkCount();
+	const auto cell_count = static_cast<uint64>(cells_.size());
+	const auto first_cell = static_cast<uint32>(cell_count * chunk_index / chunk_count);
+	const auto last_cell = static_cast<uint32>(cell_count * (chunk_index + 1) / chunk_count);
+	QueryCells(first_cell, last_cell, view_volume, registry, culling_history, entities);
+}
+
+void SpatialHashGrid::QueryCells(uint32 first_cell,
+                                 uint32 last_cell,
+                                 const IViewVolume& view_volume,
+                                 const entt::registry& registry,
+                                 CullingHistory* culling_history,
+                                 std::vector<Entity>& entities) const
+{
+	for (uint32 cell_index = first_cell; cell_index < last_cell; ++cell_index)
+	{
+		const Cell& cell = cells_[cell_index];
+		if (cell.entry_count_ == 0)
+		{
+			continue;
+		}
+
+		const IViewVolume::Containment containment = view_volume.Classify(cell.loose_box_);
+		if (containment == IViewVolume::Containment::OUTSIDE)
+		{
+			continue;
+		}
+
+		for (uint32 entry_index = cell.first_entry_; entry_index != kInvalidIndex; entry_index = entries_[entry_index].next_entry_)
+		{
+			const Entry& entry = entries_[entry_index];
+			if (containment == IViewVolume::Containment::INSIDE)
+			{
+				CullingManager::AcceptHierarchy(registry, entry.entity_, entities);
+			}
+			else if (culling_history == nullptr)
+			{
+				CullingManager::CullHierarchy(view_volume, registry, entry.entity_, entities);
+			}
+			else if (!culling_history->IsCulled(view_volume, entry.sphere_, entry.version_, culling_history->GetGridState(entry_index)))
+			{
+				CullingManager::CullVisibleHierarchy(view_volume, registry, entry.entity_, entities);
+			}
+		}
+	}
+}
+
+void SpatialHashGrid::Query(const math::Box& box, const entt::registry& registry, std::vector<Entity>& entities) const
+{
+	Query(OrthographicViewVolume{box.min_, box.max_}, registry, entities);
+}
+
+void SpatialHashGrid::Query(const math::Sphere& sphere, const entt::registry& registry, std::vector<Entity>& entities) const
+{
+	Query(SphereViewVolume{sphere}, registry, entities);
+}
+
+uint32 SpatialHashGrid::GetEntityCount() const
+{
+	return static_cast<uint32>(entries_.size());
+}
+
+uint32 SpatialHashGrid::GetCellCount() const
+{
+	return occupied_cell_count_;
+}
+
+uint32 SpatialHashGrid::GetGeneration() const
+{
+	return generation_;
+}
+
+void SpatialHashGrid::Attach(entt::registry& registry)
+{
+	registry_ = &registry;
+	registry.on_construct<Transform>().connect<&SpatialHashGrid::OnMembershipChanged>(*this);
+	registry.on_construct<Volume>().connect<&SpatialHashGrid::OnMembershipChanged>(*this);
+	registry.on_construct<DynamicVolume>().connect<&SpatialHashGrid::OnMembershipChanged>(*this);
+	registry.on_destroy<Transform>().connect<&SpatialHashGrid::OnMembershipChanged>(*this);
+	registry.on_destroy<Volume>().connect<&SpatialHashGrid::OnMembershipChanged>(*this);
+	registry.on_destroy<DynamicVolume>().connect<&SpatialHashGrid::OnMembershipChanged>(*this);
+	// Notified when the Transform hierarchy changes
+	registry.on_update<Transform>().connect<&SpatialHashGrid::OnMembershipChanged>(*this);
+	needs_rebuild_ = true;
+}
+
+void SpatialHashGrid::Detach()
+{
+	if (registry_ == nullptr)
+	{
+		return;
+	}
+	registry_->on_construct<Transform>().disconnect<&SpatialHashGrid::OnMembershipChanged>(*this);
+	registry_->on_construct<Volume>().disconnect<&SpatialHashGrid::OnMembershipChanged>(*this);
+	registry_->on_construct<DynamicVolume>().disconnect<&SpatialHashGrid::OnMembershipChanged>(*this);
+	registry_->on_destroy<Transform>().disconnect<&SpatialHashGrid::OnMembershipChanged>(*this);
+	registry_->on_destroy<Volume>().disconnect<&SpatialHashGrid::OnMembershipChanged>(*this);
+	registry_->on_destroy<DynamicVolume>().disconnect<&SpatialHashGrid::OnMembershipChanged>(*this);
+	registry_->on_update<Transform>().disconnect<&SpatialHashGrid::OnMembershipChanged>(*this);
+	registry_ = nullptr;
+}
+
+void SpatialHashGrid::OnMembershipChanged(entt::registry& /* registry */, Entity /* entity */)
+{
+	needs_rebuild_ = true;
+}
+
+void SpatialHashGrid::Rebuild(const entt::registry& registry)
+{
+	needs_rebuild_ = false;
+	++generation_;
+	entries_.clear();
+
+	auto dynamic_view = registry.view<const Transform, const Volume, const DynamicVolume>();
+	for (Entity entity : dynamic_view)
+	{
+		if (!CullingManager::IsHierarchyRoot(registry, entity))
+		{
+			continue;
+		}
+		const Volume& volume = dynamic_view.get<const Volume>(entity);
+		entries_.push_back(Entry{entity,
+		                         volume.version_,
+		                         volume.bounding_volume_,
+		                         CreateBox(volume.bounding_volume_),
+		                         kInvalidIndex,
+		                         kInvalidIndex,
+		                         kInvalidIndex});
+	}
+	RelinkEntries();
+}
+
+void SpatialHashGrid::RelinkEntries()
+{
+	cells_.clear();
+	refit_cells_.clear();
+	std::fill(cell_table_.begin(), cell_table_.end(), kInvalidIndex);
+	occupied_cell_count_ = 0;
+	for (uint32 entry_index = 0; entry_index < entries_.size(); ++entry_index)
+	{
+		LinkEntry(entry_index, FindOrCreateCell(GetCellKey(entries_[entry_index].sphere_.center_)));
+	}
+}
+
+SpatialHashGrid::CellKey SpatialHashGrid::GetCellKey(const math::Vec3f& position) const
+{
+	return CellKey{static_cast<int32>(std::floor(position.x_ * inverse_cell_size_)),
+	               static_cast<int32>(std::floor(position.y_ * inverse_cell_size_)),
+	               static_cast<int32>(std::floor(position.z_ * inverse_cell_size_))};
+}
+
+uint32 SpatialHashGrid::HashCellKey(const CellKey& key)
+{
+	return static_cast<uint32>(key.x_) * 73856093U
+	     ^ static_cast<uint32>(key.y_) * 19349663U
+	     ^ static_cast<uint32>(key.z_) * 83492791U;
+}
+
+uint32 SpatialHashGrid::FindOrCreateCell(const CellKey& key)
+{
+	// Keep the load factor at most one half
+	if ((cells_.size() + 1) * 2 > cell_table_.size())
+	{
+		GrowTable();
+	}
+
+	const auto mask = static_cast<uint32>(cell_table_.size() - 1);
+	uint32 slot = HashCellKey(key) & mask;
+	while (cell_table_[slot] != kInvalidIndex)
+	{
+		const CellKey& slot_key = cells_[cell_table_[slot]].key_;
+		if (slot_key.x_ == key.x_ && slot_key.y_ == key.y_ && slot_key.z_ == key.z_)
+		{
+			return cell_table_[slot];
+		}
+		slot = (slot + 1) & mask;
+	}
+
+	cell_table_[slot] = static_cast<uint32>(cells_.size());
+	cells_.push_back(Cell{key, math::Box(), kInvalidIndex, 0, false});
+	return cell_table_[slot];
+}
+
+void SpatialHashGrid::GrowTable()
+{
+	cell_table_.assign(std::max(kMinTableSize, static_cast<uint32>(cell_table_.size() * 2)), kInvalidIndex);
+	const auto mask = static_cast<uint32>(cell_table_.size() - 1);
+	for (uint32 cell_index = 0; cell_index < cells_.size(); ++cell_index)
+	{
+		uint32 slot = HashCellKey(cells_[cell_index].key_) & mask;
+		while (cell_table_[slot] != kInvalidIndex)
+		{
+			slot = (slot + 1) & mask;
+		}
+		cell_table_[slot] = cell_index;
+	}
+}
+
+void SpatialHashGrid::LinkEntry(uint32 entry_index, uint32 cell_index)
+{
+	Entry& entry = entries_[entry_index];
+	Cell& cell = cells_[cell_index];
+	entry.cell_ = cell_index;
+	entry.previous_entry_ = kInvalidIndex;
+	entry.next_entry_ = cell.first_entry_;
+	if (cell.first_entry_ != kInvalidIndex)
+	{
+		entries_[cell.first_entry_].previous_entry_ = entry_index;
+		cell.loose_box_.Merge(entry.box_);
+	}
+	else
+	{
+		cell.loose_box_ = entry.box_;
+		++occupied_cell_count_;
+	}
+	cell.first_entry_ = entry_index;
+	++cell.entry_count_;
+}
+
+void SpatialHashGrid::UnlinkEntry(uint32 entry_index)
+{
+	Entry& entry = entries_[entry_index];
+	Cell& cell = cells_[entry.cell_];
+	if (entry.previous_entry_ != kInvalidIndex)
+	{
+		entries_[entry.previous_entry_].next_entry_ = entry.next_entry_;
+	}
+	else
+	{
+		cell.first_entry_ = entry.next_entry_;
+	}
+	if (entry.next_entry_ != kInvalidIndex)
+	{
+		entries_[entry.next_entry_].previous_entry_ = entry.previous_entry_;
+	}
+
+	--cell.entry_count_;
+	if (cell.entry_count_ == 0)
+	{
+		--occupied_cell_count_;
+	}
+	else
+	{
+		MarkCellForRefit(entry.cell_);
+	}
+	entry.cell_ = kInvalidIndex;
+	entry.previous_entry_ = kInvalidIndex;
+	entry.next_entry_ = kInvalidIndex;
+}
+
+void SpatialHashGrid::MarkCellForRefit(uint32 cell_index)
+{
+	Cell& cell = cells_[cell_index];
+	if (!cell.needs_refit_)
+	{
+		cell.needs_refit_ = true;
+		refit_cells_.push_back(cell_index);
+	}
+}
+
+} // namespace zero::render
@@ -0,0 +1,51 @@
+#include "render/scene/SphereViewVolume.hpp"
+#include "math/Intersection.hpp"
+
+namespace zero::render
+{
+
+SphereViewVolume::SphereViewVolume(const math::Sphere& sphere)
+: sphere_(sphere)
+{
+}
+
+void SphereViewVolume::SetPadding(float padding)
+{
+    sphere_.radius_ += padding;
+}
+
+bool SphereViewVolume::IsCulled(const math::Vec3f& point) const
+{
+    return !sphere_.Contains(point);
+}
+
+bool SphereViewVolume::IsCulled(const math::Sphere& sphere) const
+{
+    return !sphere_.Intersects(sphere);
+}
+
+bool SphereViewVolume::IsCulled(const math::Sphere& sphere, uint8& /* plane_hint */) const
+{
+    return IsCulled(sphere);
+}
+
+bool SphereViewVolume::IsCulled(const math::Box& box) const
+{
+    return !math::Intersection::BoxSphereIntersect(box, sphere_);
+}
+
+IViewVolume::Containment SphereViewVolume::Classify(const math::Box& box) const
+{
+    if (sphere_.Contains(box))
+    {
+        return Containment::INSIDE;
+    }
+    return math::Intersection::BoxSphereIntersect(box, sphere_) ? Containment::INTERSECTS : Containment::OUTSIDE;
+}
+
+const zero::math::Sphere& SphereViewVolume::GetSphere() const
+{
+    return sphere_;
+}
+
+} // namespace zero::render
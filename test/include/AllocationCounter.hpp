@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Count the heap allocations made through the global operator new while tracking is enabled.
+ *
+ * The global operator new/delete replacements are only linked into the test executable.
+ */
+class AllocationCounter
+{
+public:
+    AllocationCounter() = delete;
+
+    /**
+     * @brief Reset the allocation count and start counting allocations
+     */
+    static void StartTracking();
+
+    /**
+     * @brief Stop counting allocations
+     */
+    static void StopTracking();
+
+    /**
+     * @brief Get the number of allocations made since tracking was last started
+     * @return the allocation count
+     */
+    [[nodiscard]] static uint64_t GetAllocationCount();
+
+}; // class AllocationCounter
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <memory>
+#include "engine/Engine.hpp"
+
+/**
+ * @brief Fixture that runs the engine headless (no window or GPU) on a representative scene
+ */
+class TestHeadlessEngine : public ::testing::Test
+{
+public:
+
+    void SetUp() override;
+
+    void TearDown() override;
+
+    /**
+     * @brief Tick the engine until any one-time allocations (e.g. caches, reusable buffers) have been made
+     */
+    void WarmUp();
+
+protected:
+    /**
+     * @brief Adjust the engine configuration before the engine is created
+     * @param engine_config the headless engine configuration
+     */
+    virtual void Configure(zero::EngineConfig& engine_config);
+
+    /**
+     * @brief The number of frames ticked before the frame loop is expected to be allocation free
+     */
+    static constexpr zero::uint32 kWarmUpFrameCount = 8;
+
+    std::unique_ptr<zero::Engine> engine_;
+
+}; // class TestHeadlessEngine
+
+/**
+ * @brief Fixture that runs the headless engine with a dedicated render thread
+ */
+class TestMultithreadedHeadlessEngine : public TestHeadlessEngine
+{
+protected:
+    void Configure(zero::EngineConfig& engine_config) override;
+
+}; // class TestMultithreadedHeadlessEngine
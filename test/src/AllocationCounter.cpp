@@ -0,0 +1,140 @@
+#include "AllocationCounter.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::atomic<bool> is_tracking{false};
+    std::atomic<uint64_t> allocation_count{0};
+
+    void* Allocate(std::size_t size)
+    {
+        if (is_tracking.load(std::memory_order_relaxed))
+        {
+            allocation_count.fetch_add(1, std::memory_order_relaxed);
+        }
+        return std::malloc(size == 0 ? 1 : size);
+    }
+
+    void* AllocateAligned(std::size_t size, std::size_t alignment)
+    {
+        if (is_tracking.load(std::memory_order_relaxed))
+        {
+            allocation_count.fetch_add(1, std::memory_order_relaxed);
+        }
+        // Aligned allocation requires the size to be a multiple of the alignment
+        size = ((size == 0 ? 1 : size) + alignment - 1) & ~(alignment - 1);
+#if defined(_WIN32)
+        return _aligned_malloc(size, alignment);
+#else
+        return std::aligned_alloc(alignment, size);
+#endif
+    }
+
+    void FreeAligned(void* pointer)
+    {
+#if defined(_WIN32)
+        _aligned_free(pointer);
+#else
+        std::free(pointer);
+#endif
+    }
+} // namespace
+
+void AllocationCounter::StartTracking()
+{
+    allocation_count = 0;
+    is_tracking = true;
+}
+
+void AllocationCounter::StopTracking()
+{
+    is_tracking = false;
+}
+
+uint64_t AllocationCounter::GetAllocationCount()
+{
+    return allocation_count;
+}
+
+// Global allocation function replacements
+void* operator new(std::size_t size)
+{
+    void* pointer = Allocate(size);
+    if (pointer == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    void* pointer = AllocateAligned(size, static_cast<std::size_t>(alignment));
+    if (pointer == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return operator new(size, alignment);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept
+{
+    FreeAligned(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept
+{
+    FreeAligned(pointer);
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept
+{
+    FreeAligned(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept
+{
+    FreeAligned(pointer);
+}
@@ -0,0 +1,155 @@
+#include "TestHeadlessEngine.hpp"
+#include "component/Camera.hpp"
+#include "core/TransformSystem.hpp"
+#include <filesystem>
+
+using namespace zero;
+
+namespace
+{
+    constexpr uint32 kWindowWidth = 800;
+    constexpr uint32 kWindowHeight = 600;
+
+    /**
+     * @brief Creates a representative scene and orbits the camera around it each frame
+     */
+    class SceneGameSystem : public GameSystem
+    {
+    public:
+        SceneGameSystem(EngineCore* engine_core, IEntityInstantiator* entity_instantiator)
+        : GameSystem(engine_core, entity_instantiator)
+        , camera_entity_(NullEntity)
+        {
+        }
+
+        ~SceneGameSystem() override = default;
+
+        void Initialize() override
+        {
+            entt::registry& registry = GetCore()->GetRegistry();
+
+            // Camera
+            camera_entity_ = registry.create();
+            Camera& camera = registry.emplace<Camera>(camera_entity_, Camera{Camera::ProjectionType::PERSPECTIVE});
+            camera.viewport_.width_ = kWindowWidth;
+            camera.viewport_.height_ = kWindowHeight;
+            camera.position_ = math::Vec3f(0.0F, 5.0F, 40.0F);
+            camera.near_clip_ = 1.0F;
+            camera.far_clip_ = 1000.0F;
+
+            // Sky dome
+            Entity sky_dome_entity = GetInstantiator()->InstantiateSkyDome(SkyDome{});
+            SkyDome& sky_dome = registry.get<SkyDome>(sky_dome_entity);
+            sky_dome.is_active_ = true;
+            sky_dome.SetShaders("sky_dome.vertex.glsl", "sky_dome.fragment.glsl");
+
+            // Grid of primitives with a mix of materials
+            constexpr int32 kGridSize = 8;
+            constexpr float kSpacing = 4.0F;
+            for (int32 x = 0; x < kGridSize; ++x)
+            {
+                for (int32 z = 0; z < kGridSize; ++z)
+                {
+                    PrimitiveInstance primitive = ((x + z) % 2 == 0) ? PrimitiveInstance{Torus{}} : PrimitiveInstance{Box{}};
+                    Entity entity = CreatePrimitive(primitive, (x % 3 == 0) ? "model_unmapped.fragment.glsl" : "model.fragment.glsl");
+                    registry.get<Material>(entity).two_sided_ = (z % 2 == 0);
+                    const math::Vec3f offset(static_cast<float>(x - kGridSize / 2) * kSpacing,
+                                             0.0F,
+                                             static_cast<float>(z - kGridSize / 2) * kSpacing);
+                    TransformSystem::Translate(registry, entity, offset);
+                }
+            }
+
+            // One light of each type
+            Light light{};
+            DirectionalLight directional_light{};
+            directional_light.direction_ = math::Vec3f(1.0F, -1.0F, 0.0F);
+            directional_light.casts_shadows_ = true;
+            light.Set(directional_light);
+            GetInstantiator()->InstantiateLight(light, NullEntity);
+
+            Entity point_light_entity = CreatePrimitive(PrimitiveInstance{Sphere{}}, "model_unlit.fragment.glsl");
+            light.Set(PointLight{});
+            GetInstantiator()->InstantiateLight(light, point_light_entity);
+            TransformSystem::Translate(registry, point_light_entity, math::Vec3f(0.0F, 8.0F, 0.0F));
+
+            Entity spot_light_entity = CreatePrimitive(PrimitiveInstance{Sphere{}}, "model_unlit.fragment.glsl");
+            SpotLight spot_light{};
+            spot_light.direction_ = math::Vec3f(0.0F, -1.0F, 0.0F);
+            spot_light.casts_shadows_ = true;
+            light.Set(spot_light);
+            GetInstantiator()->InstantiateLight(light, spot_light_entity);
+            TransformSystem::Translate(registry, spot_light_entity, math::Vec3f(4.0F, 8.0F, 0.0F));
+        }
+
+        void PreUpdate() override {}
+
+        void Update(const TimeDelta& /* time_delta */) override
+        {
+            // Orbit so the visible set and shadow casters change between frames
+            Camera& camera = GetCore()->GetRegistry().get<Camera>(camera_entity_);
+            camera.YawRelative(math::Radian::FromDegree(3.0F));
+        }
+
+        void PostUpdate() override {}
+        void ShutDown() override {}
+
+    private:
+        Entity CreatePrimitive(const PrimitiveInstance& primitive, const std::string& fragment_shader)
+        {
+            Entity entity = GetInstantiator()->InstantiatePrimitive(primitive);
+            Material& material = GetCore()->GetRegistry().get<Material>(entity);
+            Material::Shaders shaders{};
+            shaders.vertex_shader_ = "model.vertex.glsl";
+            shaders.fragment_shader_ = fragment_shader;
+            material.SetShaders(shaders);
+            material.visible_ = true;
+            return entity;
+        }
+
+        Entity camera_entity_;
+    }; // class SceneGameSystem
+
+} // namespace
+
+void TestHeadlessEngine::SetUp()
+{
+    // Assets are resolved relative to the working directory
+    std::filesystem::current_path(ZERO_TEST_WORKING_DIRECTORY);
+
+    EngineConfig engine_config{};
+    engine_config.render_system_config_.window_config_.window_flags_ = WindowFlags::HIDE;
+    engine_config.render_system_config_.window_config_.width_ = kWindowWidth;
+    engine_config.render_system_config_.window_config_.height_ = kWindowHeight;
+    engine_config.render_system_config_.window_config_.window_mode_ = WindowMode::WINDOWED;
+    engine_config.render_system_config_.window_config_.api_ = GraphicsAPI::NONE;
+    engine_config.render_system_config_.window_config_.refresh_rate_ = RefreshRate::IMMEDIATE;
+    Configure(engine_config);
+
+    engine_ = std::make_unique<Engine>(engine_config);
+    engine_->AddGameSystem<SceneGameSystem>();
+    engine_->Initialize();
+}
+
+void TestHeadlessEngine::TearDown()
+{
+    engine_->ShutDown();
+    engine_ = nullptr;
+}
+
+void TestHeadlessEngine::WarmUp()
+{
+    for (uint32 frame = 0; frame < kWarmUpFrameCount; ++frame)
+    {
+        engine_->Tick();
+    }
+}
+
+void TestHeadlessEngine::Configure(EngineConfig& /* engine_config */)
+{
+}
+
+void TestMultithreadedHeadlessEngine::Configure(EngineConfig& engine_config)
+{
+    engine_config.render_system_config_.multithreaded_rendering_ = true;
+}
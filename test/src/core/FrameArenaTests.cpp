@@ -0,0 +1,71 @@
+#include "core/FrameArena.hpp"
+#include <gtest/gtest.h>
+#include <cstdint>
+
+using namespace zero;
+
+TEST(TestFrameArena, AllocationsAreAligned)
+{
+    LinearArena arena{256};
+    static_cast<void>(arena.Allocate(1, 1));
+    void* memory = arena.Allocate(16, 64);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(memory) % 64, 0);
+    EXPECT_EQ(arena.GetAllocatedBytes(), 17);
+}
+
+TEST(TestFrameArena, OverflowIsMergedOnReset)
+{
+    LinearArena arena{64};
+    static_cast<void>(arena.Allocate(48, 8));
+    static_cast<void>(arena.Allocate(48, 8));
+    EXPECT_GT(arena.GetCapacity(), 64);
+
+    const std::size_t capacity = arena.GetCapacity();
+    arena.Reset();
+    EXPECT_EQ(arena.GetAllocatedBytes(), 0);
+    EXPECT_EQ(arena.GetCapacity(), capacity);
+
+    // The merged block fits the previous frame without overflowing
+    static_cast<void>(arena.Allocate(48, 8));
+    static_cast<void>(arena.Allocate(48, 8));
+    EXPECT_EQ(arena.GetCapacity(), capacity);
+}
+
+TEST(TestFrameArena, FrameAllocationsSurviveUntilBufferIsReused)
+{
+    FrameArena frame_arena{2, 128};
+    LinearArena* first_arena = frame_arena.GetArena();
+    static_cast<void>(first_arena->Allocate(32, 8));
+
+    frame_arena.NextFrame();
+    EXPECT_NE(frame_arena.GetArena(), first_arena);
+    EXPECT_EQ(first_arena->GetAllocatedBytes(), 32);
+
+    frame_arena.NextFrame();
+    EXPECT_EQ(frame_arena.GetArena(), first_arena);
+    EXPECT_EQ(first_arena->GetAllocatedBytes(), 0);
+}
+
+TEST(TestFrameArena, AllocatorAndDeleter)
+{
+    FrameArena frame_arena{1, 1024};
+    std::vector<uint32, ArenaAllocator<uint32>> values{frame_arena.GetAllocator<uint32>()};
+    for (uint32 i = 0; i < 16; ++i)
+    {
+        values.push_back(i);
+    }
+    EXPECT_EQ(values.size(), 16);
+    EXPECT_EQ(values[15], 15);
+
+    uint32 destroyed_count = 0;
+    struct Tracker
+    {
+        explicit Tracker(uint32* counter) : counter_(counter) {}
+        ~Tracker() { ++(*counter_); }
+        uint32* counter_;
+    };
+    {
+        ArenaPtr<Tracker> tracker = frame_arena.New<Tracker>(&destroyed_count);
+    }
+    EXPECT_EQ(destroyed_count, 1);
+}
@@ -0,0 +1,56 @@
+#include "core/ThreadPool.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace zero;
+
+TEST(TestThreadPool, ParallelFor_ExecutesEveryTaskOnce)
+{
+    ThreadPool thread_pool{3};
+    EXPECT_EQ(thread_pool.GetWorkerCount(), 3);
+
+    constexpr uint32 kTaskCount = 1000;
+    std::vector<std::atomic<uint32>> execution_counts(kTaskCount);
+    // Batches reuse the same workers
+    for (uint32 batch = 0; batch < 50; ++batch)
+    {
+        thread_pool.ParallelFor(kTaskCount, [&execution_counts](uint32 task_index) {
+            execution_counts[task_index].fetch_add(1, std::memory_order_relaxed);
+        });
+    }
+
+    for (const std::atomic<uint32>& execution_count : execution_counts)
+    {
+        EXPECT_EQ(execution_count.load(), 50);
+    }
+}
+
+TEST(TestThreadPool, ParallelFor_WaitsForAllTasks)
+{
+    ThreadPool thread_pool{4};
+    std::vector<uint32> results(64, 0);
+    thread_pool.ParallelFor(static_cast<uint32>(results.size()), [&results](uint32 task_index) {
+        std::this_thread::yield();
+        results[task_index] = task_index * 2;
+    });
+
+    for (uint32 i = 0; i < results.size(); ++i)
+    {
+        EXPECT_EQ(results[i], i * 2);
+    }
+}
+
+TEST(TestThreadPool, ParallelFor_WithoutWorkersRunsOnCallingThread)
+{
+    ThreadPool thread_pool{0};
+    const std::thread::id calling_thread = std::this_thread::get_id();
+    std::vector<uint32> task_order;
+    thread_pool.ParallelFor(8, [&](uint32 task_index) {
+        EXPECT_EQ(std::this_thread::get_id(), calling_thread);
+        task_order.push_back(task_index);
+    });
+
+    EXPECT_EQ(task_order, (std::vector<uint32>{0, 1, 2, 3, 4, 5, 6, 7}));
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include "component/Transform.hpp"
+#include "component/Volume.hpp"
+#include "core/TransformSystem.hpp"
+
+using namespace zero;
+
+namespace
+{
+
+Entity CreateEntity(entt::registry& registry, const math::Vec3f& position, float radius)
+{
+    Entity entity = registry.create();
+    registry.emplace<Transform>(entity);
+    registry.emplace<Volume>(entity, position, radius);
+    return entity;
+}
+
+} // namespace
+
+TEST(TestTransformSystem, AddChild_EngulfsChildVolume)
+{
+    entt::registry registry{};
+    Entity root = CreateEntity(registry, math::Vec3f::Zero(), 1.0F);
+    Entity parent = CreateEntity(registry, math::Vec3f::Zero(), 1.0F);
+    Entity child = CreateEntity(registry, math::Vec3f(10.0F, 0.0F, 0.0F), 1.0F);
+    ASSERT_TRUE(TransformSystem::AddChild(registry, root, parent));
+    ASSERT_TRUE(TransformSystem::AddChild(registry, parent, child));
+
+    const math::Sphere& child_volume = registry.get<Volume>(child).bounding_volume_;
+    EXPECT_TRUE(registry.get<Volume>(parent).bounding_volume_.Contains(child_volume));
+    EXPECT_TRUE(registry.get<Volume>(root).bounding_volume_.Contains(child_volume));
+}
+
+TEST(TestTransformSystem, Translate_EngulfsMovedChildVolume)
+{
+    entt::registry registry{};
+    Entity root = CreateEntity(registry, math::Vec3f::Zero(), 2.0F);
+    Entity parent = CreateEntity(registry, math::Vec3f::Zero(), 2.0F);
+    Entity child = CreateEntity(registry, math::Vec3f::Zero(), 1.0F);
+    ASSERT_TRUE(TransformSystem::AddChild(registry, root, parent));
+    ASSERT_TRUE(TransformSystem::AddChild(registry, parent, child));
+    const uint32 root_version = registry.get<Volume>(root).version_;
+
+    // Moving within the parent volume leaves the ancestors untouched
+    TransformSystem::Translate(registry, child, math::Vec3f(0.5F, 0.0F, 0.0F));
+    EXPECT_EQ(registry.get<Volume>(root).version_, root_version);
+
+    TransformSystem::Translate(registry, child, math::Vec3f(0.0F, 25.0F, 0.0F));
+    const math::Sphere& child_volume = registry.get<Volume>(child).bounding_volume_;
+    EXPECT_TRUE(registry.get<Volume>(parent).bounding_volume_.Contains(child_volume));
+    EXPECT_TRUE(registry.get<Volume>(root).bounding_volume_.Contains(child_volume));
+    EXPECT_NE(registry.get<Volume>(root).version_, root_version);
+}
+
+TEST(TestTransformSystem, Translate_ShrinksVolumeWhenChildMovesBack)
+{
+    entt::registry registry{};
+    Entity root = CreateEntity(registry, math::Vec3f::Zero(), 2.0F);
+    Entity parent = CreateEntity(registry, math::Vec3f::Zero(), 2.0F);
+    Entity child = CreateEntity(registry, math::Vec3f::Zero(), 1.0F);
+    ASSERT_TRUE(TransformSystem::AddChild(registry, root, parent));
+    ASSERT_TRUE(TransformSystem::AddChild(registry, parent, child));
+    const math::Sphere root_volume = registry.get<Volume>(root).bounding_volume_;
+
+    TransformSystem::Translate(registry, child, math::Vec3f(100.0F, 0.0F, 0.0F));
+    EXPECT_GT(registry.get<Volume>(root).bounding_volume_.radius_, 50.0F);
+
+    // The ancestors are refit to the current child volume instead of every position it has occupied
+    TransformSystem::Translate(registry, child, math::Vec3f(-100.0F, 0.0F, 0.0F));
+    EXPECT_EQ(registry.get<Volume>(parent).bounding_volume_, registry.get<Volume>(parent).mesh_volume_);
+    EXPECT_EQ(registry.get<Volume>(root).bounding_volume_, root_volume);
+}
+
+TEST(TestTransformSystem, RemoveChild_ShrinksParentVolume)
+{
+    entt::registry registry{};
+    Entity parent = CreateEntity(registry, math::Vec3f::Zero(), 1.0F);
+    Entity child = CreateEntity(registry, math::Vec3f(10.0F, 0.0F, 0.0F), 1.0F);
+    ASSERT_TRUE(TransformSystem::AddChild(registry, parent, child));
+    EXPECT_TRUE(registry.get<Volume>(parent).bounding_volume_.Contains(registry.get<Volume>(child).bounding_volume_));
+
+    TransformSystem::RemoveChild(registry, parent, child);
+    EXPECT_EQ(registry.get<Volume>(parent).bounding_volume_, math::Sphere(math::Vec3f::Zero(), 1.0F));
+}
@@ -0,0 +1,42 @@
+#include "AllocationCounter.hpp"
+#include "TestHeadlessEngine.hpp"
+
+using namespace zero;
+
+TEST_F(TestHeadlessEngine, SteadyStateFrameDoesNotAllocate)
+{
+    WarmUp();
+
+    constexpr uint32 kFrameCount = 120;
+    for (uint32 frame = 0; frame < kFrameCount; ++frame)
+    {
+        AllocationCounter::StartTracking();
+        engine_->Tick();
+        AllocationCounter::StopTracking();
+        ASSERT_EQ(AllocationCounter::GetAllocationCount(), 0) << "Heap allocation in steady state frame " << frame;
+    }
+}
+
+TEST_F(TestMultithreadedHeadlessEngine, SteadyStateFrameDoesNotAllocate)
+{
+    WarmUp();
+
+    // Frames render on the render thread while the next frames are simulated, so track across all of them
+    constexpr uint32 kFrameCount = 120;
+    AllocationCounter::StartTracking();
+    for (uint32 frame = 0; frame < kFrameCount; ++frame)
+    {
+        engine_->Tick();
+    }
+    AllocationCounter::StopTracking();
+    ASSERT_EQ(AllocationCounter::GetAllocationCount(), 0) << "Heap allocation in steady state frames";
+}
+
+TEST(TestAllocationCounter, CountsAllocations)
+{
+    AllocationCounter::StartTracking();
+    void* memory = ::operator new(sizeof(uint32));
+    AllocationCounter::StopTracking();
+    ::operator delete(memory);
+    EXPECT_EQ(AllocationCounter::GetAllocationCount(), 1);
+}
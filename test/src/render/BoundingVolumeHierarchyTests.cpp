@@ -0,0 +1,211 @@
+#include "render/scene/BoundingVolumeHierarchy.hpp"
+#include "render/scene/OrthographicViewVolume.hpp"
+#include "render/scene/ViewVolumeBuilder.hpp"
+#include "component/Camera.hpp"
+#include "component/Material.hpp"
+#include "component/Mesh.hpp"
+#include "component/Transform.hpp"
+#include "component/Volume.hpp"
+#include "core/TransformSystem.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+
+using namespace zero;
+using namespace zero::render;
+
+class TestBoundingVolumeHierarchy : public ::testing::Test
+{
+protected:
+    static constexpr uint32 kEntityCount = 2000;
+
+    TestBoundingVolumeHierarchy()
+    : registry_()
+    , bounding_volume_hierarchy_()
+    , camera_(Camera::ProjectionType::PERSPECTIVE)
+    {
+    }
+
+    void SetUp() override
+    {
+        std::mt19937 generator(1234);
+        std::uniform_real_distribution<float> position_distribution(-500.0F, 500.0F);
+        std::uniform_real_distribution<float> radius_distribution(0.5F, 10.0F);
+        for (uint32 i = 0; i < kEntityCount; ++i)
+        {
+            const math::Vec3f position(position_distribution(generator),
+                                       position_distribution(generator),
+                                       position_distribution(generator));
+            CreateRenderable(position, radius_distribution(generator));
+        }
+    }
+
+    Entity CreateRenderable(const math::Vec3f& position, float radius)
+    {
+        Entity entity = registry_.create();
+        registry_.emplace<Transform>(entity);
+        registry_.emplace<Material>(entity);
+        registry_.emplace<Mesh>(entity);
+        registry_.emplace<Volume>(entity, position, radius);
+        return entity;
+    }
+
+    std::vector<Entity> Query(const IViewVolume& view_volume) const
+    {
+        std::vector<Entity> entities;
+        bounding_volume_hierarchy_.Query(view_volume, registry_, entities);
+        std::sort(entities.begin(), entities.end());
+        return entities;
+    }
+
+    std::vector<Entity> QueryLinear(const IViewVolume& view_volume) const
+    {
+        std::vector<Entity> entities;
+        auto renderable_view = registry_.view<const Transform, const Volume, const Material, const Mesh>();
+        for (Entity entity : renderable_view)
+        {
+            if (renderable_view.get<const Material>(entity).visible_
+                && !view_volume.IsCulled(renderable_view.get<const Volume>(entity).bounding_volume_))
+            {
+                entities.push_back(entity);
+            }
+        }
+        std::sort(entities.begin(), entities.end());
+        return entities;
+    }
+
+    entt::registry registry_;
+    BoundingVolumeHierarchy bounding_volume_hierarchy_;
+    Camera camera_;
+};
+
+TEST_F(TestBoundingVolumeHierarchy, Build)
+{
+    bounding_volume_hierarchy_.Update(registry_);
+    EXPECT_EQ(bounding_volume_hierarchy_.GetEntityCount(), kEntityCount);
+    EXPECT_GT(bounding_volume_hierarchy_.GetNodeCount(), 1);
+    EXPECT_LT(bounding_volume_hierarchy_.GetNodeCount(), kEntityCount * 2);
+}
+
+TEST_F(TestBoundingVolumeHierarchy, Query_MatchesLinearScan)
+{
+    bounding_volume_hierarchy_.Update(registry_);
+
+    camera_.far_clip_ = 300.0F;
+    const PerspectiveViewVolume perspective_volume = ViewVolumeBuilder::CreatePerspective(camera_);
+    const std::vector<Entity> perspective_entities = Query(perspective_volume);
+    EXPECT_FALSE(perspective_entities.empty());
+    EXPECT_EQ(perspective_entities, QueryLinear(perspective_volume));
+
+    const OrthographicViewVolume orthographic_volume{math::Vec3f(-100.0F), math::Vec3f(150.0F)};
+    const std::vector<Entity> orthographic_entities = Query(orthographic_volume);
+    EXPECT_FALSE(orthographic_entities.empty());
+    EXPECT_EQ(orthographic_entities, QueryLinear(orthographic_volume));
+}
+
+TEST_F(TestBoundingVolumeHierarchy, Query_SkipsInvisibleEntities)
+{
+    const OrthographicViewVolume view_volume{math::Vec3f(-1000.0F), math::Vec3f(1000.0F)};
+    auto material_view = registry_.view<Material>();
+    material_view.get<Material>(material_view.front()).visible_ = false;
+
+    bounding_volume_hierarchy_.Update(registry_);
+    EXPECT_EQ(Query(view_volume).size(), kEntityCount - 1);
+}
+
+TEST_F(TestBoundingVolumeHierarchy, Update_RefitsMovedVolumes)
+{
+    const OrthographicViewVolume view_volume{math::Vec3f(2000.0F), math::Vec3f(2100.0F)};
+    bounding_volume_hierarchy_.Update(registry_);
+    EXPECT_TRUE(Query(view_volume).empty());
+
+    // Move a few entities into the view volume
+    std::vector<Entity> moved_entities;
+    auto volume_view = registry_.view<Volume>();
+    for (Entity entity : volume_view)
+    {
+        Volume& volume = volume_view.get<Volume>(entity);
+        volume.Translate(math::Vec3f(2050.0F) - volume.bounding_volume_.center_);
+        moved_entities.push_back(entity);
+        if (moved_entities.size() == 10)
+        {
+            break;
+        }
+    }
+    std::sort(moved_entities.begin(), moved_entities.end());
+
+    bounding_volume_hierarchy_.Update(registry_);
+    EXPECT_EQ(Query(view_volume), moved_entities);
+    EXPECT_EQ(Query(view_volume), QueryLinear(view_volume));
+
+    // Move every entity so that the hierarchy is rebuilt
+    for (Entity entity : volume_view)
+    {
+        volume_view.get<Volume>(entity).Translate(math::Vec3f(10.0F));
+    }
+    bounding_volume_hierarchy_.Update(registry_);
+    for (Entity entity : volume_view)
+    {
+        volume_view.get<Volume>(entity).Translate(math::Vec3f(-10.0F));
+    }
+    bounding_volume_hierarchy_.Update(registry_);
+    EXPECT_EQ(Query(view_volume), moved_entities);
+}
+
+TEST_F(TestBoundingVolumeHierarchy, Update_TracksAddedAndRemovedEntities)
+{
+    const OrthographicViewVolume view_volume{math::Vec3f(2000.0F), math::Vec3f(2100.0F)};
+    bounding_volume_hierarchy_.Update(registry_);
+
+    Entity added_entity = CreateRenderable(math::Vec3f(2050.0F), 1.0F);
+    bounding_volume_hierarchy_.Update(registry_);
+    EXPECT_EQ(bounding_volume_hierarchy_.GetEntityCount(), kEntityCount + 1);
+    EXPECT_EQ(Query(view_volume), std::vector<Entity>{added_entity});
+
+    // Entities without a Mesh are still part of the hierarchy, but are not renderable
+    registry_.remove<Mesh>(added_entity);
+    bounding_volume_hierarchy_.Update(registry_);
+    EXPECT_EQ(bounding_volume_hierarchy_.GetEntityCount(), kEntityCount + 1);
+    EXPECT_TRUE(Query(view_volume).empty());
+
+    registry_.remove<Volume>(added_entity);
+    bounding_volume_hierarchy_.Update(registry_);
+    EXPECT_EQ(bounding_volume_hierarchy_.GetEntityCount(), kEntityCount);
+
+    registry_.destroy(added_entity);
+    auto volume_view = registry_.view<Volume>();
+    registry_.destroy(volume_view.front());
+    bounding_volume_hierarchy_.Update(registry_);
+    EXPECT_EQ(bounding_volume_hierarchy_.GetEntityCount(), kEntityCount - 1);
+}
+
+TEST_F(TestBoundingVolumeHierarchy, Query_CullsTransformHierarchies)
+{
+    // A model whose parent volume engulfs its parts
+    const Entity model = CreateRenderable(math::Vec3f(2050.0F), 20.0F);
+    std::vector<Entity> parts{};
+    for (uint32 i = 0; i < 8; ++i)
+    {
+        parts.push_back(CreateRenderable(math::Vec3f(2050.0F + static_cast<float>(i), 2050.0F, 2050.0F), 1.0F));
+        ASSERT_TRUE(TransformSystem::AddChild(registry_, model, parts.back()));
+    }
+    bounding_volume_hierarchy_.Update(registry_);
+    EXPECT_EQ(bounding_volume_hierarchy_.GetEntityCount(), kEntityCount + 1);
+
+    // Only the parts that overlap the view volume are culled individually
+    const OrthographicViewVolume partial_volume{math::Vec3f(2045.0F), math::Vec3f(2052.5F)};
+    std::vector<Entity> expected_entities{model, parts[0], parts[1], parts[2], parts[3]};
+    std::sort(expected_entities.begin(), expected_entities.end());
+    EXPECT_EQ(Query(partial_volume), expected_entities);
+
+    const OrthographicViewVolume enclosing_volume{math::Vec3f(2000.0F), math::Vec3f(2100.0F)};
+    EXPECT_EQ(Query(enclosing_volume).size(), parts.size() + 1);
+
+    // Moving a part out of the model grows the volume of the model
+    TransformSystem::Translate(registry_, parts[0], math::Vec3f(0.0F, 200.0F, 0.0F));
+    bounding_volume_hierarchy_.Update(registry_);
+    const OrthographicViewVolume moved_part_volume{math::Vec3f(2045.0F, 2245.0F, 2045.0F), math::Vec3f(2055.0F, 2255.0F, 2055.0F)};
+    expected_entities = {model, parts[0]};
+    std::sort(expected_entities.begin(), expected_entities.end());
+    EXPECT_EQ(Query(moved_part_volume), expected_entities);
+}
@@ -0,0 +1,166 @@
+#include "render/renderer/CommandBuffer.hpp"
+#include "render/renderer/UniformBufferData.hpp"
+#include "render/renderer/null/NullRenderHardware.hpp"
+#include "render/renderer/null/NullResources.hpp"
+#include "core/ThreadPool.hpp"
+#include <array>
+#include <gtest/gtest.h>
+
+using namespace zero;
+using namespace zero::render;
+
+namespace
+{
+
+class CountingDrawCall final : public IDrawCall
+{
+public:
+    explicit CountingDrawCall(uint32* draw_count)
+    : draw_count_(draw_count)
+    {
+    }
+
+    [[nodiscard]] uint64 GetSortKey() const override
+    {
+        return 0;
+    }
+
+    void Draw(IRenderHardware* /* rhi */) override
+    {
+        ++(*draw_count_);
+    }
+
+private:
+    uint32* draw_count_;
+};
+
+} // namespace
+
+class TestCommandBuffer : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        std::vector<std::shared_ptr<IShader>> shaders{rhi_.CreateShader(ShaderStage{})};
+        program_ = rhi_.CreateShaderProgram(shaders);
+    }
+
+    void Record(CommandBuffer& command_buffer) const
+    {
+        command_buffer.BeginFrame(nullptr);
+        command_buffer.SetViewport(0, 0, 800, 600);
+        command_buffer.Clear();
+        command_buffer.BindShaderProgram(program_);
+        const CameraData camera_data{math::Matrix4x4::Identity(), math::Matrix4x4::Identity(), math::Vec3f::Zero()};
+        command_buffer.WriteUniform(UniformBlock::CAMERA, &camera_data, sizeof(camera_data));
+        command_buffer.BindUniform(UniformBlock::CAMERA);
+        command_buffer.DrawMesh(mesh_);
+        command_buffer.EndFrame();
+    }
+
+    void Submit(const CommandBuffer& command_buffer)
+    {
+        rhi_.BeginUniformFrame();
+        command_buffer.Submit(&rhi_, uniform_manager_);
+        rhi_.EndUniformFrame();
+    }
+
+    NullRenderHardware rhi_;
+    UniformManager uniform_manager_;
+    std::shared_ptr<IProgram> program_;
+    std::shared_ptr<IMesh> mesh_ = std::make_shared<NullMesh>(36);
+};
+
+TEST_F(TestCommandBuffer, RecordingDoesNotCallRenderHardware)
+{
+    CommandBuffer command_buffer;
+    EXPECT_TRUE(command_buffer.IsEmpty());
+
+    Record(command_buffer);
+    EXPECT_FALSE(command_buffer.IsEmpty());
+    EXPECT_EQ(command_buffer.GetCommandCount(), 8);
+
+    const NullRenderHardware::Statistics& statistics = rhi_.GetStatistics();
+    EXPECT_EQ(statistics.frame_count_, 0);
+    EXPECT_EQ(statistics.program_bind_count_, 0);
+    EXPECT_EQ(statistics.uniform_write_count_, 0);
+    EXPECT_EQ(statistics.draw_count_, 0);
+}
+
+TEST_F(TestCommandBuffer, SubmitExecutesCommands)
+{
+    CommandBuffer command_buffer;
+    Record(command_buffer);
+    Submit(command_buffer);
+
+    const NullRenderHardware::Statistics& statistics = rhi_.GetStatistics();
+    EXPECT_EQ(statistics.frame_count_, 1);
+    EXPECT_EQ(statistics.program_bind_count_, 1);
+    EXPECT_EQ(statistics.uniform_write_count_, 1);
+    EXPECT_EQ(statistics.uniform_write_bytes_, sizeof(CameraData));
+    EXPECT_EQ(statistics.uniform_buffer_bind_count_, 1);
+    EXPECT_EQ(statistics.draw_count_, 1);
+
+    // A buffer can be submitted again until it is reset
+    Submit(command_buffer);
+    EXPECT_EQ(statistics.frame_count_, 2);
+    EXPECT_EQ(statistics.draw_count_, 2);
+}
+
+TEST_F(TestCommandBuffer, WriteUniformCopiesData)
+{
+    CommandBuffer command_buffer;
+    command_buffer.BindUniform(UniformBlock::CAMERA);
+    const uint32 bind_size = command_buffer.GetSize();
+
+    // The data of the write is stored in the buffer, so it may go out of scope before submission
+    {
+        const CameraData camera_data{math::Matrix4x4::Identity(), math::Matrix4x4::Identity(), math::Vec3f::Zero()};
+        command_buffer.WriteUniform(UniformBlock::CAMERA, &camera_data, sizeof(camera_data));
+    }
+    EXPECT_GT(command_buffer.GetSize() - bind_size, sizeof(CameraData));
+    EXPECT_EQ(command_buffer.GetCommandCount(), 2);
+}
+
+TEST_F(TestCommandBuffer, ExecuteDrawCallOnSubmit)
+{
+    uint32 draw_count = 0;
+    CountingDrawCall draw_call(&draw_count);
+
+    CommandBuffer command_buffer;
+    command_buffer.ExecuteDrawCall(&draw_call);
+    EXPECT_EQ(draw_count, 0);
+
+    Submit(command_buffer);
+    EXPECT_EQ(draw_count, 1);
+}
+
+TEST_F(TestCommandBuffer, ResetRemovesCommands)
+{
+    CommandBuffer command_buffer;
+    Record(command_buffer);
+    command_buffer.Reset();
+    EXPECT_TRUE(command_buffer.IsEmpty());
+    EXPECT_EQ(command_buffer.GetSize(), 0);
+
+    Submit(command_buffer);
+    EXPECT_EQ(rhi_.GetStatistics().draw_count_, 0);
+}
+
+TEST_F(TestCommandBuffer, RecordConcurrently)
+{
+    constexpr uint32 kBufferCount = 8;
+    std::array<CommandBuffer, kBufferCount> command_buffers;
+    ThreadPool thread_pool(3);
+    thread_pool.ParallelFor(kBufferCount, [this, &command_buffers](uint32 buffer_index)
+    {
+        Record(command_buffers[buffer_index]);
+    });
+
+    for (const CommandBuffer& command_buffer : command_buffers)
+    {
+        Submit(command_buffer);
+    }
+    EXPECT_EQ(rhi_.GetStatistics().frame_count_, kBufferCount);
+    EXPECT_EQ(rhi_.GetStatistics().draw_count_, kBufferCount);
+}
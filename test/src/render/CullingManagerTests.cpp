@@ -0,0 +1,311 @@
+#include "render/scene/CullingManager.hpp"
+#include "render/scene/OrthographicViewVolume.hpp"
+#include "render/scene/ViewVolumeBuilder.hpp"
+#include "render/Constants.hpp"
+#include "component/Camera.hpp"
+#include "component/Light.hpp"
+#include "component/Material.hpp"
+#include "component/Mesh.hpp"
+#include "component/Transform.hpp"
+#include "component/Volume.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <random>
+
+using namespace zero;
+using namespace zero::render;
+
+namespace
+{
+
+/**
+ * @brief Counts the spheres tested through the plane hint overload
+ */
+class CountingViewVolume : public IViewVolume
+{
+public:
+    explicit CountingViewVolume(const IViewVolume& view_volume)
+    : view_volume_(view_volume)
+    , sphere_test_count_(0)
+    {
+    }
+
+    bool IsCulled(const math::Vec3f& point) const override { return view_volume_.IsCulled(point); }
+    bool IsCulled(const math::Sphere& sphere) const override { return view_volume_.IsCulled(sphere); }
+    bool IsCulled(const math::Sphere& sphere, uint8& plane_hint) const override
+    {
+        sphere_test_count_.fetch_add(1, std::memory_order_relaxed);
+        return view_volume_.IsCulled(sphere, plane_hint);
+    }
+    bool IsCulled(const math::Box& box) const override { return view_volume_.IsCulled(box); }
+    Containment Classify(const math::Box& box) const override { return view_volume_.Classify(box); }
+    void SetPadding(float /* padding */) override {}
+
+    uint32 TakeSphereTestCount() const { return sphere_test_count_.exchange(0); }
+
+private:
+    const IViewVolume& view_volume_;
+    mutable std::atomic<uint32> sphere_test_count_;
+};
+
+} // namespace
+
+TEST(TestCullingManager, CullParallel_MatchesSerialQueries)
+{
+    entt::registry registry;
+    std::mt19937 generator(2468);
+    std::uniform_real_distribution<float> position_distribution(-400.0F, 400.0F);
+    std::uniform_real_distribution<float> radius_distribution(0.5F, 10.0F);
+    for (uint32 i = 0; i < 4000; ++i)
+    {
+        Entity entity = registry.create();
+        registry.emplace<Transform>(entity);
+        registry.emplace<Material>(entity);
+        registry.emplace<Mesh>(entity);
+        registry.emplace<Volume>(entity,
+                                 math::Vec3f(position_distribution(generator), position_distribution(generator), position_distribution(generator)),
+                                 radius_distribution(generator));
+        if (i % 3 == 0)
+        {
+            registry.emplace<DynamicVolume>(entity);
+        }
+    }
+
+    BoundingVolumeHierarchy bounding_volume_hierarchy{};
+    SpatialHashGrid spatial_hash_grid{};
+    bounding_volume_hierarchy.Update(registry);
+    spatial_hash_grid.Update(registry);
+    EXPECT_GT(bounding_volume_hierarchy.GetChunkCount(), 1);
+    EXPECT_GT(spatial_hash_grid.GetChunkCount(), 1);
+
+    Camera camera{Camera::ProjectionType::PERSPECTIVE};
+    camera.far_clip_ = 300.0F;
+    const PerspectiveViewVolume camera_volume = ViewVolumeBuilder::CreatePerspective(camera);
+    const OrthographicViewVolume near_volume{math::Vec3f(-50.0F), math::Vec3f(50.0F)};
+    const OrthographicViewVolume far_volume{math::Vec3f(-300.0F), math::Vec3f(200.0F)};
+    const std::vector<const IViewVolume*> view_volumes{&camera_volume, &near_volume, &far_volume};
+
+    std::vector<std::vector<Entity>> expected_entities(view_volumes.size());
+    for (uint32 i = 0; i < view_volumes.size(); ++i)
+    {
+        bounding_volume_hierarchy.Query(*view_volumes[i], registry, expected_entities[i]);
+        spatial_hash_grid.Query(*view_volumes[i], registry, expected_entities[i]);
+        EXPECT_FALSE(expected_entities[i].empty());
+    }
+
+    // The merged results are in the same order as the serial queries, regardless of the scheduling
+    ThreadPool thread_pool{3};
+    std::vector<std::vector<Entity>> chunk_entities;
+    std::vector<std::vector<Entity>> entities(view_volumes.size());
+    for (uint32 repetition = 0; repetition < 10; ++repetition)
+    {
+        CullingManager::CullParallel(thread_pool, view_volumes, bounding_volume_hierarchy, spatial_hash_grid, registry, {}, chunk_entities, entities);
+        EXPECT_EQ(entities, expected_entities);
+    }
+}
+
+TEST(TestCullingManager, CullParallel_WithHistories_MatchesSerialQueries)
+{
+    entt::registry registry;
+    std::mt19937 generator(1357);
+    std::uniform_real_distribution<float> position_distribution(-400.0F, 400.0F);
+    std::vector<Entity> dynamic_entities;
+    for (uint32 i = 0; i < 3000; ++i)
+    {
+        Entity entity = registry.create();
+        registry.emplace<Transform>(entity);
+        registry.emplace<Material>(entity);
+        registry.emplace<Mesh>(entity);
+        registry.emplace<Volume>(entity,
+                                 math::Vec3f(position_distribution(generator), position_distribution(generator), position_distribution(generator)),
+                                 2.0F);
+        if (i % 3 == 0)
+        {
+            registry.emplace<DynamicVolume>(entity);
+            dynamic_entities.push_back(entity);
+        }
+    }
+
+    BoundingVolumeHierarchy bounding_volume_hierarchy{};
+    SpatialHashGrid spatial_hash_grid{};
+    Camera camera{Camera::ProjectionType::PERSPECTIVE};
+    camera.far_clip_ = 300.0F;
+    const PerspectiveViewVolume camera_volume = ViewVolumeBuilder::CreatePerspective(camera);
+    const OrthographicViewVolume box_volume{math::Vec3f(-150.0F), math::Vec3f(100.0F)};
+    const CountingViewVolume counting_camera_volume{camera_volume};
+    const CountingViewVolume counting_box_volume{box_volume};
+    const std::vector<const IViewVolume*> view_volumes{&counting_camera_volume, &counting_box_volume};
+
+    ThreadPool thread_pool{3};
+    std::vector<CullingHistory> culling_histories(view_volumes.size());
+    std::vector<std::vector<Entity>> chunk_entities;
+    std::vector<std::vector<Entity>> entities(view_volumes.size());
+    std::vector<std::vector<Entity>> expected_entities(view_volumes.size());
+    const auto cull_frame = [&]()
+    {
+        bounding_volume_hierarchy.Update(registry);
+        spatial_hash_grid.Update(registry);
+        for (uint32 i = 0; i < view_volumes.size(); ++i)
+        {
+            // The first frame has no previous view, so the flag is ignored
+            culling_histories[i].BeginFrame(bounding_volume_hierarchy, spatial_hash_grid, true);
+            expected_entities[i].clear();
+            bounding_volume_hierarchy.Query(*view_volumes[i], registry, expected_entities[i]);
+            spatial_hash_grid.Query(*view_volumes[i], registry, expected_entities[i]);
+        }
+        counting_camera_volume.TakeSphereTestCount();
+        counting_box_volume.TakeSphereTestCount();
+        CullingManager::CullParallel(thread_pool, view_volumes, bounding_volume_hierarchy, spatial_hash_grid, registry, culling_histories, chunk_entities, entities);
+        EXPECT_EQ(entities, expected_entities);
+    };
+
+    cull_frame();
+    EXPECT_GT(counting_camera_volume.TakeSphereTestCount(), 0);
+
+    // Nothing changed, so every root reuses its result
+    cull_frame();
+    EXPECT_EQ(counting_camera_volume.TakeSphereTestCount(), 0);
+    EXPECT_EQ(counting_box_volume.TakeSphereTestCount(), 0);
+
+    // Only the moved roots are tested again
+    for (uint32 i = 0; i < 20; ++i)
+    {
+        registry.get<Volume>(dynamic_entities[i]).Translate(math::Vec3f(5.0F, -5.0F, 5.0F));
+    }
+    cull_frame();
+    EXPECT_LE(counting_camera_volume.TakeSphereTestCount(), 20);
+    EXPECT_LE(counting_box_volume.TakeSphereTestCount(), 20);
+
+    // A rebuilt hierarchy discards the history
+    const Entity entity = registry.create();
+    registry.emplace<Transform>(entity);
+    registry.emplace<Material>(entity);
+    registry.emplace<Mesh>(entity);
+    registry.emplace<Volume>(entity, math::Vec3f(0.0F, 0.0F, -10.0F), 1.0F);
+    cull_frame();
+
+    // A changed view tests every root again
+    for (CullingHistory& culling_history : culling_histories)
+    {
+        culling_history.BeginFrame(bounding_volume_hierarchy, spatial_hash_grid, false);
+    }
+    CullingManager::CullParallel(thread_pool, view_volumes, bounding_volume_hierarchy, spatial_hash_grid, registry, culling_histories, chunk_entities, entities);
+    EXPECT_EQ(entities, expected_entities);
+    EXPECT_GT(counting_camera_volume.TakeSphereTestCount(), 0);
+}
+
+TEST(TestCullingManager, GetShadowCascadeMasks)
+{
+    entt::registry registry;
+    const auto create_entity = [&registry](const math::Vec3f& position, bool casts_shadows) {
+        Entity entity = registry.create();
+        registry.emplace<Transform>(entity);
+        registry.emplace<Material>(entity).casts_shadows_ = casts_shadows;
+        registry.emplace<Mesh>(entity);
+        registry.emplace<Volume>(entity, position, 1.0F);
+        return entity;
+    };
+    const std::vector<Entity> entities{
+        create_entity(math::Vec3f(5.0F), true),
+        create_entity(math::Vec3f(15.0F), true),
+        create_entity(math::Vec3f(25.0F), true),
+        create_entity(math::Vec3f(10.0F), true),
+        create_entity(math::Vec3f(5.0F), false),
+    };
+    const std::vector<math::Box> cascade_boxes{
+        math::Box(math::Vec3f(0.0F), math::Vec3f(10.0F)),
+        math::Box(math::Vec3f(0.0F), math::Vec3f(20.0F)),
+        math::Box(math::Vec3f(20.0F), math::Vec3f(30.0F)),
+    };
+
+    std::vector<uint8> cascade_masks;
+    const std::vector<float> no_min_radii(cascade_boxes.size(), 0.0F);
+    EXPECT_EQ(CullingManager::GetShadowCascadeMasks(cascade_boxes, no_min_radii, registry, entities, cascade_masks), 0);
+    EXPECT_EQ(cascade_masks, (std::vector<uint8>{0b011, 0b010, 0b100, 0b011, 0b000}));
+
+    // The second cascade is too coarse for the casters
+    const std::vector<float> min_radii{0.0F, 2.0F, 0.5F};
+    EXPECT_EQ(CullingManager::GetShadowCascadeMasks(cascade_boxes, min_radii, registry, entities, cascade_masks), 3);
+    EXPECT_EQ(cascade_masks, (std::vector<uint8>{0b001, 0b000, 0b100, 0b001, 0b000}));
+}
+
+TEST(TestCullingManager, CullSmallEntities)
+{
+    entt::registry registry;
+    const auto create_entity = [&registry](const math::Vec3f& position, float radius) {
+        Entity entity = registry.create();
+        registry.emplace<Transform>(entity);
+        registry.emplace<Volume>(entity, position, radius);
+        return entity;
+    };
+
+    // The camera looks down -Z with a 90 degree field of view in both directions
+    Camera camera{Camera::ProjectionType::PERSPECTIVE};
+    camera.viewport_.width_ = 1000;
+    camera.viewport_.height_ = 1000;
+    camera.horizontal_field_of_view_ = math::Degree(90.0F);
+    const Entity near_entity = create_entity(math::Vec3f(0.0F, 0.0F, -10.0F), 0.1F);
+    const Entity far_entity = create_entity(math::Vec3f(0.0F, 0.0F, -1000.0F), 0.1F);
+    const Entity large_far_entity = create_entity(math::Vec3f(0.0F, 0.0F, -1000.0F), 10.0F);
+    const Entity around_camera_entity = create_entity(math::Vec3f(0.0F, 0.0F, 0.0F), 0.01F);
+    const std::vector<Entity> all_entities{near_entity, far_entity, large_far_entity, around_camera_entity};
+
+    // A radius of 0.1 at a depth of 10 covers 5 pixels and 0.05 pixels at a depth of 1000
+    std::vector<Entity> entities = all_entities;
+    EXPECT_EQ(CullingManager::CullSmallEntities(camera, 1.0F, registry, entities), 1);
+    EXPECT_EQ(entities, (std::vector<Entity>{near_entity, large_far_entity, around_camera_entity}));
+
+    entities = all_entities;
+    EXPECT_EQ(CullingManager::CullSmallEntities(camera, 10.0F, registry, entities), 3);
+    EXPECT_EQ(entities, (std::vector<Entity>{around_camera_entity}));
+
+    entities = all_entities;
+    EXPECT_EQ(CullingManager::CullSmallEntities(camera, 0.0F, registry, entities), 0);
+    EXPECT_EQ(entities, all_entities);
+}
+
+TEST(TestCullingManager, RankPointLights)
+{
+    entt::registry registry;
+    const auto create_light = [&registry](const math::Vec3f& position, float range) {
+        Entity entity = registry.create();
+        registry.emplace<Transform>(entity, position, math::Vec3f::One(), math::Quaternion::Identity());
+        // The intensity drops to the minimum intensity at the range
+        Attenuation& attenuation = registry.emplace<PointLight>(entity).attenuation_;
+        attenuation.constant_ = 1.0F;
+        attenuation.linear_ = 0.0F;
+        attenuation.quadratic_ = ((1.0F / Constants::kMinLightIntensity) - 1.0F) / (range * range);
+        return entity;
+    };
+
+    // The camera looks down -Z from the origin
+    Camera camera{Camera::ProjectionType::PERSPECTIVE};
+    const Entity far_light = create_light(math::Vec3f(0.0F, 0.0F, -100.0F), 10.0F);
+    create_light(math::Vec3f(0.0F, 0.0F, 50.0F), 10.0F);
+    const Entity near_light = create_light(math::Vec3f(0.0F, 0.0F, -20.0F), 10.0F);
+    const Entity around_camera_light = create_light(math::Vec3f(0.0F, 0.0F, 5.0F), 10.0F);
+    create_light(math::Vec3f(300.0F, 0.0F, -20.0F), 10.0F);
+    const PerspectiveViewVolume view_volume = ViewVolumeBuilder::CreatePerspective(camera);
+
+    std::vector<CullingManager::RankedLight> ranked_lights;
+    EXPECT_EQ(CullingManager::RankPointLights(view_volume, camera.position_, registry, 8, ranked_lights), 2);
+    ASSERT_EQ(ranked_lights.size(), 3);
+    EXPECT_EQ(ranked_lights[0].entity_, around_camera_light);
+    EXPECT_EQ(ranked_lights[1].entity_, near_light);
+    EXPECT_EQ(ranked_lights[2].entity_, far_light);
+    EXPECT_GT(ranked_lights[1].influence_, ranked_lights[2].influence_);
+
+    // The light budget keeps the most influential lights
+    EXPECT_EQ(CullingManager::RankPointLights(view_volume, camera.position_, registry, 2, ranked_lights), 2);
+    ASSERT_EQ(ranked_lights.size(), 2);
+    EXPECT_EQ(ranked_lights[0].entity_, around_camera_light);
+    EXPECT_EQ(ranked_lights[1].entity_, near_light);
+}
+
+TEST(TestCullingManager, GetLightInfluence)
+{
+    const math::Vec3f camera_position(0.0F);
+    EXPECT_FLOAT_EQ(CullingManager::GetLightInfluence(camera_position, math::Sphere(math::Vec3f(0.0F, 0.0F, -1.0F), 2.0F), 3.0F), 3.0F);
+    EXPECT_FLOAT_EQ(CullingManager::GetLightInfluence(camera_position, math::Sphere(math::Vec3f(0.0F, 0.0F, -10.0F), 5.0F), 2.0F), 0.5F);
+    EXPECT_FLOAT_EQ(CullingManager::GetLightInfluence(camera_position, math::Sphere(math::Vec3f(0.0F, 0.0F, -20.0F), 5.0F), 2.0F), 0.125F);
+}
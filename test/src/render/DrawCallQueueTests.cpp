@@ -0,0 +1,249 @@
+#include "render/renderer/DrawCallQueue.hpp"
+#include <algorithm>
+#include <random>
+#include <gtest/gtest.h>
+
+using namespace zero;
+using namespace zero::render;
+
+namespace
+{
+
+class TestDrawCall final : public IDrawCall
+{
+public:
+    TestDrawCall(uint64 sort_key, std::vector<uint32>* draw_order = nullptr)
+    : sort_key_(sort_key)
+    , draw_order_(draw_order)
+    {
+    }
+
+    [[nodiscard]] uint64 GetSortKey() const override
+    {
+        return sort_key_;
+    }
+
+    void Draw(IRenderHardware* /* rhi */) override
+    {
+        if (draw_order_)
+        {
+            draw_order_->push_back(static_cast<uint32>(sort_key_));
+        }
+    }
+
+private:
+    uint64 sort_key_;
+    std::vector<uint32>* draw_order_;
+};
+
+} // namespace
+
+class TestDrawCallQueue : public ::testing::Test
+{
+protected:
+    static std::vector<DrawCallQueue::Entry> CreateEntries(uint32 entry_count)
+    {
+        // Few distinct high bits and random low bits, so that keys repeat and some digits are shared
+        std::mt19937_64 generator(42);
+        std::vector<DrawCallQueue::Entry> entries;
+        entries.reserve(entry_count);
+        for (uint32 i = 0; i < entry_count; ++i)
+        {
+            const uint64 random_value = generator();
+            const uint64 sort_key = ((random_value >> 60U) << 56U) | (random_value & 0xFFFFFU);
+            entries.push_back(DrawCallQueue::Entry{sort_key, i});
+        }
+        return entries;
+    }
+
+    static std::vector<DrawCallQueue::Entry> StableSort(std::vector<DrawCallQueue::Entry> entries)
+    {
+        std::stable_sort(entries.begin(), entries.end(), [](const DrawCallQueue::Entry& lhs, const DrawCallQueue::Entry& rhs)
+        {
+            return lhs.sort_key_ < rhs.sort_key_;
+        });
+        return entries;
+    }
+
+    static void ExpectEqual(const std::vector<DrawCallQueue::Entry>& lhs, const std::vector<DrawCallQueue::Entry>& rhs)
+    {
+        ASSERT_EQ(lhs.size(), rhs.size());
+        for (std::size_t i = 0; i < lhs.size(); ++i)
+        {
+            ASSERT_EQ(lhs[i].sort_key_, rhs[i].sort_key_);
+            ASSERT_EQ(lhs[i].draw_index_, rhs[i].draw_index_);
+        }
+    }
+};
+
+TEST_F(TestDrawCallQueue, RadixSortMatchesStableSort)
+{
+    std::vector<DrawCallQueue::Entry> entries = CreateEntries(5000);
+    const std::vector<DrawCallQueue::Entry> expected = StableSort(entries);
+
+    std::vector<DrawCallQueue::Entry> scratch;
+    DrawCallQueue::RadixSort(entries, scratch);
+    ExpectEqual(entries, expected);
+}
+
+TEST_F(TestDrawCallQueue, RadixSortIdenticalKeys)
+{
+    std::vector<DrawCallQueue::Entry> entries{{7, 0}, {7, 1}, {7, 2}};
+    std::vector<DrawCallQueue::Entry> scratch;
+    DrawCallQueue::RadixSort(entries, scratch);
+    ExpectEqual(entries, {{7, 0}, {7, 1}, {7, 2}});
+
+    std::vector<DrawCallQueue::Entry> empty_entries;
+    DrawCallQueue::RadixSort(empty_entries, scratch);
+    EXPECT_TRUE(empty_entries.empty());
+}
+
+TEST_F(TestDrawCallQueue, ParallelRadixSortMatchesRadixSort)
+{
+    ThreadPool thread_pool(3);
+    std::vector<DrawCallQueue::Entry> entries = CreateEntries(100000);
+    std::vector<DrawCallQueue::Entry> parallel_entries = entries;
+
+    std::vector<DrawCallQueue::Entry> scratch;
+    std::vector<DrawCallQueue::Histogram> histograms;
+    DrawCallQueue::RadixSort(entries, scratch);
+    DrawCallQueue::ParallelRadixSort(thread_pool, parallel_entries, scratch, histograms);
+    EXPECT_EQ(histograms.size(), 4);
+    ExpectEqual(parallel_entries, entries);
+    ExpectEqual(parallel_entries, StableSort(CreateEntries(100000)));
+}
+
+TEST_F(TestDrawCallQueue, SortSubmittedDrawCalls)
+{
+    FrameArena frame_arena(1, 4096);
+    ThreadPool thread_pool(0);
+    DrawCallQueue draw_call_queue;
+    EXPECT_TRUE(draw_call_queue.IsEmpty());
+
+    draw_call_queue.Submit(frame_arena.New<TestDrawCall>(30));
+    draw_call_queue.Submit(frame_arena.New<TestDrawCall>(10));
+    draw_call_queue.Submit(frame_arena.New<TestDrawCall>(20));
+    draw_call_queue.Sort(thread_pool);
+    EXPECT_FALSE(draw_call_queue.IsEmpty());
+
+    const std::vector<DrawCallQueue::Entry>& entries = draw_call_queue.GetEntries();
+    ASSERT_EQ(entries.size(), 3);
+    EXPECT_EQ(entries[0].draw_index_, 1 | DrawCallQueue::kDrawCallFlag);
+    EXPECT_EQ(entries[1].draw_index_, 2 | DrawCallQueue::kDrawCallFlag);
+    EXPECT_EQ(entries[2].draw_index_, 0 | DrawCallQueue::kDrawCallFlag);
+    EXPECT_EQ(draw_call_queue.GetDrawCall(entries[0].draw_index_).GetSortKey(), 10);
+
+    draw_call_queue.Clear();
+    EXPECT_TRUE(draw_call_queue.IsEmpty());
+    EXPECT_TRUE(draw_call_queue.GetEntries().empty());
+}
+
+TEST_F(TestDrawCallQueue, DrawPacketsAndDrawCallsInSortedOrder)
+{
+    FrameArena frame_arena(1, 4096);
+    ThreadPool thread_pool(0);
+    DrawCallQueue draw_call_queue;
+    std::vector<uint32> draw_order;
+
+    DrawPacket draw_packet{};
+    draw_packet.mesh_handle_ = 30;
+    draw_call_queue.Submit(draw_packet, 30);
+    draw_call_queue.Submit(frame_arena.New<TestDrawCall>(10, &draw_order));
+    draw_packet.mesh_handle_ = 20;
+    draw_call_queue.Submit(draw_packet, 20);
+    draw_call_queue.Sort(thread_pool);
+
+    const std::vector<DrawCallQueue::Entry>& entries = draw_call_queue.GetEntries();
+    ASSERT_EQ(entries.size(), 3);
+    EXPECT_NE(entries[0].draw_index_ & DrawCallQueue::kDrawCallFlag, 0);
+    EXPECT_EQ(draw_call_queue.GetDrawPacket(entries[1].draw_index_).mesh_handle_, 20);
+
+    draw_call_queue.Draw(nullptr, 16, [&draw_order](const DrawPacket& draw_packet, uint32 /* first_instance */, uint32 /* instance_count */)
+    {
+        draw_order.push_back(draw_packet.mesh_handle_);
+    });
+    EXPECT_EQ(draw_order, (std::vector<uint32>{10, 20, 30}));
+}
+
+TEST_F(TestDrawCallQueue, DrawBatchesInstancedPackets)
+{
+    FrameArena frame_arena(1, 4096);
+    ThreadPool thread_pool(0);
+    DrawCallQueue draw_call_queue;
+    std::vector<uint32> draw_order;
+
+    // Five packets of the same mesh, split by a draw call and a packet with a different render state
+    DrawPacket draw_packet{};
+    draw_packet.mesh_handle_ = 1;
+    draw_call_queue.Submit(draw_packet, 1);
+    draw_call_queue.Submit(draw_packet, 2);
+    draw_call_queue.Submit(frame_arena.New<TestDrawCall>(3, &draw_order));
+    draw_call_queue.Submit(draw_packet, 4);
+    draw_call_queue.Submit(draw_packet, 5);
+    draw_call_queue.Submit(draw_packet, 7);
+    DrawPacket two_sided_packet = draw_packet;
+    two_sided_packet.two_sided_ = true;
+    draw_call_queue.Submit(two_sided_packet, 6);
+    draw_call_queue.Sort(thread_pool);
+
+    std::vector<std::pair<uint32, uint32>> batches;
+    draw_call_queue.Draw(nullptr, 2, [&batches](const DrawPacket& /* draw_packet */, uint32 first_instance, uint32 instance_count)
+    {
+        batches.emplace_back(first_instance, instance_count);
+    });
+
+    // Batches are capped by the maximum batch size
+    const std::vector<std::pair<uint32, uint32>> expected_batches{{0, 2}, {2, 2}, {4, 1}, {5, 1}};
+    EXPECT_EQ(batches, expected_batches);
+    EXPECT_EQ(draw_order, (std::vector<uint32>{3}));
+
+    DrawPacket other_packet = draw_packet;
+    EXPECT_TRUE(DrawCallQueue::CanInstance(draw_packet, other_packet));
+    other_packet.model_index_ = 3;
+    other_packet.material_index_ = 4;
+    EXPECT_TRUE(DrawCallQueue::CanInstance(draw_packet, other_packet));
+    other_packet.texture_handle_ = 2;
+    EXPECT_FALSE(DrawCallQueue::CanInstance(draw_packet, other_packet));
+    EXPECT_FALSE(DrawCallQueue::CanInstance(draw_packet, two_sided_packet));
+}
+
+TEST_F(TestDrawCallQueue, DrawKeyLayerFirst)
+{
+    const uint64 background_key = DrawKey::Create(DrawLayer::BACKGROUND, true, 0xFFFF, 0xFFFF, 0xFFFF, 1.0F);
+    const uint64 world_key = DrawKey::Create(DrawLayer::WORLD, false, 0, 0, 0, 0.0F);
+    EXPECT_LT(background_key, world_key);
+}
+
+TEST_F(TestDrawCallQueue, DrawKeyOpaqueBeforeTranslucent)
+{
+    const uint64 opaque_key = DrawKey::Create(DrawLayer::WORLD, false, 0xFFFF, 0xFFFF, 0xFFFF, 1.0F);
+    const uint64 translucent_key = DrawKey::Create(DrawLayer::WORLD, true, 0, 0, 0, 1.0F);
+    EXPECT_LT(opaque_key, translucent_key);
+}
+
+TEST_F(TestDrawCallQueue, DrawKeyOpaqueGroupedByState)
+{
+    // State takes precedence over depth
+    const uint64 near_key = DrawKey::Create(DrawLayer::WORLD, false, 2, 1, 1, 0.1F);
+    const uint64 far_key = DrawKey::Create(DrawLayer::WORLD, false, 1, 1, 1, 0.9F);
+    EXPECT_LT(far_key, near_key);
+
+    // Front to back within the same state
+    const uint64 same_state_near_key = DrawKey::Create(DrawLayer::WORLD, false, 1, 1, 1, 0.1F);
+    EXPECT_LT(same_state_near_key, far_key);
+
+    // Shader, then texture, then mesh
+    EXPECT_LT(DrawKey::Create(DrawLayer::WORLD, false, 1, 2, 2, 0.0F), DrawKey::Create(DrawLayer::WORLD, false, 2, 1, 1, 0.0F));
+    EXPECT_LT(DrawKey::Create(DrawLayer::WORLD, false, 1, 1, 2, 0.0F), DrawKey::Create(DrawLayer::WORLD, false, 1, 2, 1, 0.0F));
+}
+
+TEST_F(TestDrawCallQueue, DrawKeyTranslucentBackToFront)
+{
+    const uint64 near_key = DrawKey::Create(DrawLayer::WORLD, true, 1, 1, 1, 0.1F);
+    const uint64 far_key = DrawKey::Create(DrawLayer::WORLD, true, 2, 2, 2, 0.9F);
+    EXPECT_LT(far_key, near_key);
+
+    // Depths outside of the far clip distance are clamped
+    EXPECT_EQ(DrawKey::Create(DrawLayer::WORLD, true, 1, 1, 1, 2.0F), DrawKey::Create(DrawLayer::WORLD, true, 1, 1, 1, 1.0F));
+    EXPECT_EQ(DrawKey::Create(DrawLayer::WORLD, false, 1, 1, 1, -1.0F), DrawKey::Create(DrawLayer::WORLD, false, 1, 1, 1, 0.0F));
+}
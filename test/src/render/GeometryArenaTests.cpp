@@ -0,0 +1,125 @@
+#include "render/renderer/GeometryArena.hpp"
+#include <gtest/gtest.h>
+
+using namespace zero;
+using namespace zero::render;
+
+TEST(TestGeometryArena, AllocateAdjacentRanges)
+{
+    GeometryArena geometry_arena(100, 300);
+    const GeometryArena::Allocation first = geometry_arena.Allocate(10, 30);
+    const GeometryArena::Allocation second = geometry_arena.Allocate(20, 60);
+
+    EXPECT_EQ(geometry_arena.GetPageCount(), 1);
+    EXPECT_EQ(first.page_index_, 0);
+    EXPECT_EQ(first.base_vertex_, 0);
+    EXPECT_EQ(first.first_index_, 0);
+    EXPECT_EQ(second.page_index_, 0);
+    EXPECT_EQ(second.base_vertex_, 10);
+    EXPECT_EQ(second.vertex_count_, 20);
+    EXPECT_EQ(second.first_index_, 30);
+    EXPECT_EQ(second.index_count_, 60);
+}
+
+TEST(TestGeometryArena, AllocateAddsPageWhenFull)
+{
+    GeometryArena geometry_arena(100, 300);
+    geometry_arena.Allocate(80, 30);
+
+    // The vertices no longer fit even though the indices do
+    const GeometryArena::Allocation allocation = geometry_arena.Allocate(40, 30);
+    EXPECT_EQ(geometry_arena.GetPageCount(), 2);
+    EXPECT_EQ(allocation.page_index_, 1);
+    EXPECT_EQ(allocation.base_vertex_, 0);
+    EXPECT_EQ(allocation.first_index_, 0);
+
+    // Smaller meshes still fill the first page
+    EXPECT_EQ(geometry_arena.Allocate(20, 30).page_index_, 0);
+}
+
+TEST(TestGeometryArena, AllocateLargeMeshInOwnPage)
+{
+    GeometryArena geometry_arena(100, 300);
+    const GeometryArena::Allocation allocation = geometry_arena.Allocate(500, 900);
+
+    EXPECT_EQ(geometry_arena.GetPageCount(), 1);
+    EXPECT_EQ(allocation.page_index_, 0);
+    EXPECT_EQ(geometry_arena.GetPageVertexCapacity(0), 500);
+    EXPECT_EQ(geometry_arena.GetPageIndexCapacity(0), 900);
+
+    geometry_arena.Allocate(10, 10);
+    EXPECT_EQ(geometry_arena.GetPageCount(), 2);
+    EXPECT_EQ(geometry_arena.GetPageVertexCapacity(1), 100);
+    EXPECT_EQ(geometry_arena.GetPageIndexCapacity(1), 300);
+}
+
+TEST(TestGeometryArena, FreeReusesRange)
+{
+    GeometryArena geometry_arena(100, 300);
+    const GeometryArena::Allocation first = geometry_arena.Allocate(50, 150);
+    geometry_arena.Allocate(50, 150);
+    geometry_arena.Free(first);
+
+    const GeometryArena::Allocation reused = geometry_arena.Allocate(40, 120);
+    EXPECT_EQ(geometry_arena.GetPageCount(), 1);
+    EXPECT_EQ(reused.page_index_, 0);
+    EXPECT_EQ(reused.base_vertex_, 0);
+    EXPECT_EQ(reused.first_index_, 0);
+}
+
+TEST(TestGeometryArena, FreeMergesNeighbours)
+{
+    GeometryArena geometry_arena(100, 300);
+    const GeometryArena::Allocation first = geometry_arena.Allocate(25, 75);
+    const GeometryArena::Allocation second = geometry_arena.Allocate(25, 75);
+    const GeometryArena::Allocation third = geometry_arena.Allocate(25, 75);
+    geometry_arena.Allocate(25, 75);
+
+    geometry_arena.Free(first);
+    geometry_arena.Free(third);
+    EXPECT_EQ(geometry_arena.GetStatistics().vertices_.free_range_count_, 2);
+
+    // The middle range joins both of its free neighbours
+    geometry_arena.Free(second);
+    const GeometryArena::Statistics statistics = geometry_arena.GetStatistics();
+    EXPECT_EQ(statistics.vertices_.free_range_count_, 1);
+    EXPECT_EQ(statistics.vertices_.largest_free_range_, 75);
+    EXPECT_EQ(statistics.indices_.free_range_count_, 1);
+    EXPECT_EQ(statistics.indices_.largest_free_range_, 225);
+
+    const GeometryArena::Allocation merged = geometry_arena.Allocate(75, 225);
+    EXPECT_EQ(geometry_arena.GetPageCount(), 1);
+    EXPECT_EQ(merged.base_vertex_, 0);
+    EXPECT_EQ(merged.first_index_, 0);
+}
+
+TEST(TestGeometryArena, Statistics)
+{
+    GeometryArena geometry_arena(100, 300);
+    GeometryArena::Statistics statistics = geometry_arena.GetStatistics();
+    EXPECT_EQ(statistics.page_count_, 0);
+    EXPECT_EQ(statistics.vertices_.capacity_, 0);
+    EXPECT_FLOAT_EQ(statistics.vertices_.GetFragmentation(), 0.0F);
+
+    const GeometryArena::Allocation first = geometry_arena.Allocate(20, 60);
+    geometry_arena.Allocate(20, 60);
+    const GeometryArena::Allocation third = geometry_arena.Allocate(20, 60);
+    geometry_arena.Allocate(20, 60);
+    statistics = geometry_arena.GetStatistics();
+    EXPECT_EQ(statistics.page_count_, 1);
+    EXPECT_EQ(statistics.allocation_count_, 4);
+    EXPECT_EQ(statistics.vertices_.capacity_, 100);
+    EXPECT_EQ(statistics.vertices_.used_count_, 80);
+    EXPECT_EQ(statistics.indices_.used_count_, 240);
+    EXPECT_FLOAT_EQ(statistics.vertices_.GetFragmentation(), 0.0F);
+
+    // 60 free vertices split into ranges of 20, 20, and 20
+    geometry_arena.Free(first);
+    geometry_arena.Free(third);
+    statistics = geometry_arena.GetStatistics();
+    EXPECT_EQ(statistics.allocation_count_, 2);
+    EXPECT_EQ(statistics.vertices_.used_count_, 40);
+    EXPECT_EQ(statistics.vertices_.free_range_count_, 3);
+    EXPECT_EQ(statistics.vertices_.largest_free_range_, 20);
+    EXPECT_FLOAT_EQ(statistics.vertices_.GetFragmentation(), 2.0F / 3.0F);
+}
@@ -0,0 +1,166 @@
+#include "render/renderer/IndirectDrawList.hpp"
+#include "render/renderer/null/NullRenderHardware.hpp"
+#include "render/renderer/null/NullResources.hpp"
+#include <gtest/gtest.h>
+
+using namespace zero;
+using namespace zero::render;
+
+namespace
+{
+
+class CountingDrawCall final : public IDrawCall
+{
+public:
+    CountingDrawCall(uint64 sort_key, uint32* draw_count)
+    : sort_key_(sort_key)
+    , draw_count_(draw_count)
+    {
+    }
+
+    [[nodiscard]] uint64 GetSortKey() const override
+    {
+        return sort_key_;
+    }
+
+    void Draw(IRenderHardware* /* rhi */) override
+    {
+        ++(*draw_count_);
+    }
+
+private:
+    uint64 sort_key_;
+    uint32* draw_count_;
+};
+
+} // namespace
+
+class TestIndirectDrawList : public ::testing::Test
+{
+protected:
+    void Submit(uint32 mesh_handle, uint32 program_handle, uint64 sort_key)
+    {
+        DrawPacket draw_packet{};
+        draw_packet.mesh_handle_ = mesh_handle;
+        draw_packet.program_handle_ = program_handle;
+        draw_packet.model_index_ = render_resources_.AddModelData(ModelData{math::Matrix4x4::Identity(), math::Matrix4x4::Identity()});
+        draw_packet.material_index_ = render_resources_.AddMaterialData(MaterialData{Material{}});
+        draw_call_queue_.Submit(draw_packet, sort_key);
+    }
+
+    void Draw()
+    {
+        CommandBuffer command_buffer;
+        indirect_draw_list_.Record(command_buffer, [this, &command_buffer](const DrawPacket& draw_packet, uint32 first_command, uint32 command_count)
+        {
+            command_buffer.MultiDrawMeshIndirect(render_resources_.GetMesh(draw_packet.mesh_handle_), first_command, command_count);
+        });
+        command_buffer.Submit(&rhi_, uniform_manager_);
+    }
+
+    NullRenderHardware rhi_;
+    UniformManager uniform_manager_;
+    RenderResources render_resources_;
+    // Destroyed after the draw calls of the queue
+    FrameArena frame_arena_{1, 4096};
+    DrawCallQueue draw_call_queue_;
+    IndirectDrawList indirect_draw_list_;
+};
+
+TEST_F(TestIndirectDrawList, DrawCallsFollowStateChanges)
+{
+    ThreadPool thread_pool(0);
+    const uint32 first_mesh = render_resources_.AddMesh(std::make_shared<NullMesh>(36));
+    const uint32 second_mesh = render_resources_.AddMesh(std::make_shared<NullMesh>(12));
+    const uint32 first_program = render_resources_.AddProgram(std::make_shared<NullProgram>());
+    const uint32 second_program = render_resources_.AddProgram(std::make_shared<NullProgram>());
+
+    // 100 draws of two meshes with one program, then 10 draws with another program
+    uint64 sort_key = 0;
+    for (uint32 i = 0; i < 50; ++i)
+    {
+        Submit(first_mesh, first_program, sort_key++);
+    }
+    for (uint32 i = 0; i < 50; ++i)
+    {
+        Submit(second_mesh, first_program, sort_key++);
+    }
+    for (uint32 i = 0; i < 10; ++i)
+    {
+        Submit(first_mesh, second_program, sort_key++);
+    }
+    draw_call_queue_.Sort(thread_pool);
+    indirect_draw_list_.Build(draw_call_queue_, render_resources_);
+
+    // One command per mesh and program, one run per program
+    const std::vector<DrawIndirectCommand>& draw_commands = indirect_draw_list_.GetDrawCommands();
+    ASSERT_EQ(draw_commands.size(), 3);
+    EXPECT_EQ(draw_commands[0].index_count_, 36);
+    EXPECT_EQ(draw_commands[0].instance_count_, 50);
+    EXPECT_EQ(draw_commands[1].index_count_, 12);
+    EXPECT_EQ(draw_commands[1].base_instance_, 50);
+    EXPECT_EQ(draw_commands[2].base_instance_, 100);
+    ASSERT_EQ(indirect_draw_list_.GetDrawRuns().size(), 2);
+    EXPECT_EQ(indirect_draw_list_.GetDrawRuns()[0].command_count_, 2);
+
+    Draw();
+    const NullRenderHardware::Statistics& statistics = rhi_.GetStatistics();
+    EXPECT_EQ(statistics.draw_count_, 2);
+    EXPECT_EQ(statistics.instance_count_, 110);
+    EXPECT_EQ(statistics.draw_command_update_count_, 1);
+    EXPECT_EQ(statistics.storage_write_count_, 1);
+}
+
+TEST_F(TestIndirectDrawList, DrawCommandsOffsetIntoSharedGeometry)
+{
+    ThreadPool thread_pool(0);
+    const uint32 mesh = render_resources_.AddMesh(std::make_shared<NullMesh>(36, 120, 40));
+    const uint32 program = render_resources_.AddProgram(std::make_shared<NullProgram>());
+
+    Submit(mesh, program, 1);
+    Submit(mesh, program, 2);
+    draw_call_queue_.Sort(thread_pool);
+    indirect_draw_list_.Build(draw_call_queue_, render_resources_);
+
+    const std::vector<DrawIndirectCommand>& draw_commands = indirect_draw_list_.GetDrawCommands();
+    ASSERT_EQ(draw_commands.size(), 1);
+    EXPECT_EQ(draw_commands[0].first_index_, 120);
+    EXPECT_EQ(draw_commands[0].base_vertex_, 40);
+    EXPECT_EQ(draw_commands[0].instance_count_, 2);
+}
+
+TEST_F(TestIndirectDrawList, DrawCallsSplitRuns)
+{
+    ThreadPool thread_pool(0);
+    uint32 draw_call_count = 0;
+    const uint32 mesh = render_resources_.AddMesh(std::make_shared<NullMesh>(3));
+    const uint32 program = render_resources_.AddProgram(std::make_shared<NullProgram>());
+
+    Submit(mesh, program, 1);
+    draw_call_queue_.Submit(frame_arena_.New<CountingDrawCall>(2, &draw_call_count));
+    Submit(mesh, program, 3);
+    draw_call_queue_.Sort(thread_pool);
+    indirect_draw_list_.Build(draw_call_queue_, render_resources_);
+
+    const std::vector<IndirectDrawList::DrawRun>& draw_runs = indirect_draw_list_.GetDrawRuns();
+    ASSERT_EQ(draw_runs.size(), 3);
+    EXPECT_EQ(draw_runs[0].command_count_, 1);
+    EXPECT_NE(draw_runs[1].draw_call_, nullptr);
+    EXPECT_EQ(draw_runs[2].command_count_, 1);
+
+    Draw();
+    EXPECT_EQ(draw_call_count, 1);
+    EXPECT_EQ(rhi_.GetStatistics().draw_count_, 2);
+}
+
+TEST_F(TestIndirectDrawList, CanMultiDrawIgnoresMesh)
+{
+    DrawPacket draw_packet{};
+    DrawPacket other_packet{};
+    other_packet.mesh_handle_ = 2;
+    other_packet.model_index_ = 3;
+    EXPECT_TRUE(IndirectDrawList::CanMultiDraw(draw_packet, other_packet));
+
+    other_packet.wireframe_enabled_ = true;
+    EXPECT_FALSE(IndirectDrawList::CanMultiDraw(draw_packet, other_packet));
+}
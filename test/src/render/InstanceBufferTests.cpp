@@ -0,0 +1,94 @@
+#include "render/renderer/InstanceBuffer.hpp"
+#include "render/renderer/null/NullRenderHardware.hpp"
+#include "render/Constants.hpp"
+#include <gtest/gtest.h>
+
+using namespace zero;
+using namespace zero::render;
+
+class TestInstanceBuffer : public ::testing::Test
+{
+protected:
+    void Submit(uint32 packet_count)
+    {
+        ThreadPool thread_pool(0);
+        for (uint32 i = 0; i < packet_count; ++i)
+        {
+            DrawPacket draw_packet{};
+            draw_packet.mesh_handle_ = 1;
+            draw_packet.model_index_ = render_resources_.AddModelData(ModelData{math::Matrix4x4::Identity(), math::Matrix4x4::Identity()});
+            draw_packet.material_index_ = render_resources_.AddMaterialData(MaterialData{Material{}});
+            draw_call_queue_.Submit(draw_packet, i);
+        }
+        draw_call_queue_.Sort(thread_pool);
+    }
+
+    void Upload(uint32 window_index)
+    {
+        CommandBuffer command_buffer;
+        instance_buffer_.Upload(command_buffer, window_index);
+        command_buffer.Submit(&rhi_, uniform_manager_);
+    }
+
+    NullRenderHardware rhi_;
+    UniformManager uniform_manager_;
+    RenderResources render_resources_;
+    DrawCallQueue draw_call_queue_;
+    InstanceBuffer instance_buffer_;
+};
+
+TEST_F(TestInstanceBuffer, BuildGathersPackets)
+{
+    Submit(5);
+    instance_buffer_.Build(draw_call_queue_, render_resources_);
+    EXPECT_EQ(instance_buffer_.GetInstanceCount(), 5);
+
+    draw_call_queue_.Clear();
+    instance_buffer_.Build(draw_call_queue_, render_resources_);
+    EXPECT_EQ(instance_buffer_.GetInstanceCount(), 0);
+}
+
+TEST_F(TestInstanceBuffer, PlaceInOneWindow)
+{
+    Submit(5);
+    instance_buffer_.Build(draw_call_queue_, render_resources_);
+
+    // The whole frame fits in one window
+    const InstanceBuffer::Placement first_placement = instance_buffer_.Place(0, 2);
+    const InstanceBuffer::Placement second_placement = instance_buffer_.Place(2, 3);
+    EXPECT_EQ(first_placement.window_index_, 0);
+    EXPECT_EQ(first_placement.base_instance_, 0);
+    EXPECT_EQ(second_placement.window_index_, 0);
+    EXPECT_EQ(second_placement.base_instance_, 2);
+    EXPECT_EQ(instance_buffer_.GetWindowCount(), 1);
+
+    // A window is only written once
+    Upload(first_placement.window_index_);
+    Upload(second_placement.window_index_);
+    EXPECT_EQ(rhi_.GetStatistics().storage_write_count_, 1);
+    EXPECT_EQ(rhi_.GetStatistics().storage_write_bytes_, 5 * sizeof(InstanceData));
+
+    // Rebuilding invalidates the windows
+    instance_buffer_.Build(draw_call_queue_, render_resources_);
+    EXPECT_EQ(instance_buffer_.GetWindowCount(), 0);
+    EXPECT_EQ(instance_buffer_.Place(3, 2).base_instance_, 0);
+    Upload(0);
+    EXPECT_EQ(rhi_.GetStatistics().storage_write_count_, 2);
+    EXPECT_EQ(rhi_.GetStatistics().storage_write_bytes_, 7 * sizeof(InstanceData));
+}
+
+TEST_F(TestInstanceBuffer, PlaceStartsWindowWhenFull)
+{
+    Submit(Constants::kMaxInstanceCount + 10);
+    instance_buffer_.Build(draw_call_queue_, render_resources_);
+
+    EXPECT_EQ(instance_buffer_.Place(0, 100).window_index_, 0);
+    const InstanceBuffer::Placement placement = instance_buffer_.Place(Constants::kMaxInstanceCount - 5, 10);
+    EXPECT_EQ(placement.window_index_, 1);
+    EXPECT_EQ(placement.base_instance_, 0);
+
+    Upload(0);
+    Upload(1);
+    EXPECT_EQ(rhi_.GetStatistics().storage_write_count_, 2);
+    EXPECT_EQ(rhi_.GetStatistics().storage_write_bytes_, (Constants::kMaxInstanceCount + 15) * sizeof(InstanceData));
+}
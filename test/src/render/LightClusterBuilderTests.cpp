@@ -0,0 +1,181 @@
+#include "render/scene/LightClusterBuilder.hpp"
+#include "component/Camera.hpp"
+#include "component/Light.hpp"
+#include <cmath>
+#include <gtest/gtest.h>
+
+using namespace zero;
+using namespace zero::render;
+
+class TestLightClusterBuilder : public ::testing::Test
+{
+protected:
+    TestLightClusterBuilder()
+    : camera_(Camera::ProjectionType::PERSPECTIVE)
+    , thread_pool_(3)
+    , light_cluster_builder_()
+    , light_cluster_grid_()
+    , point_lights_()
+    , spot_lights_()
+    {
+    }
+
+    void SetUp() override
+    {
+        // The camera looks down the negative z axis
+        camera_.near_clip_ = 1.0F;
+        camera_.far_clip_ = 100.0F;
+    }
+
+    static Attenuation CreateAttenuation(float range)
+    {
+        // The intensity drops to the minimum intensity at the range
+        Attenuation attenuation{};
+        attenuation.constant_ = 1.0F;
+        attenuation.linear_ = 0.0F;
+        attenuation.quadratic_ = ((1.0F / Constants::kMinLightIntensity) - 1.0F) / (range * range);
+        return attenuation;
+    }
+
+    void AddPointLight(const math::Vec3f& position, float range)
+    {
+        PointLight point_light{};
+        point_light.attenuation_ = CreateAttenuation(range);
+        point_lights_.push_back(PointLightEntry{point_light, position});
+    }
+
+    void AddSpotLight(const math::Vec3f& position, float range)
+    {
+        SpotLight spot_light{};
+        spot_light.attenuation_ = CreateAttenuation(range);
+        spot_lights_.push_back(SpotLightEntry{spot_light, position, spot_light.direction_});
+    }
+
+    void Build(ThreadPool& thread_pool, LightClusterGrid& light_cluster_grid)
+    {
+        light_cluster_builder_.Build(thread_pool, camera_, point_lights_, spot_lights_, light_cluster_grid);
+    }
+
+    static uint32 GetClusterIndex(uint32 x, uint32 y, uint32 z)
+    {
+        return (((z * Constants::kLightClusterCountY) + y) * Constants::kLightClusterCountX) + x;
+    }
+
+    static uint32 GetPointLightCount(const LightCluster& cluster)
+    {
+        return cluster.light_counts_ & 0xFFFFU;
+    }
+
+    static uint32 GetSpotLightCount(const LightCluster& cluster)
+    {
+        return cluster.light_counts_ >> 16U;
+    }
+
+    Camera camera_;
+    ThreadPool thread_pool_;
+    LightClusterBuilder light_cluster_builder_;
+    LightClusterGrid light_cluster_grid_;
+    std::vector<PointLightEntry> point_lights_;
+    std::vector<SpotLightEntry> spot_lights_;
+};
+
+TEST(TestAttenuation, GetRange)
+{
+    Attenuation attenuation{};
+    attenuation.constant_ = 1.0F;
+    attenuation.linear_ = 0.0F;
+    attenuation.quadratic_ = 0.25F;
+    // 1 + 0.25 * d * d = 5
+    EXPECT_NEAR(attenuation.GetRange(0.2F), 4.0F, 1e-4F);
+
+    attenuation.quadratic_ = 0.0F;
+    attenuation.linear_ = 2.0F;
+    EXPECT_NEAR(attenuation.GetRange(0.2F), 2.0F, 1e-4F);
+
+    // The light never gets brighter than the minimum intensity
+    EXPECT_EQ(attenuation.GetRange(2.0F), 0.0F);
+
+    // The light never drops below the minimum intensity
+    attenuation.linear_ = 0.0F;
+    EXPECT_TRUE(std::isinf(attenuation.GetRange(0.2F)));
+}
+
+TEST_F(TestLightClusterBuilder, Build_AssignsLightsToOverlappingClusters)
+{
+    // Depth 10 is the middle depth slice between the near and far clip planes at depths 1 and 100
+    AddPointLight(math::Vec3f(0.0F, 0.0F, -10.0F), 0.5F);
+    AddPointLight(math::Vec3f(0.0F, 0.0F, -50.0F), 0.5F);
+    AddSpotLight(math::Vec3f(0.0F, 0.0F, -10.0F), 0.5F);
+    Build(thread_pool_, light_cluster_grid_);
+
+    ASSERT_EQ(light_cluster_grid_.clusters_.size(), Constants::kLightClusterCount);
+    EXPECT_NEAR((std::log(10.0F) * light_cluster_grid_.depth_scale_) + light_cluster_grid_.depth_bias_, 12.0F, 1e-3F);
+
+    // The lights sit on the corner between the four center clusters of their depth slice
+    const LightCluster& center_cluster = light_cluster_grid_.clusters_[GetClusterIndex(8, 4, 12)];
+    ASSERT_EQ(GetPointLightCount(center_cluster), 1);
+    ASSERT_EQ(GetSpotLightCount(center_cluster), 1);
+    // Point light indices are followed by spot light indices
+    EXPECT_EQ(light_cluster_grid_.light_indices_[center_cluster.light_index_offset_], 0);
+    EXPECT_EQ(light_cluster_grid_.light_indices_[center_cluster.light_index_offset_ + 1], 0);
+
+    const LightCluster& far_cluster = light_cluster_grid_.clusters_[GetClusterIndex(8, 4, 20)];
+    ASSERT_EQ(GetPointLightCount(far_cluster), 1);
+    EXPECT_EQ(GetSpotLightCount(far_cluster), 0);
+    EXPECT_EQ(light_cluster_grid_.light_indices_[far_cluster.light_index_offset_], 1);
+
+    // Clusters away from the lights are empty
+    EXPECT_EQ(light_cluster_grid_.clusters_[GetClusterIndex(0, 0, 12)].light_counts_, 0);
+    EXPECT_EQ(light_cluster_grid_.clusters_[GetClusterIndex(8, 4, 0)].light_counts_, 0);
+    EXPECT_EQ(light_cluster_grid_.clusters_[GetClusterIndex(15, 8, 23)].light_counts_, 0);
+}
+
+TEST_F(TestLightClusterBuilder, Build_MatchesSerialBuild)
+{
+    for (uint32 i = 0; i < 64; ++i)
+    {
+        const auto offset = static_cast<float>(i);
+        const math::Vec3f position((offset * 0.37F) - 12.0F, (offset * 0.21F) - 6.0F, -2.0F - (offset * 1.3F));
+        if (i % 3 == 0)
+        {
+            AddSpotLight(position, 1.0F + (offset * 0.1F));
+        }
+        else
+        {
+            AddPointLight(position, 1.0F + (offset * 0.1F));
+        }
+    }
+
+    ThreadPool serial_thread_pool(0);
+    LightClusterGrid serial_light_cluster_grid{};
+    Build(serial_thread_pool, serial_light_cluster_grid);
+    Build(thread_pool_, light_cluster_grid_);
+
+    ASSERT_EQ(light_cluster_grid_.clusters_.size(), serial_light_cluster_grid.clusters_.size());
+    for (uint32 i = 0; i < Constants::kLightClusterCount; ++i)
+    {
+        EXPECT_EQ(light_cluster_grid_.clusters_[i].light_index_offset_, serial_light_cluster_grid.clusters_[i].light_index_offset_);
+        EXPECT_EQ(light_cluster_grid_.clusters_[i].light_counts_, serial_light_cluster_grid.clusters_[i].light_counts_);
+    }
+    EXPECT_FALSE(light_cluster_grid_.light_indices_.empty());
+    EXPECT_EQ(light_cluster_grid_.light_indices_, serial_light_cluster_grid.light_indices_);
+}
+
+TEST_F(TestLightClusterBuilder, Build_LimitsLightIndexCount)
+{
+    // Every light reaches every cluster
+    for (uint32 i = 0; i < Constants::kMaxPointLights; ++i)
+    {
+        AddPointLight(math::Vec3f(0.0F, 0.0F, -10.0F), 1000.0F);
+    }
+    Build(thread_pool_, light_cluster_grid_);
+
+    EXPECT_EQ(light_cluster_grid_.light_indices_.size(), Constants::kMaxLightClusterIndexCount);
+    EXPECT_EQ(GetPointLightCount(light_cluster_grid_.clusters_.front()), Constants::kMaxPointLights);
+    EXPECT_EQ(light_cluster_grid_.clusters_.back().light_counts_, 0);
+    for (const LightCluster& cluster : light_cluster_grid_.clusters_)
+    {
+        EXPECT_LE(cluster.light_index_offset_ + GetPointLightCount(cluster) + GetSpotLightCount(cluster),
+                  light_cluster_grid_.light_indices_.size());
+    }
+}
@@ -0,0 +1,82 @@
+#include "render/scene/OcclusionCuller.hpp"
+#include "component/Camera.hpp"
+#include "component/Transform.hpp"
+#include "component/Volume.hpp"
+#include <gtest/gtest.h>
+
+using namespace zero;
+using namespace zero::render;
+
+class TestOcclusionCuller : public ::testing::Test
+{
+protected:
+    TestOcclusionCuller()
+    : registry_()
+    , camera_(Camera::ProjectionType::PERSPECTIVE)
+    , thread_pool_(2)
+    , occlusion_culler_()
+    {
+    }
+
+    void SetUp() override
+    {
+        // A wall 20 units in front of the camera, which looks down the negative z axis
+        wall_ = CreateEntity(math::Vec3f(0.0F, 0.0F, -20.0F), 15.0F);
+        registry_.emplace<Occluder>(wall_).box_ = math::Box(math::Vec3f(-10.0F, -10.0F, -20.5F), math::Vec3f(10.0F, 10.0F, -19.5F));
+    }
+
+    Entity CreateEntity(const math::Vec3f& position, float radius)
+    {
+        Entity entity = registry_.create();
+        registry_.emplace<Transform>(entity);
+        registry_.emplace<Volume>(entity, position, radius);
+        return entity;
+    }
+
+    entt::registry registry_;
+    Camera camera_;
+    ThreadPool thread_pool_;
+    OcclusionCuller occlusion_culler_;
+    Entity wall_;
+};
+
+TEST_F(TestOcclusionCuller, Cull_RemovesEntitiesBehindOccluders)
+{
+    const Entity hidden_entity = CreateEntity(math::Vec3f(0.0F, 0.0F, -40.0F), 2.0F);
+    const Entity front_entity = CreateEntity(math::Vec3f(0.0F, 0.0F, -10.0F), 1.0F);
+    const Entity side_entity = CreateEntity(math::Vec3f(22.0F, 0.0F, -40.0F), 1.0F);
+    const Entity partially_hidden_entity = CreateEntity(math::Vec3f(19.0F, 0.0F, -40.0F), 2.0F);
+
+    std::vector<Entity> entities{hidden_entity, wall_, front_entity, side_entity, partially_hidden_entity};
+    const uint32 occluded_count = occlusion_culler_.Cull(thread_pool_, camera_, registry_, entities);
+
+    EXPECT_EQ(occlusion_culler_.GetOccluderCount(), 1);
+    EXPECT_EQ(occluded_count, 1);
+    // The order of the visible entities is preserved and occluders are never removed
+    EXPECT_EQ(entities, (std::vector<Entity>{wall_, front_entity, side_entity, partially_hidden_entity}));
+}
+
+TEST_F(TestOcclusionCuller, IsOccluded)
+{
+    std::vector<Entity> entities{wall_};
+    occlusion_culler_.RenderOccluders(thread_pool_, camera_, registry_, entities);
+
+    EXPECT_TRUE(occlusion_culler_.IsOccluded(math::Box(math::Vec3f(-5.0F, -5.0F, -100.0F), math::Vec3f(5.0F, 5.0F, -30.0F))));
+    // Straddles the occluder
+    EXPECT_FALSE(occlusion_culler_.IsOccluded(math::Box(math::Vec3f(-5.0F, -5.0F, -30.0F), math::Vec3f(5.0F, 5.0F, -10.0F))));
+    // Crosses the near plane
+    EXPECT_FALSE(occlusion_culler_.IsOccluded(math::Box(math::Vec3f(-1.0F), math::Vec3f(1.0F))));
+}
+
+TEST_F(TestOcclusionCuller, RenderOccluders_IgnoresSmallAndClippedOccluders)
+{
+    const Entity small_occluder = CreateEntity(math::Vec3f(0.0F, 0.0F, -400.0F), 1.0F);
+    registry_.emplace<Occluder>(small_occluder).box_ = math::Box(math::Vec3f(-0.5F, -0.5F, -400.5F), math::Vec3f(0.5F, 0.5F, -399.5F));
+    const Entity surrounding_occluder = CreateEntity(math::Vec3f(0.0F), 2.0F);
+    registry_.emplace<Occluder>(surrounding_occluder).box_ = math::Box(math::Vec3f(-1.0F), math::Vec3f(1.0F));
+
+    std::vector<Entity> entities{small_occluder, surrounding_occluder};
+    occlusion_culler_.RenderOccluders(thread_pool_, camera_, registry_, entities);
+    EXPECT_EQ(occlusion_culler_.GetOccluderCount(), 0);
+    EXPECT_FALSE(occlusion_culler_.IsOccluded(math::Box(math::Vec3f(-5.0F, -5.0F, -100.0F), math::Vec3f(5.0F, 5.0F, -30.0F))));
+}
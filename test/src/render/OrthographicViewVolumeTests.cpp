@@ -109,4 +109,11 @@ TEST_F(TestOrthographicViewVolume, IsCulled_Box_OutOfVolume)
     box.min_ = max_ + math::kEpsilon;
     box.max_ = max_ + difference_;
     EXPECT_TRUE(volume_->IsCulled(box));
-}
\ No newline at end of file
+}
+
+TEST_F(TestOrthographicViewVolume, Classify_Box)
+{
+    EXPECT_EQ(volume_->Classify(volume_->GetViewBox()), IViewVolume::Containment::INSIDE);
+    EXPECT_EQ(volume_->Classify(math::Box{min_ - difference_, min_ - difference_ * 0.5F}), IViewVolume::Containment::OUTSIDE);
+    EXPECT_EQ(volume_->Classify(math::Box{min_ - difference_, volume_->GetViewBox().Center()}), IViewVolume::Containment::INTERSECTS);
+}
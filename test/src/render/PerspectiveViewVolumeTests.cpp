@@ -1,6 +1,7 @@
 #include "render/scene/ViewVolumeBuilder.hpp"
 #include "render/scene/PerspectiveViewVolume.hpp"
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <memory>
 
 using namespace zero;
@@ -135,6 +136,30 @@ TEST_F(TestPerspectiveViewVolume, IsCulled_Sphere_OutOfFrustrum)
     EXPECT_TRUE(volume_->IsCulled(sphere));
 }
 
+TEST_F(TestPerspectiveViewVolume, IsCulled_Sphere_PlaneHint)
+{
+    math::Sphere sphere(0.75F);
+    const math::Vec3f offset(0.0F, 0.0F, 1.0F);
+    sphere.center_ = far_top_right_ - offset;
+
+    // The rejecting plane is recorded and tested first afterwards
+    uint8 plane_hint = 0;
+    EXPECT_TRUE(volume_->IsCulled(sphere, plane_hint));
+    const uint8 rejecting_plane = plane_hint;
+    EXPECT_TRUE(volume_->IsCulled(sphere, plane_hint));
+    EXPECT_EQ(plane_hint, rejecting_plane);
+
+    // Any hint gives the same result
+    for (uint8 hint = 0; hint < 8; ++hint)
+    {
+        plane_hint = hint;
+        EXPECT_TRUE(volume_->IsCulled(sphere, plane_hint));
+        plane_hint = hint;
+        EXPECT_FALSE(volume_->IsCulled(math::Sphere((near_bottom_left_ + far_top_right_) * 0.5F, 0.75F), plane_hint));
+        EXPECT_EQ(plane_hint, hint);
+    }
+}
+
 TEST_F(TestPerspectiveViewVolume, IsCulled_Box_InFrustrum)
 {
     math::Box box{near_bottom_left_, far_top_right_};
@@ -147,4 +172,24 @@ TEST_F(TestPerspectiveViewVolume, IsCulled_Box_OutOfFrustrum)
     math::Vec3f max{-50.0F, -50.0F, 50.0F};
     math::Box box{min, max};
     EXPECT_TRUE(volume_->IsCulled(box));
-}
\ No newline at end of file
+}
+
+TEST_F(TestPerspectiveViewVolume, Classify_Box)
+{
+    const math::Vec3f center = (near_bottom_left_ + far_top_right_) * 0.5F;
+    const math::Vec3f extent{0.01F, 0.01F, 0.01F};
+    EXPECT_EQ(volume_->Classify(math::Box{center - extent, center + extent}), IViewVolume::Containment::INSIDE);
+
+    const math::Vec3f beyond_far = far_top_right_ + (far_top_right_ - near_bottom_left_);
+    EXPECT_EQ(volume_->Classify(math::Box{beyond_far - extent, beyond_far + extent}), IViewVolume::Containment::OUTSIDE);
+
+    // A box enclosing the whole frustum
+    const math::Vec3f padding{1.0F, 1.0F, 1.0F};
+    const math::Vec3f min = math::Vec3f(std::min(near_bottom_left_.x_, far_bottom_left_.x_),
+                                        std::min(near_bottom_left_.y_, far_bottom_left_.y_),
+                                        std::min(near_bottom_left_.z_, far_top_right_.z_)) - padding;
+    const math::Vec3f max = math::Vec3f(std::max(near_top_right_.x_, far_top_right_.x_),
+                                        std::max(near_top_right_.y_, far_top_right_.y_),
+                                        std::max(near_bottom_left_.z_, far_top_right_.z_)) + padding;
+    EXPECT_EQ(volume_->Classify(math::Box{min, max}), IViewVolume::Containment::INTERSECTS);
+}
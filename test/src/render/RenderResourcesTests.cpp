@@ -0,0 +1,99 @@
+#include "render/renderer/IDrawCall.hpp"
+#include "render/renderer/RenderResources.hpp"
+#include "render/renderer/null/NullResources.hpp"
+#include <gtest/gtest.h>
+
+using namespace zero;
+using namespace zero::render;
+
+TEST(TestRenderResources, AddResource_ReturnsValidHandles)
+{
+    RenderResources render_resources;
+    std::shared_ptr<IMesh> mesh = std::make_shared<NullMesh>();
+    std::shared_ptr<ITexture> texture = std::make_shared<NullTexture>();
+
+    const uint32 mesh_handle = render_resources.AddMesh(mesh);
+    const uint32 other_mesh_handle = render_resources.AddMesh(std::make_shared<NullMesh>());
+    const uint32 texture_handle = render_resources.AddTexture(texture);
+    EXPECT_NE(mesh_handle, RenderResources::kInvalidHandle);
+    EXPECT_NE(mesh_handle, other_mesh_handle);
+    EXPECT_NE(texture_handle, RenderResources::kInvalidHandle);
+    EXPECT_EQ(render_resources.GetMesh(mesh_handle), mesh);
+    EXPECT_EQ(render_resources.GetTexture(texture_handle), texture);
+}
+
+TEST(TestRenderResources, GetResource_InvalidHandleReturnsNull)
+{
+    RenderResources render_resources;
+    const uint32 mesh_handle = render_resources.AddMesh(std::make_shared<NullMesh>());
+    EXPECT_EQ(render_resources.GetMesh(RenderResources::kInvalidHandle), nullptr);
+    EXPECT_EQ(render_resources.GetMesh(mesh_handle + 1), nullptr);
+    EXPECT_EQ(render_resources.GetProgram(RenderResources::kInvalidHandle), nullptr);
+    EXPECT_EQ(render_resources.GetTexture(RenderResources::kInvalidHandle), nullptr);
+
+    // Handles of cleared resources are stale
+    render_resources.Clear();
+    EXPECT_DEBUG_DEATH(EXPECT_EQ(render_resources.GetMesh(mesh_handle), nullptr), "stale");
+    EXPECT_NE(render_resources.AddMesh(std::make_shared<NullMesh>()), mesh_handle);
+}
+
+TEST(TestRenderResources, RemoveResource_ReusesSlotWithNewGeneration)
+{
+    RenderResources render_resources;
+    const uint32 mesh_handle = render_resources.AddMesh(std::make_shared<NullMesh>());
+    const uint32 other_mesh_handle = render_resources.AddMesh(std::make_shared<NullMesh>());
+    std::shared_ptr<IMesh> mesh = std::make_shared<NullMesh>();
+
+    render_resources.RemoveMesh(mesh_handle);
+    const uint32 new_mesh_handle = render_resources.AddMesh(mesh);
+    EXPECT_NE(new_mesh_handle, mesh_handle);
+    EXPECT_NE(new_mesh_handle, RenderResources::kInvalidHandle);
+    EXPECT_EQ(render_resources.GetMesh(new_mesh_handle), mesh);
+    EXPECT_NE(render_resources.GetMesh(other_mesh_handle), nullptr);
+
+    // The slot of the removed mesh now holds the new mesh, which the stale handle must not reach
+    EXPECT_DEBUG_DEATH(EXPECT_EQ(render_resources.GetMesh(mesh_handle), nullptr), "stale");
+    EXPECT_DEBUG_DEATH(render_resources.RemoveMesh(mesh_handle), "stale");
+    EXPECT_EQ(render_resources.GetMesh(new_mesh_handle), mesh);
+
+    // Removing the invalid handle does nothing
+    render_resources.RemoveTexture(RenderResources::kInvalidHandle);
+    EXPECT_EQ(render_resources.GetTexture(RenderResources::kInvalidHandle), nullptr);
+}
+
+TEST(TestRenderResources, GetSlotIndex_IgnoresGeneration)
+{
+    RenderResources render_resources;
+    const uint32 mesh_handle = render_resources.AddMesh(std::make_shared<NullMesh>());
+    render_resources.RemoveMesh(mesh_handle);
+    const uint32 new_mesh_handle = render_resources.AddMesh(std::make_shared<NullMesh>());
+    const uint32 other_mesh_handle = render_resources.AddMesh(std::make_shared<NullMesh>());
+
+    EXPECT_EQ(RenderResources::GetSlotIndex(RenderResources::kInvalidHandle), 0U);
+    EXPECT_EQ(RenderResources::GetSlotIndex(new_mesh_handle), RenderResources::GetSlotIndex(mesh_handle));
+    EXPECT_NE(RenderResources::GetSlotIndex(other_mesh_handle), RenderResources::GetSlotIndex(new_mesh_handle));
+    EXPECT_LT(RenderResources::GetSlotIndex(other_mesh_handle), 1U << DrawKey::kMeshBits);
+}
+
+TEST(TestRenderResources, RemoveResource_ReleasesResource)
+{
+    RenderResources render_resources;
+    std::shared_ptr<ITexture> texture = std::make_shared<NullTexture>();
+    const uint32 texture_handle = render_resources.AddTexture(texture);
+    EXPECT_EQ(texture.use_count(), 2);
+
+    render_resources.RemoveTexture(texture_handle);
+    EXPECT_EQ(texture.use_count(), 1);
+}
+
+TEST(TestRenderResources, ClearFrameData_RestartsIndices)
+{
+    RenderResources render_resources;
+    const math::Matrix4x4 model_matrix = math::Matrix4x4::Identity().Translate(math::Vec3f(1.0F, 2.0F, 3.0F));
+    EXPECT_EQ(render_resources.AddModelData(ModelData{math::Matrix4x4::Identity(), math::Matrix4x4::Identity()}), 0);
+    EXPECT_EQ(render_resources.AddModelData(ModelData{model_matrix, math::Matrix4x4::Identity()}), 1);
+    EXPECT_EQ(render_resources.GetModelData(1).model_matrix_, model_matrix.Transpose());
+
+    render_resources.ClearFrameData();
+    EXPECT_EQ(render_resources.AddModelData(ModelData{model_matrix, math::Matrix4x4::Identity()}), 0);
+}
@@ -0,0 +1,88 @@
+#include "render/renderer/RenderStateCache.hpp"
+#include "render/renderer/null/NullRenderHardware.hpp"
+#include <gtest/gtest.h>
+
+using namespace zero;
+using namespace zero::render;
+
+TEST(TestRenderStateCache, FiltersUnchangedState)
+{
+    RenderStateCache state_cache;
+    EXPECT_TRUE(state_cache.SetProgram(1));
+    EXPECT_FALSE(state_cache.SetProgram(1));
+    EXPECT_TRUE(state_cache.SetProgram(2));
+
+    EXPECT_TRUE(state_cache.SetCullMode(IRenderHardware::CullMode::CULL_MODE_BACK));
+    EXPECT_FALSE(state_cache.SetCullMode(IRenderHardware::CullMode::CULL_MODE_BACK));
+    EXPECT_TRUE(state_cache.SetFillMode(IRenderHardware::FillMode::FILL_MODE_SOLID));
+    EXPECT_FALSE(state_cache.SetFillMode(IRenderHardware::FillMode::FILL_MODE_SOLID));
+    EXPECT_TRUE(state_cache.SetFillMode(IRenderHardware::FillMode::FILL_MODE_WIREFRAME));
+    EXPECT_TRUE(state_cache.SetVertexBuffer(4));
+    EXPECT_FALSE(state_cache.SetVertexBuffer(4));
+    EXPECT_EQ(state_cache.GetFilteredCount(), 4);
+
+    state_cache.ResetFilteredCount();
+    EXPECT_EQ(state_cache.GetFilteredCount(), 0);
+}
+
+TEST(TestRenderStateCache, FiltersPerSlot)
+{
+    RenderStateCache state_cache;
+
+    // Binding points are independent of each other
+    EXPECT_TRUE(state_cache.SetUniformBuffer(0, {1, 0, 0}));
+    EXPECT_TRUE(state_cache.SetUniformBuffer(3, {1, 0, 0}));
+    EXPECT_FALSE(state_cache.SetUniformBuffer(0, {1, 0, 0}));
+
+    // The range of the same buffer is part of the binding
+    EXPECT_TRUE(state_cache.SetUniformBuffer(0, {1, 256, 64}));
+    EXPECT_FALSE(state_cache.SetUniformBuffer(0, {1, 256, 64}));
+    EXPECT_TRUE(state_cache.SetStorageBuffer(0, {1, 256, 64}));
+
+    // Textures and samplers of a texture unit are tracked separately
+    EXPECT_TRUE(state_cache.SetTexture(1, 5));
+    EXPECT_TRUE(state_cache.SetSampler(1, 2));
+    EXPECT_FALSE(state_cache.SetTexture(1, 5));
+    EXPECT_TRUE(state_cache.SetSampler(1, 3));
+    EXPECT_EQ(state_cache.GetFilteredCount(), 3);
+}
+
+TEST(TestRenderStateCache, InvalidateForgetsState)
+{
+    RenderStateCache state_cache;
+    state_cache.SetProgram(1);
+    state_cache.SetCullMode(IRenderHardware::CullMode::CULL_MODE_NONE);
+    state_cache.SetTexture(0, 5);
+
+    state_cache.Invalidate();
+    EXPECT_TRUE(state_cache.SetProgram(1));
+    EXPECT_TRUE(state_cache.SetCullMode(IRenderHardware::CullMode::CULL_MODE_NONE));
+    EXPECT_TRUE(state_cache.SetTexture(0, 5));
+    EXPECT_EQ(state_cache.GetFilteredCount(), 0);
+}
+
+TEST(TestRenderStateCache, NullRenderHardwareCountsFilteredChanges)
+{
+    NullRenderHardware rhi;
+    std::vector<std::shared_ptr<IShader>> shaders{rhi.CreateShader(ShaderStage{})};
+    const std::shared_ptr<IProgram> program = rhi.CreateShaderProgram(shaders);
+    const std::shared_ptr<IProgram> other_program = rhi.CreateShaderProgram(shaders);
+
+    for (uint32 i = 0; i < 3; ++i)
+    {
+        rhi.BindShaderProgram(program);
+        rhi.SetCullMode(IRenderHardware::CullMode::CULL_MODE_BACK);
+        rhi.SetFillMode(IRenderHardware::FillMode::FILL_MODE_SOLID);
+    }
+    rhi.BindShaderProgram(other_program);
+    EXPECT_EQ(rhi.GetStatistics().program_bind_count_, 2);
+    EXPECT_EQ(rhi.GetStatistics().filtered_state_change_count_, 6);
+    EXPECT_EQ(rhi.GetFilteredStateChangeCount(), 6);
+    rhi.ResetFilteredStateChangeCount();
+    EXPECT_EQ(rhi.GetFilteredStateChangeCount(), 0);
+
+    // The program is unbound at the end of a frame
+    rhi.EndFrame();
+    rhi.BindShaderProgram(other_program);
+    EXPECT_EQ(rhi.GetStatistics().program_bind_count_, 3);
+}
@@ -0,0 +1,65 @@
+#include "render/RenderThread.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <vector>
+
+using namespace zero;
+using namespace zero::render;
+
+TEST(TestRenderThread, ExecutesTasksInSubmissionOrder)
+{
+    std::vector<uint32> executed_tasks{};
+    bool started = false;
+    bool stopped = false;
+
+    RenderThread render_thread{2};
+    render_thread.Start([&started]() { started = true; }, [&stopped]() { stopped = true; });
+    for (uint32 i = 0; i < 16; ++i)
+    {
+        render_thread.Submit([&executed_tasks, i]() { executed_tasks.push_back(i); });
+    }
+    render_thread.Stop();
+
+    EXPECT_TRUE(started);
+    EXPECT_TRUE(stopped);
+    EXPECT_FALSE(render_thread.IsRunning());
+    ASSERT_EQ(executed_tasks.size(), 16);
+    for (uint32 i = 0; i < 16; ++i)
+    {
+        EXPECT_EQ(executed_tasks[i], i);
+    }
+}
+
+TEST(TestRenderThread, ExecuteWaitsForCompletion)
+{
+    RenderThread render_thread{1};
+    render_thread.Start(nullptr, nullptr);
+
+    uint32 value = 0;
+    render_thread.Execute([&value]() { value = 42; });
+    EXPECT_EQ(value, 42);
+
+    render_thread.Stop();
+}
+
+TEST(TestRenderThread, BoundsPendingTasks)
+{
+    std::atomic<uint32> pending_tasks{0};
+    std::atomic<uint32> max_pending_tasks{0};
+
+    RenderThread render_thread{2};
+    render_thread.Start(nullptr, nullptr);
+    for (uint32 i = 0; i < 64; ++i)
+    {
+        const uint32 pending = ++pending_tasks;
+        max_pending_tasks = std::max(max_pending_tasks.load(), pending);
+        render_thread.Submit([&pending_tasks]() { --pending_tasks; });
+    }
+    render_thread.Flush();
+
+    EXPECT_EQ(pending_tasks, 0);
+    // The submitting thread can be at most one task ahead of the bound before Submit blocks
+    EXPECT_LE(max_pending_tasks, 3);
+
+    render_thread.Stop();
+}
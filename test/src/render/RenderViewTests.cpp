@@ -0,0 +1,44 @@
+#include "render/scene/RenderView.hpp"
+#include <gtest/gtest.h>
+
+using namespace zero;
+using namespace zero::render;
+
+TEST(TestRenderView, ResetClearsItemsAndLights)
+{
+    RenderView render_view{};
+    render_view.AddDrawItem().mesh_id_ = 1;
+    render_view.AddShadowDrawItem(0, ShadowDrawItem{2, math::Matrix4x4::Identity()});
+    render_view.AddDirectionalLight(DirectionalLight{});
+    render_view.AddPointLight(PointLightEntry{PointLight{}, math::Vec3f::Zero()});
+    render_view.AddSpotLight(SpotLightEntry{SpotLight{}, math::Vec3f::Zero(), math::Vec3f::Zero()});
+
+    EXPECT_EQ(render_view.GetDrawItems().size(), 1);
+    EXPECT_EQ(render_view.GetShadowDrawItems(0).size(), 1);
+    EXPECT_EQ(render_view.GetDirectionalLights().size(), 1);
+    EXPECT_EQ(render_view.GetPointLights().size(), 1);
+    EXPECT_EQ(render_view.GetSpotLights().size(), 1);
+
+    render_view.Reset();
+
+    EXPECT_TRUE(render_view.GetDrawItems().empty());
+    EXPECT_TRUE(render_view.GetShadowDrawItems(0).empty());
+    EXPECT_TRUE(render_view.GetDirectionalLights().empty());
+    EXPECT_TRUE(render_view.GetPointLights().empty());
+    EXPECT_TRUE(render_view.GetSpotLights().empty());
+}
+
+TEST(TestRenderView, DrawItemsAreReusedInPlace)
+{
+    RenderView render_view{};
+    DrawItem& first_frame_item = render_view.AddDrawItem();
+    first_frame_item.mesh_id_ = 7;
+    first_frame_item.material_.name_ = "a material name that does not fit in the small string buffer";
+
+    render_view.Reset();
+
+    DrawItem& second_frame_item = render_view.AddDrawItem();
+    EXPECT_EQ(&first_frame_item, &second_frame_item);
+    EXPECT_EQ(render_view.GetDrawItems().data(), &second_frame_item);
+    EXPECT_EQ(render_view.GetDrawItems().size(), 1);
+}
@@ -0,0 +1,16 @@
+#include "render/renderer/ShaderNameTable.hpp"
+#include <gtest/gtest.h>
+
+using namespace zero;
+using namespace zero::render;
+
+TEST(TestShaderNameTable, InternReturnsStableIdentifiers)
+{
+    ShaderNameTable& name_table = ShaderNameTable::GetTable();
+    const uint32 camera_identifier = name_table.Intern("TestShaderNameTable.Camera");
+    const uint32 sampler_identifier = name_table.Intern("TestShaderNameTable.u_sampler[1]");
+    EXPECT_NE(camera_identifier, sampler_identifier);
+    EXPECT_EQ(name_table.Intern("TestShaderNameTable.Camera"), camera_identifier);
+    EXPECT_EQ(name_table.GetName(camera_identifier), "TestShaderNameTable.Camera");
+    EXPECT_EQ(name_table.GetName(sampler_identifier), "TestShaderNameTable.u_sampler[1]");
+}
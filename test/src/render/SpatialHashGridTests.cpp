@@ -0,0 +1,170 @@
+#include "render/scene/BoundingVolumeHierarchy.hpp"
+#include "render/scene/SpatialHashGrid.hpp"
+#include "render/scene/ViewVolumeBuilder.hpp"
+#include "component/Camera.hpp"
+#include "component/Material.hpp"
+#include "component/Mesh.hpp"
+#include "component/Transform.hpp"
+#include "component/Volume.hpp"
+#include "math/Intersection.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+
+using namespace zero;
+using namespace zero::render;
+
+class TestSpatialHashGrid : public ::testing::Test
+{
+protected:
+    static constexpr uint32 kEntityCount = 2000;
+
+    TestSpatialHashGrid()
+    : registry_()
+    , spatial_hash_grid_(16.0F)
+    , generator_(4321)
+    {
+    }
+
+    void SetUp() override
+    {
+        std::uniform_real_distribution<float> position_distribution(-300.0F, 300.0F);
+        std::uniform_real_distribution<float> radius_distribution(0.5F, 8.0F);
+        for (uint32 i = 0; i < kEntityCount; ++i)
+        {
+            const math::Vec3f position(position_distribution(generator_),
+                                       position_distribution(generator_),
+                                       position_distribution(generator_));
+            CreateRenderable(position, radius_distribution(generator_), true);
+        }
+    }
+
+    Entity CreateRenderable(const math::Vec3f& position, float radius, bool is_dynamic)
+    {
+        Entity entity = registry_.create();
+        registry_.emplace<Transform>(entity);
+        registry_.emplace<Material>(entity);
+        registry_.emplace<Mesh>(entity);
+        registry_.emplace<Volume>(entity, position, radius);
+        if (is_dynamic)
+        {
+            registry_.emplace<DynamicVolume>(entity);
+        }
+        return entity;
+    }
+
+    void MoveAll(float distance)
+    {
+        std::uniform_real_distribution<float> offset_distribution(-distance, distance);
+        auto volume_view = registry_.view<Volume, const DynamicVolume>();
+        for (Entity entity : volume_view)
+        {
+            volume_view.get<Volume>(entity).Translate(math::Vec3f(offset_distribution(generator_),
+                                                                  offset_distribution(generator_),
+                                                                  offset_distribution(generator_)));
+        }
+    }
+
+    template<class Shape, class IsCulled>
+    void ExpectMatchesLinearScan(const Shape& shape, const IsCulled& is_culled)
+    {
+        std::vector<Entity> entities;
+        spatial_hash_grid_.Query(shape, registry_, entities);
+        std::sort(entities.begin(), entities.end());
+
+        std::vector<Entity> expected_entities;
+        auto volume_view = registry_.view<const Volume, const DynamicVolume>();
+        for (Entity entity : volume_view)
+        {
+            if (!is_culled(volume_view.get<const Volume>(entity).bounding_volume_))
+            {
+                expected_entities.push_back(entity);
+            }
+        }
+        std::sort(expected_entities.begin(), expected_entities.end());
+
+        EXPECT_FALSE(expected_entities.empty());
+        EXPECT_EQ(entities, expected_entities);
+    }
+
+    void ExpectQueriesMatchLinearScan()
+    {
+        Camera camera{Camera::ProjectionType::PERSPECTIVE};
+        camera.far_clip_ = 200.0F;
+        const PerspectiveViewVolume view_volume = ViewVolumeBuilder::CreatePerspective(camera);
+        ExpectMatchesLinearScan(view_volume, [&view_volume](const math::Sphere& sphere) {
+            return view_volume.IsCulled(sphere);
+        });
+
+        const math::Box box{math::Vec3f(-50.0F), math::Vec3f(80.0F)};
+        ExpectMatchesLinearScan(box, [&box](const math::Sphere& sphere) {
+            return !math::Intersection::BoxSphereIntersect(box, sphere);
+        });
+
+        const math::Sphere query_sphere{math::Vec3f(20.0F, -10.0F, 5.0F), 60.0F};
+        ExpectMatchesLinearScan(query_sphere, [&query_sphere](const math::Sphere& sphere) {
+            return !query_sphere.Intersects(sphere);
+        });
+    }
+
+    entt::registry registry_;
+    SpatialHashGrid spatial_hash_grid_;
+    std::mt19937 generator_;
+};
+
+TEST_F(TestSpatialHashGrid, Query_MatchesLinearScan)
+{
+    spatial_hash_grid_.Update(registry_);
+    EXPECT_EQ(spatial_hash_grid_.GetEntityCount(), kEntityCount);
+    ExpectQueriesMatchLinearScan();
+}
+
+TEST_F(TestSpatialHashGrid, Update_TracksMovingVolumes)
+{
+    spatial_hash_grid_.Update(registry_);
+    for (uint32 frame = 0; frame < 10; ++frame)
+    {
+        MoveAll(12.0F);
+        spatial_hash_grid_.Update(registry_);
+        ExpectQueriesMatchLinearScan();
+    }
+    EXPECT_EQ(spatial_hash_grid_.GetEntityCount(), kEntityCount);
+}
+
+TEST_F(TestSpatialHashGrid, Update_CompactsEmptyCells)
+{
+    spatial_hash_grid_.Update(registry_);
+    const uint32 cell_count = spatial_hash_grid_.GetCellCount();
+
+    // Gather every entity into a single cell
+    auto volume_view = registry_.view<Volume, const DynamicVolume>();
+    for (Entity entity : volume_view)
+    {
+        Volume& volume = volume_view.get<Volume>(entity);
+        volume.Translate(math::Vec3f(1.0F) - volume.bounding_volume_.center_);
+    }
+    spatial_hash_grid_.Update(registry_);
+    EXPECT_LT(spatial_hash_grid_.GetCellCount(), cell_count);
+    EXPECT_EQ(spatial_hash_grid_.GetCellCount(), 1);
+
+    std::vector<Entity> entities;
+    spatial_hash_grid_.Query(math::Sphere{math::Vec3f(1.0F), 1.0F}, registry_, entities);
+    EXPECT_EQ(entities.size(), kEntityCount);
+}
+
+TEST_F(TestSpatialHashGrid, StaticAndDynamicEntitiesAreDisjoint)
+{
+    BoundingVolumeHierarchy bounding_volume_hierarchy{};
+    const Entity static_entity = CreateRenderable(math::Vec3f(0.0F), 1.0F, false);
+    spatial_hash_grid_.Update(registry_);
+    bounding_volume_hierarchy.Update(registry_);
+    EXPECT_EQ(spatial_hash_grid_.GetEntityCount(), kEntityCount);
+    EXPECT_EQ(bounding_volume_hierarchy.GetEntityCount(), 1);
+
+    // Tagging the entity moves it from the hierarchy to the grid
+    registry_.emplace<DynamicVolume>(static_entity);
+    spatial_hash_grid_.Update(registry_);
+    bounding_volume_hierarchy.Update(registry_);
+    EXPECT_EQ(spatial_hash_grid_.GetEntityCount(), kEntityCount + 1);
+    EXPECT_EQ(bounding_volume_hierarchy.GetEntityCount(), 0);
+}
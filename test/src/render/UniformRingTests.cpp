@@ -0,0 +1,46 @@
+#include "render/renderer/UniformRing.hpp"
+#include <gtest/gtest.h>
+
+using namespace zero;
+using namespace zero::render;
+
+TEST(TestUniformRing, AllocateAlignsOffsets)
+{
+    UniformRing uniform_ring(3, 1024, 256);
+    uniform_ring.BeginRegion();
+    EXPECT_EQ(uniform_ring.GetRegionIndex(), 0);
+
+    const UniformRange first_range = uniform_ring.Allocate(100);
+    const UniformRange second_range = uniform_ring.Allocate(300);
+    EXPECT_EQ(first_range.offset_, 0);
+    EXPECT_EQ(first_range.size_, 100);
+    EXPECT_EQ(second_range.offset_, 256);
+    EXPECT_EQ(second_range.size_, 300);
+    EXPECT_EQ(uniform_ring.GetUsedSize(), 556);
+}
+
+TEST(TestUniformRing, BeginRegionCyclesThroughRegions)
+{
+    UniformRing uniform_ring(3, 1024, 256);
+    for (uint32 frame = 0; frame < 4; ++frame)
+    {
+        uniform_ring.BeginRegion();
+        EXPECT_EQ(uniform_ring.GetUsedSize(), 0);
+        const UniformRange uniform_range = uniform_ring.Allocate(16);
+        EXPECT_EQ(uniform_range.offset_, (frame % 3) * 1024);
+        EXPECT_EQ(uniform_ring.GetRegionOffset(), (frame % 3) * 1024);
+    }
+    EXPECT_EQ(uniform_ring.GetSize(), 3 * 1024);
+}
+
+TEST(TestUniformRing, AllocateFailsWhenRegionIsFull)
+{
+    UniformRing uniform_ring(2, 1024, 256);
+    uniform_ring.BeginRegion();
+    uniform_ring.BeginRegion();
+    EXPECT_EQ(uniform_ring.Allocate(1024).size_, 1024);
+    EXPECT_EQ(uniform_ring.Allocate(1).size_, 0);
+
+    // Failed allocations do not use up the region
+    EXPECT_EQ(uniform_ring.GetUsedSize(), 1024);
+}